@@ -219,6 +219,10 @@ struct geopm_report_s {
 int geopm_stats_collector_create(size_t num_requests, const struct geopm_request_s *requests,
                                  struct geopm_stats_collector_s **collector);
 
+int geopm_stats_collector_create_quantile(size_t num_requests, const struct geopm_request_s *requests,
+                                          size_t num_quantile, const double *quantiles,
+                                          struct geopm_stats_collector_s **collector);
+
 int geopm_stats_collector_update(struct geopm_stats_collector_s *collector);
 
 int geopm_stats_collector_update_count(const struct geopm_stats_collector_s *collector,
@@ -230,6 +234,10 @@ int geopm_stats_collector_report_yaml(const struct geopm_stats_collector_s *coll
 int geopm_stats_collector_report(const struct geopm_stats_collector_s *collector,
                                  size_t num_requests, struct geopm_report_s *report);
 
+int geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests, size_t num_quantile,
+                                          double *quantile_values);
+
 int geopm_stats_collector_reset(struct geopm_stats_collector_s *collector);
 
 int geopm_stats_collector_free(struct geopm_stats_collector_s *collector);
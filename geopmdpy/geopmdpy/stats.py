@@ -31,7 +31,7 @@ class Collector:
     """ Object for aggregating statistics gathered from the PlatformIO interface of GEOPM
 
     """
-    def __init__(self, signal_config):
+    def __init__(self, signal_config, quantiles=None):
         """Create stats collector
 
         Provide a list of read requests for PlatformIO.
@@ -41,8 +41,14 @@ class Collector:
                 signals where each tuple represents
                 (signal_name, domain_type, domain_idx).
 
+            quantiles (list(float)): Optional values between zero and
+                one, e.g. 0.95, whose estimates are added to the
+                statistics of each signal.  Each estimate is named by
+                the percentile, e.g. 'p95'.
+
         """
         self._collector_ptr = None
+        self._quantiles = [] if quantiles is None else list(quantiles)
         self._num_signal = len(signal_config)
         if self._num_signal == 0:
             raise ValueError('Collector creation failed: length of input is zero')
@@ -55,9 +61,17 @@ class Collector:
 
         collector_ptr = gffi.gffi.new('struct geopm_stats_collector_s **');
 
-        err = gffi.dl_geopmd.geopm_stats_collector_create(self._num_signal, signal_config_carr, collector_ptr)
-        if err < 0:
-            raise RuntimeError('geopm_stats_collector_create() failed: {}'.format(error.message(err)))
+        if len(self._quantiles) == 0:
+            err = gffi.dl_geopmd.geopm_stats_collector_create(self._num_signal, signal_config_carr, collector_ptr)
+            if err < 0:
+                raise RuntimeError('geopm_stats_collector_create() failed: {}'.format(error.message(err)))
+        else:
+            quantiles_carr = gffi.gffi.new('double[]', self._quantiles)
+            err = gffi.dl_geopmd.geopm_stats_collector_create_quantile(self._num_signal, signal_config_carr,
+                                                                       len(self._quantiles), quantiles_carr,
+                                                                       collector_ptr)
+            if err < 0:
+                raise RuntimeError('geopm_stats_collector_create_quantile() failed: {}'.format(error.message(err)))
         self._collector_ptr = collector_ptr[0];
 
     def __enter__(self):
@@ -177,6 +191,18 @@ class Collector:
                                        "max": report_ptr.metric_stats[metric_idx].stats[METRIC_MAX],
                                        "mean": report_ptr.metric_stats[metric_idx].stats[METRIC_MEAN],
                                        "std": report_ptr.metric_stats[metric_idx].stats[METRIC_STD]}
+        if len(self._quantiles) != 0:
+            num_quantile = len(self._quantiles)
+            quantile_values = gffi.gffi.new('double[]', self._num_signal * num_quantile)
+            err = gffi.dl_geopmd.geopm_stats_collector_report_quantile(self._collector_ptr, self._num_signal,
+                                                                       num_quantile, quantile_values)
+            if err < 0:
+                raise RuntimeError('geopm_stats_collector_report_quantile() failed: {}'.format(error.message(err)))
+            for metric_idx in range(report_ptr.num_metric):
+                name = gffi.gffi.string(report_ptr.metric_stats[metric_idx].name).decode()
+                for quantile_idx, quantile in enumerate(self._quantiles):
+                    result['metrics'][name][quantile_name(quantile)] = \
+                        quantile_values[metric_idx * num_quantile + quantile_idx]
         return result
 
     def report_csv(self, delimiter=',', print_header=True):
@@ -233,6 +259,7 @@ class Collector:
         data = [report[kk] for kk in header]
 
         metric_stat_names = ['count', 'first', 'last', 'min', 'max', 'mean', 'std']
+        metric_stat_names += [quantile_name(qq) for qq in self._quantiles]
         for metric_name in sorted(report['metrics'].keys()):
             for stat_name in metric_stat_names:
                 header.append(f'{metric_name}-{stat_name}')
@@ -251,3 +278,10 @@ class Collector:
         err = gffi.dl_geopmd.geopm_stats_collector_reset(self._collector_ptr)
         if err < 0:
             raise RuntimeError('geopm_stats_collector_reset() failed: {}'.format(error.message(err)))
+
+
+def quantile_name(quantile):
+    """Name of a quantile in reports, e.g. 'p95' for 0.95
+
+    """
+    return f'p{quantile * 100:g}'
@@ -418,6 +418,13 @@ class ActiveSessions(object):
         for file_path in glob.glob(dead_glob):
             os.unlink(file_path)
 
+        # Remove the table of samples shared by batch servers, it is
+        # created again by the first batch server that streams
+        try:
+            os.unlink(os.path.join(self._RUN_PATH, 'batch-cache'))
+        except FileNotFoundError:
+            pass
+
         # Load all session files in the directory
         for sess_path in glob.glob(self._get_session_path('*')):
             self._load_session_file(sess_path)
@@ -840,7 +847,12 @@ class ActiveSessions(object):
         else:
             self._profiles[profile_name] = {client_pid}
         self._sessions[client_pid]['profile_name'] = profile_name
-        size = 57384
+        # Must match ApplicationRecordLog::buffer_size() in libgeopm:
+        # a shared table followed by one slot per CPU the client may
+        # run on.  The file is sparse, so only slots that are written
+        # consume memory.
+        num_slot = len(os.sched_getaffinity(client_pid))
+        size = 57472 + 115008 * num_slot
         shmem.create_prof('record-log', size, client_pid, uid, gid)
         self._update_session_file(client_pid)
 
@@ -245,6 +245,19 @@ class TestActiveSessions(unittest.TestCase):
         # Invalid string file which is a C source code
         self.check_json_file('string_c_code', self.string_c_code, False)
 
+    def test_remove_batch_cache(self):
+        """Table shared by batch servers is removed on start
+
+        """
+        sess_path = f'{self._TEMP_DIR.name}/geopm'
+        os.makedirs(sess_path, mode=0o700)
+        cache_path = os.path.join(sess_path, 'batch-cache')
+        Path(cache_path).touch()
+        ActiveSessions(sess_path)
+        self.assertFalse(os.path.exists(cache_path))
+        # Start without a table
+        ActiveSessions(sess_path)
+
     def test_load_clients(self):
         """ Create from existing clients
 
@@ -362,6 +375,7 @@ class TestActiveSessions(unittest.TestCase):
              mock.patch('psutil.Process', autospec=True, spec_set=True) as mock_process, \
              mock.patch('geopmdpy.shmem.create_prof', autospec=True, specset=True) as mock_shmem_create, \
              mock.patch('geopmdpy.shmem.path_prof', autospec=True, specset=True, return_value='file_path') as mock_shmem_path, \
+             mock.patch('os.sched_getaffinity', return_value={0, 1}) as mock_affinity, \
              mock.patch('os.unlink') as mock_unlink:
 
             act_sess = ActiveSessions(sess_path)
@@ -381,8 +395,9 @@ class TestActiveSessions(unittest.TestCase):
             mock_process.assert_has_calls(calls)
 
             calls = [mock.call('status', 64 * os.cpu_count(), client_pid, client_uid, client_gid),
-                     mock.call('record-log', 57384, client_pid, client_uid, client_gid)]
+                     mock.call('record-log', 57472 + 2 * 115008, client_pid, client_uid, client_gid)]
             mock_shmem_create.assert_has_calls(calls)
+            mock_affinity.assert_called_once_with(client_pid)
             self.assertEqual({client_pid}, act_sess.get_profile_pids(profile_name))
             updated_json_contents = dict(self.json_good_example)
             updated_json_contents.update({'profile_name' : profile_name})
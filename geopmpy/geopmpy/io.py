@@ -322,7 +322,9 @@ class Trace(object):
 
     This object will parse both the header and the CSV data in a trace
     file.  The header identifies the uniquely-identifying configuration
-    for this file which is used for later indexing purposes.
+    for this file which is used for later indexing purposes.  Trace
+    files written with ``GEOPM_TRACE_FORMAT=binary`` are detected and
+    loaded directly into numpy arrays without parsing the values.
 
     Even though ``__getattr__()`` and ``__getitem__()`` allow this object to
     effectively be treated like a ``DataFrame``, you must use ``get_df()`` if
@@ -364,6 +366,18 @@ class Trace(object):
         old_governor_headers = {'power_budget': 'POWER_BUDGET'}
         old_headers.update(old_governor_headers)
 
+        self._version = None
+        self._start_time = None
+        self._profile_name = None
+        self._agent = None
+        self._node_name = None
+        self._use_agent = use_agent
+
+        if Trace._is_binary(trace_path):
+            header, self._df = Trace._read_binary(trace_path)
+            self._set_header(header)
+            return
+
         # Need to determine how many lines are in the header
         # explicitly.  We cannot use '#' as a comment character since
         # it occurs in raw MSR signal names.
@@ -396,12 +410,6 @@ class Trace(object):
         except KeyError: # Hash and hint are not present in profile traces
             pass
 
-        self._version = None
-        self._start_time = None
-        self._profile_name = None
-        self._agent = None
-        self._node_name = None
-        self._use_agent = use_agent
         self._parse_header(trace_path)
 
     def __repr__(self):
@@ -462,6 +470,14 @@ class Trace(object):
             out.append('}')
             json_str = ''.join(out)
             dd = json.loads(json_str)
+        self._set_header(dd)
+
+    def _set_header(self, dd):
+        """Stores the configuration fields of a parsed trace header.
+
+        Args:
+            dd: Dictionary of header fields.
+        """
         try:
             self._version = dd['geopm_version']
             self._start_time = dd['start_time']
@@ -472,6 +488,72 @@ class Trace(object):
         except KeyError:
             raise SyntaxError('<geopm> geopmpy.io: Trace file header could not be parsed!')
 
+    _BINARY_MAGIC = b'GEOPMBIN'
+
+    @staticmethod
+    def _is_binary(trace_path):
+        with open(trace_path, 'rb') as fid:
+            return fid.read(len(Trace._BINARY_MAGIC)) == Trace._BINARY_MAGIC
+
+    @staticmethod
+    def _read_binary(trace_path):
+        """Loads a binary columnar trace file.
+
+        The file begins with a magic string, the little-endian uint64
+        size of a JSON header and the header.  It is followed by
+        blocks each made of a uint64 row count and the double
+        precision values of every column in turn, stored in the byte
+        order recorded in the header.
+
+        Args:
+            trace_path: The path to the trace file to load.
+
+        Returns:
+            tuple(dict, pandas.DataFrame): The header and the trace data.
+        """
+        with open(trace_path, 'rb') as fid:
+            data = fid.read()
+        offset = len(Trace._BINARY_MAGIC)
+        header_size = int(numpy.frombuffer(data, dtype='<u8', count=1, offset=offset)[0])
+        offset += 8
+        header = json.loads(data[offset:offset + header_size].decode('utf-8'))
+        offset += header_size
+        byte_orders = {'little': '<', 'big': '>'}
+        try:
+            order = byte_orders[header['byte_order']]
+        except KeyError:
+            raise SyntaxError('<geopm> geopmpy.io: Binary trace header has an unknown byte_order')
+        columns = header['columns']
+        num_col = len(columns)
+        blocks = []
+        while offset < len(data):
+            num_row = int(numpy.frombuffer(data, dtype=order + 'u8', count=1, offset=offset)[0])
+            offset += 8
+            block = numpy.frombuffer(data, dtype=order + 'f8', count=num_col * num_row, offset=offset)
+            blocks.append(block.reshape(num_col, num_row))
+            offset += block.nbytes
+        if blocks:
+            values = numpy.concatenate(blocks, axis=1)
+        else:
+            values = numpy.empty((num_col, 0))
+        result = OrderedDict()
+        for col, col_values in zip(columns, values):
+            result[col['name']] = Trace._format_binary_column(col['format'], col_values)
+        return header, pandas.DataFrame(result)
+
+    @staticmethod
+    def _format_binary_column(format_name, values):
+        """Converts a column of a binary trace to the type that reading
+        the same column from a CSV trace would produce.
+        """
+        if format_name == 'hex':
+            return ['NAN' if numpy.isnan(vv) else '0x{:08x}'.format(int(vv)) for vv in values]
+        if format_name == 'raw64':
+            return ['0x{:016x}'.format(int(vv)) for vv in values.view(values.dtype.byteorder + 'u8')]
+        if format_name == 'integer' and not numpy.isnan(values).any():
+            return values.astype('int64')
+        return values.astype('float64')
+
     def get_df(self):
         return self._df
 
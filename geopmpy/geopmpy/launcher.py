@@ -131,6 +131,7 @@ class Config(object):
         parser.add_argument('--geopm-trace-signals', dest='trace_signals', type=str)
         parser.add_argument('--geopm-trace-profile', dest='trace_profile', type=str)
         parser.add_argument('--geopm-trace-endpoint-policy', dest='trace_endpoint_policy', type=str)
+        parser.add_argument('--geopm-trace-format', dest='trace_format', type=str)
         parser.add_argument('--geopm-profile', dest='profile', type=str)
         parser.add_argument('--geopm-ctl', dest='ctl', type=str, default='application')
         parser.add_argument('--geopm-agent', dest='agent', type=str)
@@ -150,6 +151,8 @@ class Config(object):
         parser.add_argument('--geopm-launch-script', dest='launch_script', type=str)
         parser.add_argument('--geopm-init-control', dest='init_control', type=str)
         parser.add_argument('--geopm-period', dest='period', type=str)
+        parser.add_argument('--geopm-wait-strategy', dest='wait_strategy', type=str)
+        parser.add_argument('--geopm-tree-comm-lock', dest='tree_comm_lock', type=str)
         parser.add_argument('--geopm-program-filter', dest='program_filter', type=str, required=True)
         parser.add_argument('--geopm-ctl-local', dest='ctl_local', action='store_true', default=False)
         opts, self.argv_unparsed = parser.parse_known_args(argv)
@@ -183,6 +186,9 @@ class Config(object):
         self.launch_script = opts.launch_script
         self.init_control = opts.init_control
         self.period = opts.period
+        self.wait_strategy = opts.wait_strategy
+        self.tree_comm_lock = opts.tree_comm_lock
+        self.trace_format = opts.trace_format
         self.program_filter = opts.program_filter
         self.ctl_local = opts.ctl_local
 
@@ -231,6 +237,8 @@ class Config(object):
             result['GEOPM_TRACE_PROFILE'] = self.trace_profile
         if self.trace_endpoint_policy:
             result['GEOPM_TRACE_ENDPOINT_POLICY'] = self.trace_endpoint_policy
+        if self.trace_format:
+            result['GEOPM_TRACE_FORMAT'] = self.trace_format
         if self.trace_signals:
             result['GEOPM_TRACE_SIGNALS'] = self.trace_signals
         if self.report_signals:
@@ -251,6 +259,10 @@ class Config(object):
             result['GEOPM_INIT_CONTROL'] = self.init_control
         if self.period:
             result['GEOPM_PERIOD'] = self.period
+        if self.wait_strategy:
+            result['GEOPM_WAIT_STRATEGY'] = self.wait_strategy
+        if self.tree_comm_lock:
+            result['GEOPM_TREE_COMM_LOCK'] = self.tree_comm_lock
         if self.program_filter:
             result['GEOPM_PROGRAM_FILTER'] = self.program_filter
         if self.ctl_local:
@@ -1765,6 +1777,9 @@ GEOPM_OPTIONS:
       --geopm-trace-endpoint-policy=path
                                create geopm endpoint policy trace files with
                                base name "path"
+      --geopm-trace-format=format
+                               write traces as "csv" text (default) or as
+                               "binary" columns
       --geopm-trace-signals=signals
                                comma-separated list of signals to add as columns
                                in the trace
@@ -1800,6 +1815,12 @@ GEOPM_OPTIONS:
       --geopm-init-control=path
                                set initial control values with data read from "path"
       --geopm-period=sec       control loop period override for Agent value
+      --geopm-wait-strategy=name
+                               control loop wait algorithm: "sleep" (default),
+                               "hybrid", "timerfd" or "adaptive"
+      --geopm-tree-comm-lock=name
+                               tree window synchronization: "lock" (default)
+                               or "lock_all"
       --geopm-preload          use LD_PRELOAD to load libgeopm with the target application
       --geopm-program-filter=names
                                only enable profiling for processes with program invocation
@@ -9,10 +9,12 @@ import unittest
 import os
 import tempfile
 import shutil
+import json
 from unittest import mock
 from collections import Counter
 from contextlib import contextmanager
 
+import numpy
 import geopmpy.io
 
 
@@ -1230,6 +1232,67 @@ class TestIO(unittest.TestCase):
         self.assertAlmostEqual(0.268616921, trace_df.iloc[-1]['TIME'])
         self.assertAlmostEqual(242610.5656738281, trace_df.iloc[-1]['CPU_ENERGY'])
 
+    def test_trace_binary(self):
+        """ Test that a binary trace file is loaded to the same dataframe
+        as the equivalent CSV trace.
+        """
+        header = {'geopm_version': '3.0.0',
+                  'start_time': 'Thu Oct 03 08:19:34 2019',
+                  'profile_name': 'test',
+                  'node_name': 'mcfly1',
+                  'agent': 'monitor',
+                  'byte_order': 'little',
+                  'columns': [{'name': 'TIME', 'format': 'double'},
+                              {'name': 'REGION_HASH', 'format': 'hex'},
+                              {'name': 'EPOCH_COUNT', 'format': 'integer'}]}
+        header_str = json.dumps(header).encode()
+        header_str += b' ' * (-len(header_str) % 8)
+        blocks = [numpy.array([[0.25, 0.5], [0x725e8066, 0x725e8066], [0, 1]]),
+                  numpy.array([[0.75], [0x9803a79a], [2]])]
+        binary_path = os.path.join(self._test_directory, 'geopmpy-io-test-trace-binary')
+        with open(binary_path, 'wb') as fid:
+            fid.write(b'GEOPMBIN')
+            fid.write(numpy.array([len(header_str)], dtype='<u8').tobytes())
+            fid.write(header_str)
+            for block in blocks:
+                fid.write(numpy.array([block.shape[1]], dtype='<u8').tobytes())
+                fid.write(block.astype('<f8').tobytes())
+        trace = geopmpy.io.Trace(binary_path)
+        self.assertEqual('mcfly1', trace.get_node_name())
+        self.assertEqual('monitor', trace.get_agent())
+        self.assertEqual('Thu Oct 03 08:19:34 2019', trace.get_start_time())
+        trace_df = trace.get_df()
+        self.assertEqual(['TIME', 'REGION_HASH', 'EPOCH_COUNT'], list(trace_df.columns))
+        self.assertEqual([0.25, 0.5, 0.75], list(trace_df['TIME']))
+        self.assertEqual(['0x725e8066', '0x725e8066', '0x9803a79a'], list(trace_df['REGION_HASH']))
+        self.assertEqual([0, 1, 2], list(trace_df['EPOCH_COUNT']))
+
+    def test_trace_binary_big_endian(self):
+        """ Test that the values of a binary trace are read in the byte
+        order recorded in the header.
+        """
+        header = {'geopm_version': '3.0.0',
+                  'start_time': 'Thu Oct 03 08:19:34 2019',
+                  'profile_name': 'test',
+                  'node_name': 'mcfly1',
+                  'agent': 'monitor',
+                  'byte_order': 'big',
+                  'columns': [{'name': 'TIME', 'format': 'double'},
+                              {'name': 'EPOCH_COUNT', 'format': 'integer'}]}
+        header_str = json.dumps(header).encode()
+        header_str += b' ' * (-len(header_str) % 8)
+        block = numpy.array([[0.25, 0.5], [0, 1]])
+        binary_path = os.path.join(self._test_directory, 'geopmpy-io-test-trace-binary-big')
+        with open(binary_path, 'wb') as fid:
+            fid.write(b'GEOPMBIN')
+            fid.write(numpy.array([len(header_str)], dtype='<u8').tobytes())
+            fid.write(header_str)
+            fid.write(numpy.array([block.shape[1]], dtype='>u8').tobytes())
+            fid.write(block.astype('>f8').tobytes())
+        trace_df = geopmpy.io.Trace(binary_path).get_df()
+        self.assertEqual([0.25, 0.5], list(trace_df['TIME']))
+        self.assertEqual([0, 1], list(trace_df['EPOCH_COUNT']))
+
     def test_figure_of_merit(self):
         fom_report_path = os.path.join(os.path.dirname(__file__), 'test_io_experiment.report')
 
@@ -39,6 +39,7 @@ namespace geopm
             virtual std::string policy(void) const = 0;
             virtual std::string endpoint(void) const = 0;
             virtual std::string trace(void) const = 0;
+            virtual std::string trace_format(void) const = 0;
             virtual std::string trace_profile(void) const = 0;
             virtual std::string trace_endpoint_policy(void) const = 0;
             virtual std::string profile(void) const = 0;
@@ -47,6 +48,7 @@ namespace geopm
             virtual std::string trace_signals(void) const = 0;
             virtual std::string report_signals(void) const = 0;
             virtual int max_fan_out(void) const = 0;
+            virtual std::string tree_comm_lock(void) const = 0;
             virtual int pmpi_ctl(void) const = 0;
             virtual bool do_policy(void) const = 0;
             virtual bool do_endpoint(void) const = 0;
@@ -66,6 +68,7 @@ namespace geopm
             virtual int debug_attach_process(void) const = 0;
             virtual std::string init_control(void) const = 0;
             virtual double period(double default_period) const = 0;
+            virtual std::string wait_strategy(void) const = 0;
             virtual int num_proc(void) const = 0;
             virtual bool do_ctl_local(void) const = 0;
             static std::map<std::string, std::string> parse_environment_file(const std::string &env_file_path);
@@ -83,6 +86,7 @@ namespace geopm
             std::string policy(void) const override;
             std::string endpoint(void) const override;
             std::string trace(void) const override;
+            std::string trace_format(void) const override;
             std::string trace_profile(void) const override;
             std::string trace_endpoint_policy(void) const override;
             std::string profile(void) const override;
@@ -91,6 +95,7 @@ namespace geopm
             std::string trace_signals(void) const override;
             std::string report_signals(void) const override;
             int max_fan_out(void) const override;
+            std::string tree_comm_lock(void) const override;
             int pmpi_ctl(void) const override;
             bool do_policy(void) const override;
             bool do_endpoint(void) const override;
@@ -115,6 +120,7 @@ namespace geopm
             int debug_attach_process(void) const override;
             std::string init_control(void) const override;
             double period(double default_period) const override;
+            std::string wait_strategy(void) const override;
             int num_proc(void) const override;
             bool do_ctl_local(void) const override;
         protected:
@@ -7,6 +7,7 @@
 #define WAITER_HPP_INCLUDE
 
 #include <memory>
+#include <string>
 #include "geopm_time.h"
 #include "geopm_public.h"
 
@@ -21,7 +22,8 @@ namespace geopm
             static std::unique_ptr<Waiter> make_unique(double period);
             /// @brief Create a Waiter
             /// @param [in] period Duration in seconds to wait
-            /// @param [in] strategy Wait algorithm ("sleep")
+            /// @param [in] strategy Wait algorithm: "sleep",
+            ///        "hybrid", "timerfd" or "adaptive"
             static std::unique_ptr<Waiter> make_unique(double period,
                                                        std::string strategy);
             Waiter() = default;
@@ -55,6 +57,84 @@ namespace geopm
             geopm_time_s m_time_target;
             bool m_is_first_time;
     };
+
+    /// @brief Class to support a periodic wait loop that sleeps with
+    ///        clock_nanosleep() using CLOCK_MONOTONIC until shortly
+    ///        before the end of the period, and then spins on the
+    ///        clock until the period has elapsed.  This trades CPU
+    ///        time at the end of each period for less wake up
+    ///        jitter.
+    class GEOPM_PUBLIC HybridWaiter : public Waiter
+    {
+        public:
+            HybridWaiter(double period);
+            /// @param [in] period Duration in seconds to wait
+            /// @param [in] spin_margin Duration in seconds at the end
+            ///        of each period spent spinning rather than
+            ///        sleeping.
+            HybridWaiter(double period, double spin_margin);
+            virtual ~HybridWaiter() = default;
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+        private:
+            /// Default time spent spinning, larger than the default
+            /// timer slack of a Linux thread.
+            static constexpr double M_SPIN_MARGIN = 100e-6;
+            double m_period;
+            double m_spin_margin;
+            geopm_time_s m_time_target;
+            bool m_is_first_time;
+    };
+
+    /// @brief Class to support a periodic wait loop based on a
+    ///        timerfd using CLOCK_MONOTONIC.  The kernel re-arms the
+    ///        timer each period, so the period is kept without
+    ///        accumulating drift.  Unlike the other strategies,
+    ///        periods that have already expired when wait() is
+    ///        called are combined: wait() returns once rather than
+    ///        once for each missed period.
+    class GEOPM_PUBLIC TimerFdWaiter : public Waiter
+    {
+        public:
+            TimerFdWaiter(double period);
+            TimerFdWaiter(const TimerFdWaiter &other) = delete;
+            TimerFdWaiter &operator=(const TimerFdWaiter &other) = delete;
+            virtual ~TimerFdWaiter();
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+        private:
+            double m_period;
+            int m_timer_fd;
+            bool m_is_first_time;
+    };
+
+    /// @brief Class to support a periodic wait loop based on
+    ///        clock_nanosleep() using CLOCK_MONOTONIC that wakes up
+    ///        early by the lateness measured on previous wake ups.
+    ///        The estimate is a moving average, so wake ups are
+    ///        centered on the end of the period without spinning.
+    class GEOPM_PUBLIC AdaptiveWaiter : public Waiter
+    {
+        public:
+            AdaptiveWaiter(double period);
+            virtual ~AdaptiveWaiter() = default;
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+        private:
+            /// Weight of the latest measurement in the lateness
+            /// estimate.
+            static constexpr double M_LATENESS_GAIN = 0.125;
+            double m_period;
+            double m_lateness;
+            geopm_time_s m_time_target;
+            bool m_is_first_time;
+    };
 }
 
 #endif
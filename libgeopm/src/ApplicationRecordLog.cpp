@@ -5,9 +5,13 @@
 
 
 #include "ApplicationRecordLog.hpp"
+#include <algorithm>
+#include <iostream>
+#include <sched.h>
 #include <unistd.h>
 #include "Scheduler.hpp"
 #include "geopm/SharedMemory.hpp"
+#include "geopm/SharedMemoryScopedLock.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm_debug.hpp"
@@ -23,19 +27,34 @@ namespace geopm
         return geopm::make_unique<ApplicationRecordLogImp>(shmem);
     }
 
-    size_t ApplicationRecordLog::buffer_size(void)
+    size_t ApplicationRecordLog::buffer_size(int num_slot)
     {
-        return M_LAYOUT_SIZE;
+        // Without slots the header that follows the shared table is
+        // not used, which is the size created by older services.
+        size_t result = M_TABLE_SIZE;
+        if (num_slot > 0) {
+            result = M_LAYOUT_SIZE + (size_t)num_slot * M_SLOT_SIZE;
+        }
+        return result;
+    }
+
+    int ApplicationRecordLog::num_slot(size_t buffer_size)
+    {
+        int result = 0;
+        if (buffer_size > M_LAYOUT_SIZE) {
+            result = (buffer_size - M_LAYOUT_SIZE) / M_SLOT_SIZE;
+        }
+        return result;
     }
 
-    size_t ApplicationRecordLog::max_record(void)
+    size_t ApplicationRecordLog::max_record(size_t buffer_size)
     {
-        return M_MAX_RECORD;
+        return (num_slot(buffer_size) + 1) * M_MAX_RECORD;
     }
 
-    size_t ApplicationRecordLog::max_region(void)
+    size_t ApplicationRecordLog::max_region(size_t buffer_size)
     {
-        return M_MAX_REGION;
+        return (num_slot(buffer_size) + 1) * M_MAX_REGION;
     }
 
     ApplicationRecordLogImp::ApplicationRecordLogImp(std::shared_ptr<SharedMemory> shmem)
@@ -43,27 +62,200 @@ namespace geopm
     {
     }
 
+    // Identifies each ApplicationRecordLogImp object to the threads
+    // that write to it.
+    static std::atomic<uint64_t> g_next_log_id(1);
+
     ApplicationRecordLogImp::ApplicationRecordLogImp(std::shared_ptr<SharedMemory> shmem,
                                                      int process,
                                                      std::shared_ptr<Scheduler> scheduler)
         : m_process(process)
         , m_shmem(std::move(shmem))
+        , m_layout(nullptr)
+        , m_slot(nullptr)
+        , m_num_slot(num_slot(m_shmem->size()))
+        , m_log_id(g_next_log_id++)
+        , m_writer(m_num_slot + 1, {{}, GEOPM_REGION_HASH_INVALID, 0, 0})
         , m_epoch_count(0)
-        , m_entered_region_hash(GEOPM_REGION_HASH_INVALID)
+        , m_is_drop_reported(false)
         , m_scheduler(std::move(scheduler))
     {
-        if (m_shmem->size() < buffer_size()) {
+        if (m_shmem->size() < buffer_size(0)) {
             throw Exception("ApplicationRecordLog: Shared memory provided in constructor is too small",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        // The zero filled buffer is a valid empty layout
+        m_layout = (m_layout_s *)(m_shmem->pointer());
+        m_slot = (m_slot_s *)((char *)(m_shmem->pointer()) + sizeof(m_layout_s));
+    }
+
+    // Releases the slot claimed by a thread when the thread exits or
+    // moves on to another log.
+    class RecordLogSlotRelease
+    {
+        public:
+            RecordLogSlotRelease()
+                : m_is_claimed(nullptr)
+            {
+            }
+            ~RecordLogSlotRelease()
+            {
+                reset({}, nullptr);
+            }
+            void reset(std::weak_ptr<SharedMemory> shmem, std::atomic<uint32_t> *is_claimed)
+            {
+                // Skip the release if the buffer is already unmapped
+                auto mapped = m_shmem.lock();
+                if (mapped != nullptr && m_is_claimed != nullptr) {
+                    m_is_claimed->store(0, std::memory_order_release);
+                }
+                m_shmem = std::move(shmem);
+                m_is_claimed = is_claimed;
+            }
+        private:
+            std::weak_ptr<SharedMemory> m_shmem;
+            std::atomic<uint32_t> *m_is_claimed;
+    };
+
+    int ApplicationRecordLogImp::slot_idx(void)
+    {
+        thread_local uint64_t t_log_id = 0;
+        thread_local int t_slot_idx = -1;
+        thread_local RecordLogSlotRelease t_release;
+        if (t_log_id != m_log_id) {
+            // First event from this thread: claim a slot, or use the
+            // shared table if none are free.
+            t_slot_idx = claim_slot();
+            if (t_slot_idx != -1) {
+                t_release.reset(m_shmem, &(m_slot[t_slot_idx].is_claimed));
+            }
+            else {
+                t_release.reset({}, nullptr);
+            }
+            t_log_id = m_log_id;
+        }
+        return t_slot_idx;
+    }
+
+    int ApplicationRecordLogImp::claim_slot(void)
+    {
+        int result = -1;
+        for (int slot_idx = 0; result == -1 && slot_idx < m_num_slot; ++slot_idx) {
+            uint32_t is_claimed = 0;
+            if (m_slot[slot_idx].is_claimed.compare_exchange_strong(is_claimed, 1)) {
+                result = slot_idx;
+            }
+        }
+        if (result != -1) {
+            // Make the slot visible to dump() before it is written
+            uint32_t num_used = m_layout->num_slot_used.load();
+            while (num_used < (uint32_t)result + 1 &&
+                   !m_layout->num_slot_used.compare_exchange_weak(num_used, result + 1)) {
+                // num_used is updated by the failed exchange
+            }
+            // Records left by a previous owner remain valid, but its
+            // short region state does not apply to this thread.
+            m_writer[result] = {{}, GEOPM_REGION_HASH_INVALID, 0, 0};
+        }
+        return result;
+    }
+
+    ApplicationRecordLogImp::SlotWriter::SlotWriter(ApplicationRecordLogImp &log)
+        : m_log(log)
+        , m_lock(nullptr)
+        , m_is_locked(false)
+        , m_slot(nullptr)
+        , m_writer(nullptr)
+        , m_table(nullptr)
+    {
+        int slot_idx = log.slot_idx();
+        if (slot_idx == -1) {
+            m_writer = &(log.m_writer.back());
+            lock_shared();
+            return;
+        }
+        m_slot = log.m_slot + slot_idx;
+        m_writer = &(log.m_writer[slot_idx]);
+        uint64_t generation = m_slot->generation.load(std::memory_order_acquire);
+        m_slot->writer.store(generation + 1);
+        // If dump() advanced the generation before seeing the writer
+        // mark, write to the new table instead.
+        while (m_slot->generation.load() != generation) {
+            generation = m_slot->generation.load(std::memory_order_acquire);
+            m_slot->writer.store(generation + 1);
+        }
+        m_table = m_slot->table + generation % 2;
+        if (m_writer->generation != generation) {
+            log.check_reset(*m_writer, false);
+            m_writer->generation = generation;
+        }
+        uint32_t shared_generation = log.m_layout->shared.generation.load(std::memory_order_acquire);
+        if (m_writer->shared_generation != shared_generation) {
+            log.check_reset(*m_writer, true);
+            m_writer->shared_generation = shared_generation;
+        }
+    }
+
+    ApplicationRecordLogImp::SlotWriter::~SlotWriter()
+    {
+        if (m_slot != nullptr) {
+            m_slot->writer.store(0, std::memory_order_release);
+        }
+    }
+
+    void ApplicationRecordLogImp::SlotWriter::lock_shared(void)
+    {
+        if (m_is_locked) {
+            return;
+        }
+        m_lock = m_log.m_shmem->get_scoped_lock();
+        m_is_locked = true;
+        uint32_t shared_generation = m_log.m_layout->shared.generation.load();
+        if (m_writer->shared_generation != shared_generation) {
+            m_log.check_reset(*m_writer, true);
+            m_writer->shared_generation = shared_generation;
+        }
+    }
+
+    ApplicationRecordLogImp::m_table_s &ApplicationRecordLogImp::SlotWriter::table(bool is_shared)
+    {
+        if (is_shared) {
+            lock_shared();
+            return m_log.m_layout->shared;
+        }
+        return *m_table;
+    }
+
+    int ApplicationRecordLogImp::SlotWriter::append_record(const record_s &record, bool &is_shared)
+    {
+        is_shared = m_table == nullptr || m_table->num_record == M_MAX_RECORD;
+        m_table_s &table = this->table(is_shared);
+        int record_idx = table.num_record;
+        // Don't overrun the buffer
+        if (record_idx < M_MAX_RECORD) {
+            table.record_table[record_idx] = record;
+            ++(table.num_record);
+        }
+        else {
+            record_idx = -1;
+            if (!m_log.m_is_drop_reported.exchange(true)) {
+                std::cerr << "Warning: <geopm> ApplicationRecordLog: maximum number of records reached, "
+                          << "events are dropped until the next control interval" << std::endl;
+            }
+        }
+        return record_idx;
+    }
+
+    ApplicationRecordLogImp::m_writer_s &ApplicationRecordLogImp::SlotWriter::writer(void)
+    {
+        return *m_writer;
     }
 
     void ApplicationRecordLogImp::enter(uint64_t hash, const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
-        auto emplace_pair = m_hash_region_enter_map.emplace(
+        SlotWriter slot_writer(*this);
+        m_writer_s &writer = slot_writer.writer();
+        auto emplace_pair = writer.hash_region_enter_map.emplace(
             std::piecewise_construct,
             std::forward_as_tuple(hash),
             std::forward_as_tuple());
@@ -71,7 +263,6 @@ namespace geopm
         m_region_enter_s &region_enter = emplace_pair.first->second;
         region_enter.enter_time = time;
         if (is_new) {
-            region_enter.record_idx = layout.num_record;
             region_enter.region_idx = -1; // Not a short region yet
             region_enter.is_short = false;
             record_s enter_record = {
@@ -80,19 +271,28 @@ namespace geopm
                .event = EVENT_REGION_ENTRY,
                .signal = hash,
             };
-            append_record(layout, enter_record);
+            region_enter.record_idx = slot_writer.append_record(enter_record, region_enter.is_shared);
+            if (region_enter.record_idx == -1) {
+                // Dropped: the exit will be sent as a normal event
+                writer.hash_region_enter_map.erase(emplace_pair.first);
+            }
         }
-        m_entered_region_hash = hash;
+        writer.entered_region_hash = hash;
     }
 
     void ApplicationRecordLogImp::exit(uint64_t hash, const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
+        SlotWriter slot_writer(*this);
+        m_writer_s &writer = slot_writer.writer();
 
-        auto region_it = m_hash_region_enter_map.find(hash);
-        if (region_it == m_hash_region_enter_map.end()) {
+        auto region_it = writer.hash_region_enter_map.find(hash);
+        if (region_it != writer.hash_region_enter_map.end() &&
+            region_it->second.is_shared) {
+            // Locking may find that dump() cleared the shared table
+            slot_writer.lock_shared();
+            region_it = writer.hash_region_enter_map.find(hash);
+        }
+        if (region_it == writer.hash_region_enter_map.end()) {
             // No short region info; send a normal exit event
             record_s exit_record = {
                .time = time,
@@ -100,7 +300,8 @@ namespace geopm
                .event = EVENT_REGION_EXIT,
                .signal = hash,
             };
-            append_record(layout, exit_record);
+            bool is_shared = false;
+            slot_writer.append_record(exit_record, is_shared);
         }
         else {
             // This region was previous marked short or an entry
@@ -119,56 +320,58 @@ namespace geopm
                     .event = EVENT_REGION_ENTRY,
                     .signal = hash,
                 };
-                enter_info.record_idx = layout.num_record;
-                append_record(layout, enter_record);
+                enter_info.record_idx = slot_writer.append_record(enter_record, enter_info.is_shared);
+                if (enter_info.record_idx == -1) {
+                    writer.hash_region_enter_map.erase(region_it);
+                    writer.entered_region_hash = GEOPM_REGION_HASH_INVALID;
+                    return;
+                }
             }
-            GEOPM_DEBUG_ASSERT(enter_info.record_idx >= 0 && enter_info.record_idx < layout.num_record,
+            // The short region is stored with its entry record, so
+            // the region table cannot fill before the record table.
+            m_table_s &table = slot_writer.table(enter_info.is_shared);
+            GEOPM_DEBUG_ASSERT(enter_info.record_idx >= 0 && enter_info.record_idx < table.num_record,
                                "Invalid record index");
 
             // find or add the region in short regions array
             int region_idx = enter_info.region_idx;
             if (region_idx == -1) {
-                region_idx = layout.num_region;
+                region_idx = table.num_region;
                 enter_info.region_idx = region_idx;
-                ++(layout.num_region);
-                GEOPM_DEBUG_ASSERT(layout.num_region <= M_MAX_REGION,
+                ++(table.num_region);
+                GEOPM_DEBUG_ASSERT(table.num_region <= M_MAX_REGION,
                                    "ApplicationRecordLogImp::exit(): too many regions entered and exited within one control loop");
                 // Add a new short region
-                layout.region_table[region_idx] = {
+                table.region_table[region_idx] = {
                     .hash = hash,
                     .num_complete = 0,
                     .total_time = 0.0,
                 };
-                GEOPM_DEBUG_ASSERT(layout.record_table[enter_info.record_idx].event == EVENT_REGION_ENTRY,
+                GEOPM_DEBUG_ASSERT(table.record_table[enter_info.record_idx].event == EVENT_REGION_ENTRY,
                                    "ApplicationRegionLog::exit(): adding a new short region when existing was not an entry.");
                 // Convert the region entry event into a short region event
-                layout.record_table[enter_info.record_idx].event = EVENT_SHORT_REGION;
-                layout.record_table[enter_info.record_idx].signal = region_idx;
+                table.record_table[enter_info.record_idx].event = EVENT_SHORT_REGION;
+                table.record_table[enter_info.record_idx].signal = region_idx;
             }
-            GEOPM_DEBUG_ASSERT(region_idx >= 0 && region_idx < layout.num_region,
+            GEOPM_DEBUG_ASSERT(region_idx >= 0 && region_idx < table.num_region,
                                "Invalid region index");
             // Update the count and total time for the short region
-            auto &region = layout.region_table[region_idx];
+            auto &region = table.region_table[region_idx];
             ++(region.num_complete);
             region.total_time += geopm_time_diff(&(enter_info.enter_time), &time);
         }
-        m_entered_region_hash = GEOPM_REGION_HASH_INVALID;
+        writer.entered_region_hash = GEOPM_REGION_HASH_INVALID;
     }
 
     void ApplicationRecordLogImp::epoch(const geopm_time_s &time)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
-
-        ++m_epoch_count;
         record_s epoch_record = {
            .time = time,
            .process = m_process,
            .event = EVENT_EPOCH_COUNT,
-           .signal = m_epoch_count,
+           .signal = ++m_epoch_count,
         };
-        append_record(layout, epoch_record);
+        append_record(epoch_record);
     }
 
     void ApplicationRecordLogImp::cpuset_changed(const geopm_time_s &time)
@@ -184,23 +387,17 @@ namespace geopm
 
     void ApplicationRecordLogImp::affinity(const geopm_time_s &time, int cpu_idx)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         record_s affinity_record = {
            .time = time,
            .process = m_process,
            .event = EVENT_AFFINITY,
            .signal = (uint64_t)cpu_idx,
         };
-        append_record(layout, affinity_record);
+        append_record(affinity_record);
     }
 
     void ApplicationRecordLogImp::start_profile(const geopm_time_s &time, const std::string &profile_name)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t profile_hash = geopm_crc32_str(profile_name.c_str());
         record_s profile_start_record = {
            .time = time,
@@ -208,14 +405,11 @@ namespace geopm
            .event = EVENT_START_PROFILE,
            .signal = profile_hash,
         };
-        append_record(layout, profile_start_record);
+        append_record(profile_start_record);
     }
 
     void ApplicationRecordLogImp::stop_profile(const geopm_time_s &time, const std::string &profile_name)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t profile_hash = geopm_crc32_str(profile_name.c_str());
         record_s profile_stop_record = {
            .time = time,
@@ -223,14 +417,11 @@ namespace geopm
            .event = EVENT_STOP_PROFILE,
            .signal = profile_hash,
         };
-        append_record(layout, profile_stop_record);
+        append_record(profile_stop_record);
     }
 
     void ApplicationRecordLogImp::overhead(const geopm_time_s &time, double overhead_sec)
     {
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        check_reset(layout);
         uint64_t field = geopm_signal_to_field(overhead_sec);
         record_s overhead_record = {
            .time = time,
@@ -238,58 +429,103 @@ namespace geopm
            .event = EVENT_OVERHEAD,
            .signal = field,
         };
-        append_record(layout, overhead_record);
+        append_record(overhead_record);
     }
 
     void ApplicationRecordLogImp::dump(std::vector<record_s> &records,
                                        std::vector<short_region_s> &short_regions)
     {
-        // this function should not do anything with m_hash_region_enter_map
-        std::unique_ptr<SharedMemoryScopedLock> lock = m_shmem->get_scoped_lock();
-        m_layout_s &layout = *((m_layout_s *)(m_shmem->pointer()));
-        records.assign(layout.record_table, layout.record_table + layout.num_record);
-        short_regions.assign(layout.region_table, layout.region_table + layout.num_region);
-        layout.num_record = 0;
-        layout.num_region = 0;
+        // this function should not do anything with m_writer
+        records.clear();
+        short_regions.clear();
+        int num_slot = 0;
+        if (m_num_slot != 0) {
+            num_slot = m_layout->num_slot_used.load(std::memory_order_acquire);
+            if (num_slot > m_num_slot) {
+                num_slot = m_num_slot;
+            }
+        }
+        for (int slot_idx = 0; slot_idx < num_slot; ++slot_idx) {
+            m_slot_s &slot = m_slot[slot_idx];
+            uint64_t generation = slot.generation.load(std::memory_order_relaxed);
+            slot.generation.store(generation + 1);
+            // Wait for an event in progress on the swapped out table
+            while (slot.writer.load() == generation + 1) {
+                sched_yield();
+            }
+            dump_table(slot.table[generation % 2], records, short_regions);
+        }
+        {
+            // The shared table is read after the slots were swapped
+            // so that any record spilled before the swap is seen.
+            auto lock = m_shmem->get_scoped_lock();
+            dump_table(m_layout->shared, records, short_regions);
+            m_layout->shared.generation.fetch_add(1);
+        }
+        // Each table is in arrival order.  Tables of several threads,
+        // or of a slot passed from an exited thread to a new one,
+        // are ordered by time together.
+        auto time_comp = [](const record_s &aa, const record_s &bb) {
+            return geopm_time_comp(&aa.time, &bb.time);
+        };
+        if (!std::is_sorted(records.begin(), records.end(), time_comp)) {
+            std::stable_sort(records.begin(), records.end(), time_comp);
+        }
     }
 
-    void ApplicationRecordLogImp::check_reset(m_layout_s &layout)
+    void ApplicationRecordLogImp::dump_table(m_table_s &table,
+                                             std::vector<record_s> &records,
+                                             std::vector<short_region_s> &short_regions)
     {
-        if (layout.num_record == 0) {
-            // Other side has cleared the records.
-            // If currently in a short region, keep track of any short region data.
-            auto region_enter_it = m_hash_region_enter_map.find(m_entered_region_hash);
-            if (region_enter_it != m_hash_region_enter_map.end()) {
-                auto &entry_info = region_enter_it->second;
-                if (entry_info.is_short) {
-                    // the current region was previous marked as short;
-                    // maintain entry to convert a future exit
-                    entry_info.record_idx = -1;
-                    entry_info.region_idx = -1;
-                    m_hash_region_enter_map = {*region_enter_it};
-                }
-                else {
-                    // never marked as short region so an exit event will be sent
-                    m_hash_region_enter_map.clear();
+        size_t record_begin = records.size();
+        size_t region_offset = short_regions.size();
+        records.insert(records.end(), table.record_table,
+                       table.record_table + table.num_record);
+        short_regions.insert(short_regions.end(), table.region_table,
+                             table.region_table + table.num_region);
+        table.num_record = 0;
+        table.num_region = 0;
+        if (region_offset != 0) {
+            // Reindex the short regions of this table
+            for (auto record_it = records.begin() + record_begin;
+                 record_it != records.end(); ++record_it) {
+                if (record_it->event == EVENT_SHORT_REGION) {
+                    record_it->signal += region_offset;
                 }
             }
+        }
+    }
+
+    void ApplicationRecordLogImp::check_reset(m_writer_s &writer, bool is_shared_only)
+    {
+        // Other side has cleared the records of the slot, or of the
+        // shared table if is_shared_only.  If currently in a short
+        // region, keep track of any short region data.
+        auto &enter_map = writer.hash_region_enter_map;
+        for (auto region_enter_it = enter_map.begin(); region_enter_it != enter_map.end();) {
+            auto &entry_info = region_enter_it->second;
+            if (is_shared_only && !entry_info.is_shared) {
+                ++region_enter_it;
+            }
+            else if (region_enter_it->first == writer.entered_region_hash &&
+                     entry_info.is_short) {
+                // the current region was previous marked as short;
+                // maintain entry to convert a future exit
+                entry_info.record_idx = -1;
+                entry_info.region_idx = -1;
+                ++region_enter_it;
+            }
             else {
-                m_hash_region_enter_map.clear();
+                // never marked as short region so an exit event will be sent
+                region_enter_it = enter_map.erase(region_enter_it);
             }
         }
     }
 
-    void ApplicationRecordLogImp::append_record(m_layout_s &layout, const record_s &record)
+    void ApplicationRecordLogImp::append_record(const record_s &record)
     {
-        int record_idx = layout.num_record;
-        // Don't overrun the buffer
-        if (record_idx < M_MAX_RECORD) {
-            layout.record_table[record_idx] = record;
-            ++(layout.num_record);
-        }
-        else {
-            throw Exception("ApplicationRecordLog: maximum number of records reached.",
-                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-        }
+        SlotWriter slot_writer(*this);
+        bool is_shared = false;
+        slot_writer.append_record(record, is_shared);
     }
 }
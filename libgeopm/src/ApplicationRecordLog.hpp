@@ -6,6 +6,7 @@
 #ifndef APPLICATIONRECORDLOG_HPP_INCLUDE
 #define APPLICATIONRECORDLOG_HPP_INCLUDE
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include <map>
@@ -13,6 +14,7 @@
 #include <memory>
 
 #include "geopm_time.h"
+#include "geopm/Helper.hpp"
 #include "record.hpp"
 
 namespace geopm
@@ -53,12 +55,28 @@ namespace geopm
     /// number of calls to the hashed region and the total amount of
     /// time in the region, but the exact sequence and timing of
     /// events following the first enter() is not recorded.
+    ///
+    /// The shared memory buffer begins with a shared table of
+    /// records and short regions that is protected by the
+    /// SharedMemory lock, followed by a number of per-thread slots
+    /// that is determined by the size of the buffer.  Each thread
+    /// that creates events claims a free slot, so application threads
+    /// do not contend for a lock, and the slot is released when the
+    /// thread exits.  A slot holds two tables: the thread writes into
+    /// one while the other is read by dump().  The call to dump()
+    /// swaps the tables of each slot and waits for any event that is
+    /// being written into the swapped out table to complete.  Short
+    /// region compression is done per thread.  Threads that find no
+    /// free slot, and threads that fill the table of their slot
+    /// within one control interval, write into the shared table
+    /// under the lock.  Records that do not fit into the shared
+    /// table are dropped with a warning.
     class ApplicationRecordLog
     {
         public:
             /// @brief Factory constructor
             /// @param [in] shmem Shared memory object of at least the
-            ///        size returned by buffer_size().
+            ///        size returned by buffer_size(0).
             static std::unique_ptr<ApplicationRecordLog> make_unique(std::shared_ptr<SharedMemory> shmem);
             /// @brief Destructor for pure virtual base class.
             virtual ~ApplicationRecordLog() = default;
@@ -113,12 +131,13 @@ namespace geopm
             /// removes all of the records and short region data from
             /// the table.
             ///
+            /// The records from all threads are sorted in time order.
             /// For optimal performance the user should reserve space
             /// in the output vectors using the max_record() and
             /// max_region() static methods:
             ///
-            ///     records.reserve(ApplicationRecordLog::max_record());
-            ///     short_regions.reserve(ApplicationRecordLog::max_region());
+            ///     records.reserve(ApplicationRecordLog::max_record(shmem->size()));
+            ///     short_regions.reserve(ApplicationRecordLog::max_region(shmem->size()));
             ///
             /// Note that the "signal" in any sort region events in
             /// the records output vector is the index into the
@@ -144,29 +163,53 @@ namespace geopm
             ///
             /// This method returns the value to use when sizing the
             /// SharedMemory object used to construct the
-            /// ApplicationRecordLog.
+            /// ApplicationRecordLog.  The same computation is done
+            /// by geopmdpy/system_files.py when creating the buffer.
+            ///
+            /// @param [in] num_slot Number of threads that can write
+            ///        events without taking the lock, typically the
+            ///        number of CPUs in the affinity mask of the
+            ///        profiled process.  A buffer sized for zero slots
+            ///        holds only the shared table and is the minimum
+            ///        accepted.
             ///
             /// @return Size requirement for SharedMemory object.
-            static size_t buffer_size(void);
+            static size_t buffer_size(int num_slot);
+            /// @brief Gets the number of per-thread slots in a buffer.
+            ///
+            /// @param [in] buffer_size Size of the SharedMemory
+            ///        object.
+            ///
+            /// @return Number of slots that fit in the buffer.
+            static int num_slot(size_t buffer_size);
             /// @brief Gets the maximum number of records.
             ///
             /// This method returns the value to use when reserving
             /// elements in the records vector passed to dump().
             ///
-            /// @return The maximum length of the records vector after
-            ///         a call to dump().
-            static size_t max_record(void);
+            /// @param [in] buffer_size Size of the SharedMemory
+            ///        object.
+            ///
+            /// @return The maximum number of records returned by one
+            ///         call to dump().
+            static size_t max_record(size_t buffer_size);
             /// @brief Gets the maximum number of short region events.
             ///
             /// This method returns the value to use when reserving
             /// elements in the short_regions vector passed to dump().
             ///
-            /// @return The maximum length of the short_regions vector
-            ///         after a call to dump().
-            static size_t max_region(void);
+            /// @param [in] buffer_size Size of the SharedMemory
+            ///        object.
+            ///
+            /// @return The maximum number of short regions returned
+            ///         by one call to dump().
+            static size_t max_region(size_t buffer_size);
         protected:
             ApplicationRecordLog() = default;
-            static constexpr size_t M_LAYOUT_SIZE = 57384;
+            // Sizes mirrored by geopmdpy/system_files.py
+            static constexpr size_t M_TABLE_SIZE = 57384;
+            static constexpr size_t M_LAYOUT_SIZE = 57472;
+            static constexpr size_t M_SLOT_SIZE = 115008;
             static constexpr int M_MAX_RECORD = 1024;
             static constexpr int M_MAX_REGION = M_MAX_RECORD + 1;
     };
@@ -189,28 +232,113 @@ namespace geopm
             void stop_profile(const geopm_time_s &time, const std::string &profile_name) override;
             void overhead(const geopm_time_s &time, double overhead_sec) override;
         private:
-            struct m_layout_s {
+            struct m_table_s {
                 int32_t num_record;
+                // Advanced by dump() each time the shared table is
+                // cleared, unused in slot tables.
+                std::atomic<uint32_t> generation;
                 record_s record_table[M_MAX_RECORD];
                 int32_t num_region;
                 short_region_s region_table[M_MAX_REGION];
             };
-            static_assert(sizeof(m_layout_s) <= M_LAYOUT_SIZE,
-                          "Layout size used in geopmdpy/system_files.py to create shared memory footprint is smaller than required by C++ code");
+            // Each of the atomics is on its own cache line
+            struct m_slot_s {
+                // Advanced by dump(); the table being written is
+                // table[generation % 2].
+                std::atomic<uint64_t> generation;
+                char generation_padding[56];
+                // One more than the generation of the table that a
+                // thread is writing, or zero if none.
+                std::atomic<uint64_t> writer;
+                char writer_padding[56];
+                // Non-zero while a thread owns the slot
+                std::atomic<uint32_t> is_claimed;
+                char is_claimed_padding[60];
+                m_table_s table[2];
+                char table_padding[48];
+            };
+            // Followed in the buffer by the array of slots
+            struct m_layout_s {
+                // The layout of a buffer with no slots
+                m_table_s shared;
+                char shared_padding[24];
+                // One more than the largest index of a slot that has
+                // been claimed
+                std::atomic<uint32_t> num_slot_used;
+                char num_slot_used_padding[60];
+            };
+            static_assert(sizeof(m_slot_s) % geopm::hardware_destructive_interference_size == 0,
+                          "m_slot_s not aligned to cache lines");
+            static_assert(sizeof(m_layout_s) % geopm::hardware_destructive_interference_size == 0,
+                          "m_layout_s not aligned to cache lines");
+            static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                          std::atomic<uint32_t>::is_always_lock_free,
+                          "Atomics in shared memory must be lock free");
+            static_assert(sizeof(m_table_s) == M_TABLE_SIZE &&
+                          sizeof(m_layout_s) == M_LAYOUT_SIZE &&
+                          sizeof(m_slot_s) == M_SLOT_SIZE,
+                          "Layout sizes used in geopmdpy/system_files.py to create shared memory footprint do not match C++ code");
 
             struct m_region_enter_s {
                 int record_idx;
                 int region_idx;
                 geopm_time_s enter_time;
                 bool is_short;
+                // Entry record is in the shared table
+                bool is_shared;
+            };
+            // State of the thread(s) writing to one slot, or to the
+            // shared table only
+            struct m_writer_s {
+                std::map<uint64_t, m_region_enter_s> hash_region_enter_map;
+                uint64_t entered_region_hash;
+                uint64_t generation;
+                uint32_t shared_generation;
+            };
+            // Claims the slot of the calling thread for one event.
+            // The lifetime of the object spans the update to the
+            // tables so that dump() can wait for it to complete.
+            class SlotWriter
+            {
+                public:
+                    SlotWriter(ApplicationRecordLogImp &log);
+                    ~SlotWriter();
+                    SlotWriter(const SlotWriter &other) = delete;
+                    SlotWriter &operator=(const SlotWriter &other) = delete;
+                    m_writer_s &writer(void);
+                    // Table of the slot, or the shared table
+                    m_table_s &table(bool is_shared);
+                    // Takes the lock for the shared table and resets
+                    // the writer state if dump() cleared it.
+                    void lock_shared(void);
+                    // Returns the index of the record, or -1 if it
+                    // was dropped.
+                    int append_record(const record_s &record, bool &is_shared);
+                private:
+                    ApplicationRecordLogImp &m_log;
+                    std::unique_ptr<SharedMemoryScopedLock> m_lock;
+                    bool m_is_locked;
+                    m_slot_s *m_slot;
+                    m_writer_s *m_writer;
+                    m_table_s *m_table;
             };
-            void check_reset(m_layout_s &layout);
-            void append_record(m_layout_s &layout, const record_s &record);
+            int slot_idx(void);
+            int claim_slot(void);
+            void check_reset(m_writer_s &writer, bool is_shared_only);
+            void append_record(const record_s &record);
+            void dump_table(m_table_s &table,
+                            std::vector<record_s> &records,
+                            std::vector<short_region_s> &short_regions);
             int m_process;
             std::shared_ptr<SharedMemory> m_shmem;
-            std::map<uint64_t, m_region_enter_s> m_hash_region_enter_map;
-            uint64_t m_epoch_count;
-            uint64_t m_entered_region_hash;
+            m_layout_s *m_layout;
+            m_slot_s *m_slot;
+            const int m_num_slot;
+            const uint64_t m_log_id;
+            // One per slot followed by one for threads without a slot
+            std::vector<m_writer_s> m_writer;
+            std::atomic<uint64_t> m_epoch_count;
+            std::atomic<bool> m_is_drop_reported;
             std::shared_ptr<Scheduler> m_scheduler;
     };
 }
@@ -346,7 +346,8 @@ namespace geopm
             std::string shmem_path = shmem_path_prof("record-log", pid, geteuid());
             std::shared_ptr<SharedMemory> record_log_shmem =
                 SharedMemory::make_unique_user(shmem_path, 0);
-            if (record_log_shmem->size() < ApplicationRecordLog::buffer_size()) {
+            size_t buffer_size = record_log_shmem->size();
+            if (buffer_size < ApplicationRecordLog::buffer_size(0)) {
                 throw Exception("ApplicationSamplerImp::connect(): "
                                 "Record log shared memory buffer is incorrectly sized",
                                 GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -358,8 +359,8 @@ namespace geopm
             }
             process.record_log_shmem = record_log_shmem;
             process.record_log = ApplicationRecordLog::make_unique(std::move(record_log_shmem));
-            process.records.reserve(ApplicationRecordLog::max_record());
-            process.short_regions.reserve(ApplicationRecordLog::max_region());
+            process.records.reserve(ApplicationRecordLog::max_record(buffer_size));
+            process.short_regions.reserve(ApplicationRecordLog::max_region(buffer_size));
         }
         return result;
     }
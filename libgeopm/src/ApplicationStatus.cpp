@@ -44,8 +44,29 @@ namespace geopm
         // Note: no lock; all members of the struct are 32-bits and will be
         // accessed atomically by hardware.
         m_buffer = (m_app_status_s *)m_shmem->pointer();
-        m_cache.resize(m_shmem->size());
-        update_cache();
+        m_cache.resize(m_num_cpu);
+        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+            copy_status(cpu_idx, m_buffer[cpu_idx].version.load(std::memory_order_acquire));
+        }
+    }
+
+    void ApplicationStatusImp::publish(int cpu_idx)
+    {
+        // Release the field updates to a reader that observes the
+        // new version in update_cache().
+        m_buffer[cpu_idx].version.fetch_add(1, std::memory_order_release);
+    }
+
+    void ApplicationStatusImp::copy_status(int cpu_idx, uint32_t version)
+    {
+        const m_app_status_s &status = m_buffer[cpu_idx];
+        m_cache[cpu_idx] = {
+            .hint = status.hint,
+            .hash = status.hash,
+            .total_work = status.total_work,
+            .completed_work = status.completed_work,
+            .version = version,
+        };
     }
 
     void ApplicationStatusImp::set_hint(int cpu_idx, uint64_t hint)
@@ -58,6 +79,7 @@ namespace geopm
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
         // pack hint into 32 bits for atomic write
         m_buffer[cpu_idx].hint = (uint32_t)hint;
+        publish(cpu_idx);
     }
 
     uint64_t ApplicationStatusImp::get_hint(int cpu_idx) const
@@ -66,7 +88,7 @@ namespace geopm
             throw Exception("ApplicationStatusImp::get_hint(): invalid CPU index: " + std::to_string(cpu_idx),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        GEOPM_DEBUG_ASSERT(m_cache.size() == (size_t)m_num_cpu,
                            "Memory for m_cache not sized correctly");
         uint64_t result = (uint64_t)m_cache[cpu_idx].hint;
         geopm::check_hint(result);
@@ -87,6 +109,7 @@ namespace geopm
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
         m_buffer[cpu_idx].hash = (uint32_t)hash;
         m_buffer[cpu_idx].hint = (uint32_t)hint;
+        publish(cpu_idx);
     }
 
     uint64_t ApplicationStatusImp::get_hash(int cpu_idx) const
@@ -95,7 +118,7 @@ namespace geopm
             throw Exception("ApplicationStatusImp::get_hash(): invalid CPU index: " + std::to_string(cpu_idx),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        GEOPM_DEBUG_ASSERT(m_cache.size() == (size_t)m_num_cpu,
                            "Memory for m_cache not sized correctly");
         return m_cache[cpu_idx].hash;
     }
@@ -109,6 +132,7 @@ namespace geopm
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
         m_buffer[cpu_idx].total_work = 0;
         m_buffer[cpu_idx].completed_work = 0;
+        publish(cpu_idx);
     }
 
     void ApplicationStatusImp::set_total_work_units(int cpu_idx, int work_units)
@@ -125,6 +149,7 @@ namespace geopm
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
         // total_work non-zero gates per thread use of completed_work
         m_buffer[cpu_idx].total_work = work_units;
+        publish(cpu_idx);
     }
 
     void ApplicationStatusImp::increment_work_unit(int cpu_idx)
@@ -137,6 +162,7 @@ namespace geopm
 
         if (m_buffer[cpu_idx].total_work != 0) {
             ++(m_buffer[cpu_idx].completed_work);
+            publish(cpu_idx);
         }
     }
 
@@ -146,7 +172,7 @@ namespace geopm
             throw Exception("ApplicationStatusImp::get_progress_cpu(): invalid CPU index: " + std::to_string(cpu_idx),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        GEOPM_DEBUG_ASSERT(m_cache.size() == (size_t)m_num_cpu,
                            "Memory for m_cache not sized correctly");
         double result = NAN;
         int total_work = m_cache[cpu_idx].total_work;
@@ -159,8 +185,13 @@ namespace geopm
     void ApplicationStatusImp::update_cache(void)
     {
         GEOPM_DEBUG_ASSERT(m_buffer != nullptr, "m_buffer not set");
-        GEOPM_DEBUG_ASSERT(m_cache.size() == buffer_size(m_num_cpu),
+        GEOPM_DEBUG_ASSERT(m_cache.size() == (size_t)m_num_cpu,
                            "Memory for m_cache not sized correctly");
-        std::copy(m_buffer, m_buffer + m_num_cpu, m_cache.begin());
+        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+            uint32_t version = m_buffer[cpu_idx].version.load(std::memory_order_acquire);
+            if (version != m_cache[cpu_idx].version) {
+                copy_status(cpu_idx, version);
+            }
+        }
     }
 }
@@ -6,6 +6,7 @@
 #ifndef APPLICATIONSTATUS_HPP_INCLUDE
 #define APPLICATIONSTATUS_HPP_INCLUDE
 
+#include <atomic>
 #include <cstdint>
 
 #include <memory>
@@ -64,6 +65,8 @@ namespace geopm
             /// @brief Updates the local memory with the latest values from
             ///        the shared memory.  Any calls to get methods will use
             ///        these values until the cache is updated again.
+            ///        Only the CPUs whose status changed since the
+            ///        previous update are copied.
             virtual void update_cache(void) = 0;
 
             /// @brief Create an ApplicationStatus object using the
@@ -111,17 +114,32 @@ namespace geopm
                 uint32_t hash;
                 uint32_t total_work;
                 uint32_t completed_work;
-                char padding[44];
+                // Incremented after every update to the other fields
+                std::atomic<uint32_t> version;
+                char padding[40];
             };
             static_assert((sizeof(ApplicationStatusImp::m_app_status_s) % geopm::hardware_destructive_interference_size) == 0,
                           "m_app_status_s not aligned to cache lines");
             static_assert(sizeof(ApplicationStatusImp::m_app_status_s) == ApplicationStatus::M_STATUS_SIZE,
                           "M_STATUS_SIZE does not match size of m_app_status_s");
+            static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                          "Atomics in shared memory must be lock free");
+            // Copy of the status of one CPU in local memory
+            struct m_cache_s
+            {
+                uint32_t hint;
+                uint32_t hash;
+                uint32_t total_work;
+                uint32_t completed_work;
+                uint32_t version;
+            };
+            void publish(int cpu_idx);
+            void copy_status(int cpu_idx, uint32_t version);
 
             int m_num_cpu;
             std::shared_ptr<SharedMemory> m_shmem;
             m_app_status_s *m_buffer;
-            std::vector<m_app_status_s> m_cache;
+            std::vector<m_cache_s> m_cache;
     };
 }
 
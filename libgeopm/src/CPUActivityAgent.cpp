@@ -29,7 +29,8 @@ namespace geopm
 {
     CPUActivityAgent::CPUActivityAgent()
         : CPUActivityAgent(platform_io(), platform_topo(), FrequencyGovernor::make_shared(),
-                           Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                           Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                               environment().wait_strategy()))
     {
 
     }
@@ -4,6 +4,9 @@
  */
 
 #include <cinttypes>
+#include <cstring>
+#include <algorithm>
+#include <set>
 
 #include "geopm_version.h"
 #include "geopm_hash.h"
@@ -11,9 +14,26 @@
 #include "CSV.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/Environment.hpp"
+#include "geopm/json11.hpp"
 
 namespace geopm
 {
+    std::unique_ptr<CSV> CSV::make_unique(const std::string &file_path,
+                                          const std::string &host_name,
+                                          const std::string &start_time,
+                                          size_t buffer_size,
+                                          const std::string &file_format)
+    {
+        if (file_format == "csv") {
+            return geopm::make_unique<CSVImp>(file_path, host_name, start_time, buffer_size);
+        }
+        else if (file_format == "binary") {
+            return geopm::make_unique<BinaryCSVImp>(file_path, host_name, start_time, buffer_size);
+        }
+        throw Exception("CSV::make_unique(): unknown file format: " + file_format,
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
     CSVImp::CSVImp(const std::string &file_path,
                    const std::string &host_name,
                    const std::string &start_time,
@@ -136,4 +156,301 @@ namespace geopm
         }
         m_buffer << '\n';
     }
+
+    BinaryCSVImp::BinaryCSVImp(const std::string &file_path,
+                               const std::string &host_name,
+                               const std::string &start_time,
+                               size_t buffer_size)
+        : m_file_path(file_path)
+        , m_host_name(host_name)
+        , m_start_time(start_time)
+        , m_buffer_limit(buffer_size / sizeof(double))
+        , m_is_active(false)
+    {
+        if (host_name.size()) {
+            m_file_path += "-" + host_name;
+        }
+        m_stream.open(m_file_path, std::ios::binary);
+        if (!m_stream.good()) {
+            throw Exception("Unable to open binary trace file '" + m_file_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    BinaryCSVImp::~BinaryCSVImp()
+    {
+        if (m_is_active) {
+            flush();
+        }
+    }
+
+    void BinaryCSVImp::add_column(const std::string &name)
+    {
+        add_column(name, "double");
+    }
+
+    void BinaryCSVImp::add_column(const std::string &name, const std::string &format)
+    {
+        if (m_is_active) {
+            throw Exception("BinaryCSVImp::add_column() cannot be called after activate()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        static const std::set<std::string> format_names = {
+            "double", "float", "integer", "hex", "raw64"
+        };
+        if (format_names.find(format) == format_names.end()) {
+            throw Exception("BinaryCSVImp::add_column(), format is unknown: " + format,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_column_name.push_back(name);
+        m_column_format.push_back(format);
+    }
+
+    void BinaryCSVImp::add_column(const std::string &name, std::function<std::string(double)> format)
+    {
+        // Record the name of the format as a hint for the reader,
+        // custom format functions are stored as "double".
+        static const std::map<decltype(&string_format_double), std::string> format_name = {
+            {string_format_double, "double"},
+            {string_format_float, "float"},
+            {string_format_integer, "integer"},
+            {string_format_hex, "hex"},
+            {string_format_raw64, "raw64"},
+        };
+        std::string format_str = "double";
+        auto target = format.target<decltype(&string_format_double)>();
+        if (target != nullptr) {
+            auto it = format_name.find(*target);
+            if (it != format_name.end()) {
+                format_str = it->second;
+            }
+        }
+        add_column(name, format_str);
+    }
+
+    void BinaryCSVImp::activate(void)
+    {
+        if (m_is_active == false) {
+            m_is_active = true;
+            write_header();
+            // Buffer at least one row
+            m_buffer_limit = std::max(m_buffer_limit, m_column_name.size());
+            m_buffer.reserve(m_buffer_limit);
+            m_block.reserve(std::min(m_buffer_limit,
+                                     std::max(M_BLOCK_LIMIT, m_column_name.size())));
+        }
+    }
+
+    void BinaryCSVImp::update(const std::vector<double> &sample)
+    {
+        if (!m_is_active) {
+            throw Exception("BinaryCSVImp::activate() must be called prior to update",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (sample.size() != m_column_name.size()) {
+            throw Exception("BinaryCSVImp::update(): Input vector incorrectly sized",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_buffer.size() + sample.size() > m_buffer_limit) {
+            flush();
+        }
+        m_buffer.insert(m_buffer.end(), sample.begin(), sample.end());
+    }
+
+    void BinaryCSVImp::flush(void)
+    {
+        size_t num_col = m_column_name.size();
+        uint64_t num_row = num_col ? m_buffer.size() / num_col : 0;
+        // Write the buffered rows in blocks of at most M_BLOCK_LIMIT
+        // values so that only one block is transposed at a time.
+        uint64_t block_row = num_col ? std::max<uint64_t>(M_BLOCK_LIMIT / num_col, 1) : 0;
+        for (uint64_t row_begin = 0; row_begin < num_row; row_begin += block_row) {
+            uint64_t block_num_row = std::min(block_row, num_row - row_begin);
+            m_block.resize(block_num_row * num_col);
+            for (uint64_t row_idx = 0; row_idx != block_num_row; ++row_idx) {
+                const double *row = m_buffer.data() + (row_begin + row_idx) * num_col;
+                for (size_t col_idx = 0; col_idx != num_col; ++col_idx) {
+                    m_block[col_idx * block_num_row + row_idx] = row[col_idx];
+                }
+            }
+            m_stream.write((const char *)&block_num_row, sizeof(block_num_row));
+            m_stream.write((const char *)m_block.data(), m_block.size() * sizeof(double));
+        }
+        m_buffer.clear();
+        m_stream.flush();
+    }
+
+    void BinaryCSVImp::write_header(void)
+    {
+        json11::Json::array columns;
+        for (size_t col_idx = 0; col_idx != m_column_name.size(); ++col_idx) {
+            columns.push_back(json11::Json::object {
+                {"name", m_column_name[col_idx]},
+                {"format", m_column_format[col_idx]}
+            });
+        }
+        const uint16_t byte_order_test = 1;
+        bool is_little = *(const uint8_t *)&byte_order_test == 1;
+        std::string header = json11::Json(json11::Json::object {
+            {"geopm_version", geopm_version()},
+            {"start_time", m_start_time},
+            {"profile_name", environment().profile()},
+            {"node_name", m_host_name},
+            {"agent", environment().agent()},
+            {"byte_order", is_little ? "little" : "big"},
+            {"columns", columns}
+        }).dump();
+        header.resize(((header.size() + 7) / 8) * 8, ' ');
+        // The header size is little-endian so that a reader can find
+        // the recorded byte order before it knows the byte order.
+        uint64_t header_size = header.size();
+        char header_size_le[sizeof(header_size)];
+        for (size_t byte_idx = 0; byte_idx != sizeof(header_size); ++byte_idx) {
+            header_size_le[byte_idx] = (char)((header_size >> (8 * byte_idx)) & 0xFF);
+        }
+        m_stream.write(M_MAGIC, std::strlen(M_MAGIC));
+        m_stream.write(header_size_le, sizeof(header_size_le));
+        m_stream.write(header.data(), header.size());
+        if (!m_stream.good()) {
+            throw Exception("BinaryCSVImp: Failed to write header to '" + m_file_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    AsyncCSV::AsyncCSV(std::unique_ptr<CSV> csv, size_t queue_size)
+        : m_csv(std::move(csv))
+        , m_queue_size(queue_size)
+        , m_num_column(0)
+        , m_num_push(0)
+        , m_num_pop(0)
+        , m_is_done(false)
+        , m_is_failed(false)
+    {
+        if (m_queue_size == 0) {
+            throw Exception("AsyncCSV: queue_size must be positive",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    AsyncCSV::~AsyncCSV()
+    {
+        if (m_writer.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(m_queue_mutex);
+                m_is_done = true;
+            }
+            m_push_cv.notify_one();
+            m_writer.join();
+        }
+    }
+
+    void AsyncCSV::add_column(const std::string &name)
+    {
+        m_csv->add_column(name);
+        ++m_num_column;
+    }
+
+    void AsyncCSV::add_column(const std::string &name, const std::string &format)
+    {
+        m_csv->add_column(name, format);
+        ++m_num_column;
+    }
+
+    void AsyncCSV::add_column(const std::string &name, std::function<std::string(double)> format)
+    {
+        m_csv->add_column(name, format);
+        ++m_num_column;
+    }
+
+    void AsyncCSV::activate(void)
+    {
+        if (!m_writer.joinable()) {
+            m_csv->activate();
+            m_queue.resize(m_queue_size * m_num_column);
+            m_writer = std::thread(&AsyncCSV::writer_loop, this);
+        }
+    }
+
+    void AsyncCSV::update(const std::vector<double> &sample)
+    {
+        if (!m_writer.joinable()) {
+            throw Exception("AsyncCSV::activate() must be called prior to update",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (sample.size() != m_num_column) {
+            throw Exception("AsyncCSV::update(): Input vector incorrectly sized",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            if (m_num_push - m_num_pop == m_queue_size) {
+                wait_writer(lock, m_num_push - m_queue_size + 1);
+            }
+            check_error();
+            std::copy(sample.begin(), sample.end(),
+                      m_queue.begin() + (m_num_push % m_queue_size) * m_num_column);
+            ++m_num_push;
+        }
+        m_push_cv.notify_one();
+    }
+
+    void AsyncCSV::flush(void)
+    {
+        if (m_writer.joinable()) {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            wait_writer(lock, m_num_push);
+            check_error();
+        }
+        // The writer thread does not use the wrapped CSV while the
+        // queue is empty.
+        m_csv->flush();
+    }
+
+    void AsyncCSV::wait_writer(std::unique_lock<std::mutex> &lock,
+                               uint64_t num_write)
+    {
+        m_pop_cv.wait(lock, [this, num_write]() {
+            return m_num_pop >= num_write || m_is_failed;
+        });
+    }
+
+    void AsyncCSV::check_error(void)
+    {
+        if (m_is_failed) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    void AsyncCSV::writer_loop(void)
+    {
+        std::vector<double> sample(m_num_column);
+        try {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            while (true) {
+                m_push_cv.wait(lock, [this]() {
+                    return m_num_pop != m_num_push || m_is_done;
+                });
+                // Every row pushed before the destructor is written
+                if (m_num_pop == m_num_push) {
+                    break;
+                }
+                uint64_t num_pop = m_num_pop;
+                lock.unlock();
+                auto row_it = m_queue.begin() + (num_pop % m_queue_size) * m_num_column;
+                std::copy(row_it, row_it + m_num_column, sample.begin());
+                m_csv->update(sample);
+                lock.lock();
+                m_num_pop = num_pop + 1;
+                m_pop_cv.notify_one();
+            }
+        }
+        catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(m_queue_mutex);
+                m_error = std::current_exception();
+                m_is_failed = true;
+            }
+            m_pop_cv.notify_one();
+        }
+    }
 }
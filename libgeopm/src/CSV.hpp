@@ -6,12 +6,18 @@
 #ifndef CSV_HPP_INCLUDE
 #define CSV_HPP_INCLUDE
 
+#include <cstdint>
+#include <condition_variable>
+#include <exception>
 #include <vector>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace geopm
 {
@@ -71,6 +77,15 @@ namespace geopm
             virtual void update(const std::vector<double> &sample) = 0;
             /// @brief Flush all output to the CSV file.
             virtual void flush(void) = 0;
+            /// @brief Create a table writer for the requested file
+            ///        format.
+            /// @param [in] file_format Either "csv" for CSVImp or
+            ///        "binary" for BinaryCSVImp.
+            static std::unique_ptr<CSV> make_unique(const std::string &file_path,
+                                                    const std::string &host_name,
+                                                    const std::string &start_time,
+                                                    size_t buffer_size,
+                                                    const std::string &file_format);
     };
 
     class CSVImp : public CSV
@@ -105,6 +120,115 @@ namespace geopm
             off_t m_buffer_limit;
             bool m_is_active;
     };
+
+    /// @brief CSV implementation that writes an append-only binary
+    ///        columnar file instead of text.  Values are stored as
+    ///        native 8 byte doubles without formatting.  The file
+    ///        begins with the 8 byte magic string "GEOPMBIN", a
+    ///        little-endian uint64 length of the header, and the
+    ///        header: a JSON object padded with spaces to a multiple
+    ///        of 8 bytes.  The header holds the same meta-data as the
+    ///        CSV header, the "byte_order" of the rest of the file,
+    ///        and the "columns" as a list of objects with the field
+    ///        "name" and a "format" hint ("double", "float",
+    ///        "integer", "hex" or "raw64").  The rest of the file is
+    ///        a sequence of blocks: a uint64 row count followed by
+    ///        the values of each column in turn.
+    class BinaryCSVImp : public CSV
+    {
+        public:
+            BinaryCSVImp(const std::string &file_path,
+                         const std::string &host_name,
+                         const std::string &start_time,
+                         size_t buffer_size);
+            BinaryCSVImp(const BinaryCSVImp &other) = delete;
+            BinaryCSVImp &operator=(const BinaryCSVImp &other) = delete;
+            virtual ~BinaryCSVImp();
+            void add_column(const std::string &name) override;
+            void add_column(const std::string &name,
+                            const std::string &format) override;
+            void add_column(const std::string &name,
+                            std::function<std::string(double)> format) override;
+            void activate(void) override;
+            void update(const std::vector<double> &sample) override;
+            void flush(void) override;
+            static constexpr const char *M_MAGIC = "GEOPMBIN";
+        private:
+            /// Maximum number of values in each block written
+            static constexpr size_t M_BLOCK_LIMIT = 8192;
+            void write_header(void);
+
+            std::string m_file_path;
+            std::string m_host_name;
+            std::string m_start_time;
+            std::vector<std::string> m_column_name;
+            std::vector<std::string> m_column_format;
+            std::ofstream m_stream;
+            /// Rows since the last flush stored in row-major order
+            std::vector<double> m_buffer;
+            size_t m_buffer_limit;
+            /// Column-major copy of the rows in one block written to
+            /// the file
+            std::vector<double> m_block;
+            bool m_is_active;
+    };
+
+    /// @brief CSV that formats and writes rows on a background
+    ///        thread.  Calls to update() copy the row into a single
+    ///        producer, single consumer queue and return without
+    ///        formatting or file I/O.  The writer thread passes each
+    ///        row to the wrapped CSV.  Errors from the writer thread
+    ///        are rethrown by the next call to update() or flush().
+    ///        The methods must all be called by one thread.
+    class AsyncCSV : public CSV
+    {
+        public:
+            /// @param [in] csv Object that formats and writes rows.
+            /// @param [in] queue_size Maximum number of rows waiting
+            ///        to be written.  If the queue is full update()
+            ///        blocks until the writer thread catches up.
+            AsyncCSV(std::unique_ptr<CSV> csv, size_t queue_size);
+            AsyncCSV(const AsyncCSV &other) = delete;
+            AsyncCSV &operator=(const AsyncCSV &other) = delete;
+            virtual ~AsyncCSV();
+            void add_column(const std::string &name) override;
+            void add_column(const std::string &name,
+                            const std::string &format) override;
+            void add_column(const std::string &name,
+                            std::function<std::string(double)> format) override;
+            void activate(void) override;
+            void update(const std::vector<double> &sample) override;
+            void flush(void) override;
+        private:
+            void writer_loop(void);
+            void wait_writer(std::unique_lock<std::mutex> &lock,
+                             uint64_t num_write);
+            /// @brief Rethrow an error from the writer thread, the
+            ///        caller must hold m_queue_mutex.
+            void check_error(void);
+            std::unique_ptr<CSV> m_csv;
+            const size_t m_queue_size;
+            size_t m_num_column;
+            std::vector<double> m_queue;
+            /// Protects the counters and flags below.  A row is
+            /// copied in or out of the queue while only its owner
+            /// can access it, so the row data is not protected.
+            std::mutex m_queue_mutex;
+            /// Signaled by update() and the destructor to wake the
+            /// writer thread
+            std::condition_variable m_push_cv;
+            /// Signaled by the writer thread after each row is
+            /// written or on error
+            std::condition_variable m_pop_cv;
+            /// Total rows copied into the queue by update()
+            uint64_t m_num_push;
+            /// Total rows passed to the wrapped CSV
+            uint64_t m_num_pop;
+            bool m_is_done;
+            bool m_is_failed;
+            std::exception_ptr m_error;
+            std::thread m_writer;
+    };
 }
 
 #endif
@@ -210,6 +210,22 @@ namespace geopm
         }
     }
 
+    void NullComm::window_lock_all(size_t window_id, int assert) const
+    {
+        if (window_id >= m_window_buffers.size()) {
+            throw Exception("NullComm::" + std::string(__func__) + "(): window_id is out of bounds",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    void NullComm::window_unlock_all(size_t window_id) const
+    {
+        if (window_id >= m_window_buffers.size()) {
+            throw Exception("NullComm::" + std::string(__func__) + "(): window_id is out of bounds",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
     void NullComm::coordinate(int rank, std::vector<int> &coord) const
     {
         if (rank != 0) {
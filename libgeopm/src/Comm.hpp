@@ -105,6 +105,19 @@ namespace geopm
             ///
             /// @param [in] rank Rank of the locked window.
             virtual void window_unlock(size_t window_id, int rank) const = 0;
+            /// @brief Begin one epoch for message passing and RMA
+            ///        to every rank with a shared lock.
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            ///
+            /// @param [in] assert Used to optimize call.
+            virtual void window_lock_all(size_t window_id, int assert) const = 0;
+            /// @brief End the epoch begun by window_lock_all().  All
+            ///        RMA operations issued during the epoch are
+            ///        complete on return.
+            ///
+            /// @param [in] window_id The window handle for the target window.
+            virtual void window_unlock_all(size_t window_id) const = 0;
             /// @brief Coordinate in Cartesian grid for specified rank
             ///
             /// @param [in] rank Rank for which coordinates should be calculated
@@ -218,6 +231,8 @@ namespace geopm
             void window_destroy(size_t window_id) override;
             void window_lock(size_t window_id, bool is_exclusive, int rank, int assert) const override;
             void window_unlock(size_t window_id, int rank) const override;
+            void window_lock_all(size_t window_id, int assert) const override;
+            void window_unlock_all(size_t window_id) const override;
             void coordinate(int rank, std::vector<int> &coord) const override;
             std::vector<int> coordinate(int rank) const override;
             void barrier(void) const override;
@@ -259,6 +259,11 @@ namespace geopm
         , m_init_control(std::move(init_control))
         , m_do_init_control(do_init_control)
         , m_do_restore(false)
+        , m_loop_time({{0, 0}})
+        , m_loop_count(-1)
+        , m_loop_period_mean(0.0)
+        , m_loop_period_m2(0.0)
+        , m_loop_period_max(0.0)
     {
         if (m_num_send_down > 0 && !(m_do_policy || m_do_endpoint)) {
             throw Exception("Controller(): at least one of policy or endpoint path"
@@ -399,6 +404,11 @@ namespace geopm
         m_reporter->total_time(m_application_sampler.total_time());
         m_reporter->overhead(m_application_sampler.overhead_time(),
                              sample_delay);
+        if (m_loop_count > 0) {
+            m_reporter->loop_period(m_loop_period_mean,
+                                    std::sqrt(m_loop_period_m2 / m_loop_count),
+                                    m_loop_period_max);
+        }
         generate();
         m_platform_io.restore_control();
     }
@@ -426,9 +436,29 @@ namespace geopm
     {
         walk_down();
         m_agent[0]->wait();
+        update_loop_period();
         walk_up();
     }
 
+    void Controller::update_loop_period(void)
+    {
+        geopm_time_s curr_time;
+        geopm_time(&curr_time);
+        if (m_loop_count >= 0) {
+            // Welford's online mean and variance of the period
+            double period = geopm_time_diff(&m_loop_time, &curr_time);
+            ++m_loop_count;
+            double delta = period - m_loop_period_mean;
+            m_loop_period_mean += delta / m_loop_count;
+            m_loop_period_m2 += delta * (period - m_loop_period_mean);
+            m_loop_period_max = std::max(m_loop_period_max, period);
+        }
+        else {
+            m_loop_count = 0;
+        }
+        m_loop_time = curr_time;
+    }
+
     void Controller::walk_down(void)
     {
         bool do_send = false;
@@ -14,6 +14,8 @@
 #include <map>
 #include <set>
 
+#include "geopm_time.h"
+
 namespace geopm
 {
     class Comm;
@@ -135,6 +137,9 @@ namespace geopm
             /// @brief Call init() on every agent.  Agents can push
             ///        signals and controls.
             void init_agents(void);
+            /// @brief Update the statistics of the control loop
+            ///        period after the Agent returns from wait().
+            void update_loop_period(void);
 
             std::shared_ptr<Comm> m_comm;
             PlatformIO &m_platform_io;
@@ -172,6 +177,11 @@ namespace geopm
             std::shared_ptr<InitControl> m_init_control;
             bool m_do_init_control;
             bool m_do_restore;
+            geopm_time_s m_loop_time;
+            int m_loop_count;
+            double m_loop_period_mean;
+            double m_loop_period_m2;
+            double m_loop_period_max;
     };
 }
 #endif
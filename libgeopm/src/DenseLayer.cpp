@@ -6,6 +6,8 @@
 #include "DenseLayer.hpp"
 #include "DenseLayerImp.hpp"
 
+#include <algorithm>
+
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
 
@@ -39,6 +41,21 @@ namespace geopm
                             "Incompatible dimensions for weights and biases.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+
+        size_t num_input = weights.get_cols();
+        size_t num_output = weights.get_rows();
+        size_t output_pad = M_OUTPUT_BLOCK * ((num_output + M_OUTPUT_BLOCK - 1) / M_OUTPUT_BLOCK);
+        m_weights_tile.resize(num_input * output_pad, 0.0);
+        m_biases_pad.resize(output_pad, 0.0);
+        for (size_t out_idx = 0; out_idx < num_output; ++out_idx) {
+            const std::vector<double> &row = weights.get_data()[out_idx].get_data();
+            size_t tile_offset = (out_idx / M_OUTPUT_BLOCK) * num_input * M_OUTPUT_BLOCK +
+                                 out_idx % M_OUTPUT_BLOCK;
+            for (size_t in_idx = 0; in_idx < num_input; ++in_idx) {
+                m_weights_tile[tile_offset + in_idx * M_OUTPUT_BLOCK] = row[in_idx];
+            }
+            m_biases_pad[out_idx] = biases[out_idx];
+        }
     }
 
     TensorOneD DenseLayerImp::forward(const TensorOneD &input) const
@@ -52,6 +69,40 @@ namespace geopm
         return m_biases + m_weights * input;
     }
 
+    void DenseLayerImp::forward_batch(const double *input, size_t num_batch,
+                                      double *output) const
+    {
+        // Compute the matrix product of the inputs with the
+        // transposed weights one tile of M_OUTPUT_BLOCK outputs at a
+        // time.  The weights for a tile are read in order and stay
+        // in cache while they are applied to every input in the
+        // batch, and the sums for each input are held in registers.
+        // The fixed size loops over the tile are unrolled and
+        // vectorized by the compiler.
+        size_t num_input = get_input_dim();
+        size_t num_output = get_output_dim();
+        for (size_t out_begin = 0; out_begin < num_output; out_begin += M_OUTPUT_BLOCK) {
+            size_t out_size = std::min(M_OUTPUT_BLOCK, num_output - out_begin);
+            const double *biases = m_biases_pad.data() + out_begin;
+            const double *weights_begin = m_weights_tile.data() + out_begin * num_input;
+            for (size_t batch_idx = 0; batch_idx < num_batch; ++batch_idx) {
+                double sum[M_OUTPUT_BLOCK];
+                for (size_t out_idx = 0; out_idx < M_OUTPUT_BLOCK; ++out_idx) {
+                    sum[out_idx] = biases[out_idx];
+                }
+                const double *in = input + batch_idx * num_input;
+                const double *weights = weights_begin;
+                for (size_t in_idx = 0; in_idx < num_input; ++in_idx) {
+                    for (size_t out_idx = 0; out_idx < M_OUTPUT_BLOCK; ++out_idx) {
+                        sum[out_idx] += in[in_idx] * weights[out_idx];
+                    }
+                    weights += M_OUTPUT_BLOCK;
+                }
+                std::copy(sum, sum + out_size, output + batch_idx * num_output + out_begin);
+            }
+        }
+    }
+
     size_t DenseLayerImp::get_input_dim() const
     {
         return m_weights.get_cols();
@@ -42,6 +42,22 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             virtual TensorOneD forward(const TensorOneD &input) const = 0;
+            /// @brief Perform inference on a batch of inputs using
+            ///        the instance weights and biases without
+            ///        allocating memory.
+            ///
+            /// @param [in] input Array of num_batch input vectors
+            ///        stored one after another, each with
+            ///        get_input_dim() values.
+            ///
+            /// @param [in] num_batch Number of input vectors.
+            ///
+            /// @param [out] output Array of num_batch output vectors
+            ///        stored one after another, each with
+            ///        get_output_dim() values.  Must not overlap the
+            ///        input array.
+            virtual void forward_batch(const double *input, size_t num_batch,
+                                       double *output) const = 0;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
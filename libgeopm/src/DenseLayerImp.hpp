@@ -8,6 +8,8 @@
 
 #include "DenseLayer.hpp"
 
+#include <vector>
+
 #include "TensorOneD.hpp"
 #include "TensorTwoD.hpp"
 
@@ -35,6 +37,15 @@ namespace geopm
             ///
             /// @returns Returns a TensorOneD object of output values
             TensorOneD forward(const TensorOneD &input) const override;
+            /// @brief Batched inference step
+            ///
+            /// @param [in] input Array of num_batch input vectors
+            ///
+            /// @param [in] num_batch Number of input vectors
+            ///
+            /// @param [out] output Array of num_batch output vectors
+            void forward_batch(const double *input, size_t num_batch,
+                               double *output) const override;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -47,6 +58,17 @@ namespace geopm
         private:
             TensorTwoD m_weights;
             TensorOneD m_biases;
+            // Number of output values computed together by
+            // forward_batch()
+            static constexpr size_t M_OUTPUT_BLOCK = 4;
+            // Transpose of the weights split into tiles of
+            // M_OUTPUT_BLOCK outputs, padded with zeros.  Within a
+            // tile, the weights applied to each input value are
+            // stored together, and tile j starts at offset
+            // j * get_input_dim() * M_OUTPUT_BLOCK.
+            std::vector<double> m_weights_tile;
+            // Biases padded with zeros to a multiple of M_OUTPUT_BLOCK
+            std::vector<double> m_biases_pad;
     };
 }
 
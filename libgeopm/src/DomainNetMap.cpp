@@ -211,6 +211,7 @@ namespace geopm
             }
             m_trace_outputs.push_back(output.string_value());
         }
+        m_input.resize(input_dim());
     }
 
     std::shared_ptr<DenseLayer> DomainNetMapImp::json_to_DenseLayer(const json11::Json &obj) const
@@ -301,23 +302,61 @@ namespace geopm
 
     void DomainNetMapImp::sample()
     {
-        std::vector<double> xs;
+        sample_input(m_input, 0);
+        m_last_output = m_neural_net->forward(m_nn_factory->createTensorOneD(m_input));
+    }
+
+    size_t DomainNetMapImp::input_dim() const
+    {
+        return m_signal_inputs.size() + m_delta_inputs.size();
+    }
+
+    void DomainNetMapImp::sample_input(std::vector<double> &input, size_t batch_idx)
+    {
+        size_t input_idx = batch_idx * input_dim();
+        if (input.size() < input_idx + input_dim()) {
+            throw Exception("DomainNetMapImp::" + std::string(__func__) +
+                            ": Input batch is too small for batch index " +
+                            std::to_string(batch_idx) + ".",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
 
         // Sample latest signal values
-        for (auto &input : m_signal_inputs) {
-            input.signal = m_platform_io.sample(input.batch_idx);
-            xs.push_back(input.signal);
+        for (auto &input_signal : m_signal_inputs) {
+            input_signal.signal = m_platform_io.sample(input_signal.batch_idx);
+            input[input_idx++] = input_signal.signal;
         }
-        for (auto &input : m_delta_inputs) {
-            input.signal_num_last = input.signal_num;
-            input.signal_den_last = input.signal_den;
-            input.signal_num = m_platform_io.sample(input.batch_idx_num);
-            input.signal_den = m_platform_io.sample(input.batch_idx_den);
-            xs.push_back((input.signal_num - input.signal_num_last) /
-                         (input.signal_den - input.signal_den_last));
+        for (auto &input_signal : m_delta_inputs) {
+            input_signal.signal_num_last = input_signal.signal_num;
+            input_signal.signal_den_last = input_signal.signal_den;
+            input_signal.signal_num = m_platform_io.sample(input_signal.batch_idx_num);
+            input_signal.signal_den = m_platform_io.sample(input_signal.batch_idx_den);
+            input[input_idx++] = (input_signal.signal_num - input_signal.signal_num_last) /
+                                 (input_signal.signal_den - input_signal.signal_den_last);
         }
+    }
 
-        m_last_output = m_neural_net->forward(m_nn_factory->createTensorOneD(xs));
+    void DomainNetMapImp::forward_batch(const std::vector<double> &input, size_t num_batch,
+                                        std::vector<double> &output)
+    {
+        m_neural_net->forward_batch(input, num_batch, output);
+    }
+
+    void DomainNetMapImp::set_output(const std::vector<double> &output, size_t batch_idx)
+    {
+        size_t output_dim = m_trace_outputs.size();
+        size_t output_idx = batch_idx * output_dim;
+        if (output.size() < output_idx + output_dim) {
+            throw Exception("DomainNetMapImp::" + std::string(__func__) +
+                            ": Output batch is too small for batch index " +
+                            std::to_string(batch_idx) + ".",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        m_last_output.set_dim(output_dim);
+        for (size_t idx = 0; idx < output_dim; ++idx) {
+            m_last_output[idx] = output[output_idx + idx];
+        }
     }
 
     std::vector<std::string> DomainNetMapImp::trace_names() const
@@ -70,6 +70,43 @@ namespace geopm
             /// @brief Samples latest signals for a specific domain and applies the 
             ///        resulting TensorOneD state to the neural net.
             virtual void sample() = 0;
+            /// @brief Get the number of neural net inputs sampled for
+            ///        the domain.
+            ///
+            /// @return Returns the number of values written by
+            ///         sample_input().
+            virtual size_t input_dim() const = 0;
+            /// @brief Samples latest signals for a specific domain and
+            ///        stores the resulting neural net inputs in one
+            ///        row of a batch without applying the neural net.
+            ///
+            /// @param [out] input Batch of neural net inputs with
+            ///        input_dim() values per row.
+            ///
+            /// @param [in] batch_idx Row of the batch to write.
+            ///
+            /// @throws geopm::Exception if input has fewer than
+            ///         batch_idx + 1 rows.
+            virtual void sample_input(std::vector<double> &input, size_t batch_idx) = 0;
+            /// @brief Applies the neural net to a batch of inputs
+            ///        from sample_input() calls on this object or on
+            ///        others loaded from the same neural net file.
+            ///
+            /// @param [in] input Batch of neural net inputs.
+            ///
+            /// @param [in] num_batch Number of rows in the batch.
+            ///
+            /// @param [out] output Batch of neural net outputs.
+            virtual void forward_batch(const std::vector<double> &input, size_t num_batch,
+                                       std::vector<double> &output) = 0;
+            /// @brief Stores one row of a batch of outputs from
+            ///        forward_batch() as the latest output for the
+            ///        domain.
+            ///
+            /// @param [in] output Batch of neural net outputs.
+            ///
+            /// @param [in] batch_idx Row of the batch to read.
+            virtual void set_output(const std::vector<double> &output, size_t batch_idx) = 0;
             /// @brief generates the names for trace columns from the appropriate field in the neural net
             virtual std::vector<std::string> trace_names() const = 0;
             /// @brief Populates trace values from last_output for each index within each domain type
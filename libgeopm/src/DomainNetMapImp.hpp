@@ -34,6 +34,11 @@ namespace geopm
                             std::shared_ptr<NNFactory> nn_factory);
 
             void sample() override;
+            size_t input_dim() const override;
+            void sample_input(std::vector<double> &input, size_t batch_idx) override;
+            void forward_batch(const std::vector<double> &input, size_t num_batch,
+                               std::vector<double> &output) override;
+            void set_output(const std::vector<double> &output, size_t batch_idx) override;
             /// @brief Generates the names for trace columns from the appropriate field in the neural net.
             //         In this case, region classification names annotated with domain type and index. 
             std::vector<std::string> trace_names() const override;
@@ -77,6 +82,8 @@ namespace geopm
             std::shared_ptr<LocalNeuralNet> m_neural_net;
 
             TensorOneD m_last_output;
+            // Inputs for sample()
+            std::vector<double> m_input;
             std::vector<m_signal_s> m_signal_inputs;
             std::vector<m_delta_signal_s> m_delta_inputs;
             std::vector<std::string> m_trace_outputs;
@@ -11,9 +11,12 @@
 #include <libelf.h>
 #include <gelf.h>
 #include <dlfcn.h>
+#include <link.h>
 #include <cxxabi.h>
 #include <iostream>
-#include <climits>
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 #include "ELF.hpp"
 #include "geopm/Exception.hpp"
@@ -77,10 +80,155 @@ namespace geopm
         return result;
     }
 
+    /// @brief Process-wide cache of the symbol tables of the objects
+    ///        loaded into the process.  The symbol table of an object
+    ///        is read once, the first time an address within the
+    ///        object is looked up, into arrays sorted by symbol
+    ///        offset that are searched with a binary search.
+    class SymbolCache
+    {
+        public:
+            static SymbolCache &symbol_cache(void);
+            SymbolCache() = default;
+            virtual ~SymbolCache() = default;
+            /// @brief Look up the nearest symbol lower than an
+            ///        address within a loaded object.
+            /// @param [in] info Result of dladdr() for the address.
+            /// @param [in] address The address to look up.
+            /// @return Pair of symbol location and symbol name.  If
+            ///         symbol couldn't be found, location is zero and
+            ///         symbol name is empty.
+            std::pair<size_t, std::string> lookup(const Dl_info &info, size_t address);
+        private:
+            struct m_table_s {
+                // Address the object's symbol offsets are relative to
+                size_t base_addr;
+                // Sorted symbol offsets
+                std::vector<size_t> offset;
+                // Position in name of each symbol's null terminated
+                // name
+                std::vector<size_t> name_begin;
+                std::string name;
+            };
+            static std::shared_ptr<const m_table_s> make_table(size_t address);
+            std::mutex m_mutex;
+            // Keyed by the object base address and file name reported
+            // by dladdr()
+            std::map<std::pair<size_t, std::string>, std::shared_ptr<const m_table_s> > m_table;
+    };
+
+    SymbolCache &SymbolCache::symbol_cache(void)
+    {
+        static SymbolCache instance;
+        return instance;
+    }
+
+    std::pair<size_t, std::string> SymbolCache::lookup(const Dl_info &info, size_t address)
+    {
+        std::pair<size_t, std::string> result(0, "");
+        std::shared_ptr<const m_table_s> table;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto key = std::make_pair((size_t)info.dli_fbase, std::string(info.dli_fname));
+            auto table_it = m_table.find(key);
+            if (table_it == m_table.end()) {
+                table_it = m_table.emplace(key, make_table(address)).first;
+            }
+            table = table_it->second;
+        }
+        size_t target = address - table->base_addr;
+        auto offset_it = std::upper_bound(table->offset.begin(), table->offset.end(), target);
+        if (offset_it != table->offset.begin()) {
+            --offset_it;
+            size_t symbol_idx = offset_it - table->offset.begin();
+            // Add back the base address so it can be compared with
+            // the input.
+            result.first = *offset_it + table->base_addr;
+            result.second = table->name.c_str() + table->name_begin[symbol_idx];
+        }
+        return result;
+    }
+
+    std::shared_ptr<const SymbolCache::m_table_s> SymbolCache::make_table(size_t address)
+    {
+        auto result = std::make_shared<m_table_s>();
+        result->base_addr = 0;
+        // Find the object with a loaded segment that contains the
+        // address.  The symbol offsets of the object are relative to
+        // its load address, which is zero for an executable that is
+        // not position independent.
+        struct m_object_s {
+            size_t address;
+            size_t base_addr;
+            std::string file_name;
+            bool is_found;
+        } object = {address, 0, "", false};
+        dl_iterate_phdr([](struct dl_phdr_info *phdr_info, size_t size, void *data) -> int {
+            m_object_s *object = (m_object_s *)data;
+            for (int seg_idx = 0; seg_idx != phdr_info->dlpi_phnum; ++seg_idx) {
+                const ElfW(Phdr) &phdr = phdr_info->dlpi_phdr[seg_idx];
+                size_t seg_begin = phdr_info->dlpi_addr + phdr.p_vaddr;
+                if (phdr.p_type == PT_LOAD &&
+                    object->address >= seg_begin &&
+                    object->address < seg_begin + phdr.p_memsz) {
+                    object->base_addr = phdr_info->dlpi_addr;
+                    object->file_name = phdr_info->dlpi_name;
+                    object->is_found = true;
+                    return 1;
+                }
+            }
+            return 0;
+        }, &object);
+        if (!object.is_found) {
+            return result;
+        }
+        result->base_addr = object.base_addr;
+        // The executable of the process is reported without a name
+        if (object.file_name.empty()) {
+            object.file_name = "/proc/self/exe";
+        }
+        std::vector<std::pair<size_t, size_t> > symbols;
+        try {
+            std::shared_ptr<ELF> elf_ptr = elf(object.file_name);
+            do {
+                if (elf_ptr->num_symbol()) {
+                    do {
+                        symbols.emplace_back(elf_ptr->symbol_offset(), result->name.size());
+                        result->name += elf_ptr->symbol_name();
+                        result->name.push_back('\0');
+                    } while (elf_ptr->next_symbol());
+                }
+            } while (elf_ptr->next_section());
+        }
+        catch (const Exception &ex) {
+           // If the ELF read fails, just swallow the exception
+           std::string what(ex.what());
+           if (what.find("ELFImp") == std::string::npos) {
+               throw ex;
+           }
+        }
+        // When symbols share an offset, the last one read is used
+        std::stable_sort(symbols.begin(), symbols.end(),
+                         [](const std::pair<size_t, size_t> &lhs,
+                            const std::pair<size_t, size_t> &rhs) {
+                             return lhs.first < rhs.first;
+                         });
+        for (const auto &symbol : symbols) {
+            if (!result->offset.empty() && result->offset.back() == symbol.first) {
+                result->name_begin.back() = symbol.second;
+            }
+            else {
+                result->offset.push_back(symbol.first);
+                result->name_begin.push_back(symbol.second);
+            }
+        }
+        result->name.shrink_to_fit();
+        return result;
+    }
+
     std::pair<size_t, std::string> symbol_lookup(const void *instruction_ptr)
     {
         std::pair<size_t, std::string> result(0, "");
-        size_t target = (size_t)instruction_ptr;
         Dl_info info;
         bool dladdr_success = dladdr(instruction_ptr, &info);
         // "dladdr() returns 0 on error, and nonzero on success."
@@ -92,51 +240,9 @@ namespace geopm
                 result.second = info.dli_sname;
             }
             else if (info.dli_fname) {
-                // If the base address for the mapped object is not
-                // the base address of the program, we need to
-                // subtract the random base address from the
-                // instruction pointer before looking it up.
-                size_t base_addr = 0;
-                if ((size_t)info.dli_fbase != 0x400000ULL) {
-                    base_addr = (size_t)info.dli_fbase;
-                }
-                target -= base_addr;
-                // If dli_fname is not an absolute path nor a shared
-                // object, assume the file points to current
-                // executable (/proc/self/exe).
-                std::string file_name(info.dli_fname);
-                if (file_name.find('/') == std::string::npos &&
-                    file_name.find(".so") == std::string::npos) {
-                    file_name = "/proc/self/exe";
-                    char file_name_cstr[PATH_MAX];
-                    int name_len = readlink(file_name.c_str(), file_name_cstr, PATH_MAX - 1);
-                    if (name_len > 0 && name_len < PATH_MAX) {
-                        file_name_cstr[name_len] = '\0';
-                        file_name = file_name_cstr;
-                    }
-                }
-                // Generate the symbol map from the object file and
-                // find the target address
-                try {
-                    std::map<size_t, std::string> symbol_map(elf_symbol_map(file_name));
-                    auto symbol_it = symbol_map.upper_bound(target);
-                    if (symbol_it != symbol_map.begin()) {
-                        --symbol_it;
-                    }
-                    if (symbol_it->first <= target) {
-                        result = *symbol_it;
-                        // Add back the random base address so it can be
-                        // compared with the input.
-                        result.first += base_addr;
-                    }
-                }
-                catch (const Exception &ex) {
-                   // If the ELF read fails, just swallow the exception
-                   std::string what(ex.what());
-                   if (what.find("ELFImp") == std::string::npos) {
-                       throw ex;
-                   }
-                }
+                // Find the target address in the symbol table read
+                // from the object file
+                result = SymbolCache::symbol_cache().lookup(info, (size_t)instruction_ptr);
             }
         }
         if (result.second.size()) {
@@ -198,7 +304,7 @@ namespace geopm
             throw Exception("ELFImp::ELFImp(): file_path invalid: " + file_path,
                             errno ? errno : GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        m_elf_handle = elf_begin(m_file_desc, ELF_C_READ, nullptr);
+        m_elf_handle = elf_begin(m_file_desc, ELF_C_READ_MMAP, nullptr);
         if (!m_elf_handle) {
             (void)close(m_file_desc);
             throw Exception("ELFImp::ELFImp(): libelf init failed on file: " + file_path,
@@ -13,7 +13,9 @@
 namespace geopm
 {
     /// @brief Look up the nearest symbol lower than an instruction
-    ///        address.
+    ///        address.  Symbols that are not found by dladdr() are
+    ///        looked up in the symbol table of the object file that
+    ///        contains the address, which is read once per process.
     /// @param [in] instruction_ptr Address of an instruction or function.
     /// @return Pair of symbol location and symbol name.  If symbol
     ///         couldn't be found, location is zero and symbol name is
@@ -22,7 +22,8 @@ namespace geopm
         , m_period(-1)
         , m_score(-1)
         , m_record_count(0)
-        , m_DP(history_buffer_size * history_buffer_size * history_buffer_size)
+        , m_DP(history_buffer_size * history_buffer_size)
+        , m_term(history_buffer_size)
     {
 
     }
@@ -36,29 +37,22 @@ namespace geopm
         }
     }
 
-    size_t EditDistPeriodicityDetector::Didx(int ii, int jj, int mm) const {
-        return (ii % m_history_buffer_size) * m_history_buffer_size * m_history_buffer_size +
-               (jj % m_history_buffer_size) * m_history_buffer_size +
-               (mm % m_history_buffer_size);
+    size_t EditDistPeriodicityDetector::Didx(int ii, int mm) const {
+        return (mm % m_history_buffer_size) * m_history_buffer_size +
+               (ii % m_history_buffer_size);
     }
 
-    void EditDistPeriodicityDetector::Dset(int ii, int jj, int mm, uint32_t val) {
-        m_DP[Didx(ii, jj, mm)] = val;
-    }
-
-    uint32_t EditDistPeriodicityDetector::Dget(int ii, int jj, int mm) const {
+    uint32_t EditDistPeriodicityDetector::Dget(int ii, int mm) const {
         // This value is supposed to be INF but not so large that it gets wrapped around when
         // a small value is added to it.
         uint32_t result = std::numeric_limits<uint32_t>::max() / 2;
 
-        // D[ii, jj, mm] is the string-edit distance between records [0..ii) and
-        // [mm..mm+jj). If ii is too short, the values will be truncated.
+        // D[ii, mm] is the string-edit distance between records [0..ii) and
+        // [mm..m_record_count). If ii is too short, the values will be truncated.
         // Likewise, if mm is too small, this refers to data that has been lost.
-        // We want to truncate values of jj that are too *large*.
         if (m_record_count - ii < m_history_buffer_size &&
-            jj < m_history_buffer_size &&
             m_record_count - mm < m_history_buffer_size) {
-            result = m_DP[Didx(ii, jj, mm)];
+            result = m_DP[Didx(ii, mm)];
         }
 
         return result;
@@ -69,53 +63,59 @@ namespace geopm
             return;
         }
 
+        const uint32_t inf = std::numeric_limits<uint32_t>::max() / 2;
         int num_recs_in_hist = m_history_buffer.size();
-
-        for (int ii = std::max({0, m_record_count - m_history_buffer_size}); ii < m_record_count; ++ii) {
-            Dset(ii, 0, m_record_count - 1, 0);
-        }
-        for (int mm = std::max({0, m_record_count - m_history_buffer_size}); mm < m_record_count; ++mm) {
-            Dset(0, m_record_count - mm, mm, m_record_count - mm);
+        // Oldest record index that is still within the history
+        int ii_begin = std::max({1, m_record_count - m_history_buffer_size + 1});
+
+        // The suffix starting with the latest record has length
+        // zero before this update, so the distance to any string
+        // ending in the history is zero.
+        auto col_begin = m_DP.begin() + Didx(0, m_record_count - 1);
+        std::fill(col_begin, col_begin + m_history_buffer_size, 0);
+
+        // If the record to be compared to the latest addition is in the history buffer, the
+        // penalty term is 0 if they are equal.  This does not depend on the suffix, so it is
+        // computed once per update.
+        uint64_t last_rec_in_history = m_history_buffer.value(num_recs_in_hist - 1);
+        for (int ii = ii_begin; ii < m_record_count; ++ii) {
+            // entry_age is 1 for the most recent entry (it goes from 1 to m_record_count, inclusive)
+            int entry_age = m_record_count - (ii - 1);
+            uint64_t compared_rec = m_history_buffer.value(num_recs_in_hist - entry_age);
+            m_term[ii % m_history_buffer_size] = compared_rec == last_rec_in_history ? 0 : 2;
         }
 
-        uint64_t last_rec_in_history = m_history_buffer.value(num_recs_in_hist - 1);
-        for (int mm = std::max({1, m_record_count - m_history_buffer_size}); mm < m_record_count; ++mm) {
-            for (int ii = std::max({1, m_record_count - m_history_buffer_size}); ii < mm + 1; ++ii) {
-                // If the record to be compared to the latest addition is not new enough to reside in the
-                // history buffer, by default it is not a match. If it is in the history buffer, the penalty
-                // term is 0 if they are equal.
-
-                // ii is the length of the first substring that we are comparing against. If there were
-                // no history truncation, we would be comparing entry ii - 1 (0-indexed) to the latest
-                // record, entry m_record_count - 1.
-
-                // entry_age is 1 for the most recent entry (it goes from 1 to m_record_count, inclusive)
-                int entry_age = m_record_count - (ii - 1);
-                // If entry_age is above num_recs_in_hist, it will no longer be in our buffer.
-                bool cond_newrec = entry_age <= num_recs_in_hist;
-                int term = 2;
-                if (cond_newrec) {
-                    // We still have the desired record, so we can compare it to the new one.
-                    uint64_t compared_rec = m_history_buffer.value(num_recs_in_hist - entry_age);
-                    if (compared_rec == last_rec_in_history) {
-                        term = 0;
-                    }
-                }
+        // The empty prefix is within the history only until the
+        // history buffer is filled.
+        bool is_empty_prefix_valid = m_record_count < m_history_buffer_size;
+        for (int mm = ii_begin; mm < m_record_count; ++mm) {
+            // Each column holds D[ii, mm] for the suffix before this
+            // record was added and is updated in place to include
+            // it.  The distance from the empty prefix is the length
+            // of the suffix.
+            uint32_t suffix_len = m_record_count - mm;
+            uint32_t d_diag = is_empty_prefix_valid ? suffix_len - 1 : inf;
+            uint32_t d_value = is_empty_prefix_valid ? suffix_len : inf;
+            uint32_t *column = m_DP.data() + Didx(0, mm);
+            for (int ii = ii_begin; ii < mm + 1; ++ii) {
+                uint32_t &d_curr = column[ii % m_history_buffer_size];
+                uint32_t d_prev = d_curr;
                 // The value that will go into the D matrix (i.e. penalty) is the minimum of the
                 // added penalties from all directions (add/subtract/replace).
-                uint32_t d_value = std::min({Dget(ii - 1, m_record_count - mm    , mm) + 1,
-                                             Dget(ii    , m_record_count - mm - 1, mm) + 1,
-                                             Dget(ii - 1, m_record_count - mm - 1, mm) + term});
-                Dset(ii, m_record_count - mm, mm, d_value);
+                d_value = std::min({d_value + 1,
+                                    d_prev + 1,
+                                    d_diag + m_term[ii % m_history_buffer_size]});
+                d_diag = d_prev;
+                d_curr = d_value;
             }
         }
 
         int mm = std::max({(int)(m_record_count / 2.0 + 0.5), m_record_count - m_history_buffer_size});
         int bestm = mm;
-        uint32_t bestval = Dget(mm, m_record_count - mm, mm);
+        uint32_t bestval = Dget(mm, mm);
         ++mm;
         for(; mm < m_record_count; ++mm) {
-            uint32_t val = Dget(mm, m_record_count - mm, mm);
+            uint32_t val = Dget(mm, mm);
             if(val < bestval) {
                 bestval = val;
                 bestm = mm;
@@ -41,9 +41,8 @@ namespace geopm
             int num_records(void) const;
         private:
             void calc_period();
-            size_t Didx(int ii, int jj, int mm) const;
-            uint32_t Dget(int ii, int jj, int mm) const;
-            void Dset(int ii, int jj, int mm, uint32_t val);
+            size_t Didx(int ii, int mm) const;
+            uint32_t Dget(int ii, int mm) const;
             uint64_t get_history_value(int index) const;
             int find_smallest_repeating_pattern(int index) const;
 
@@ -52,7 +51,14 @@ namespace geopm
             int m_period;
             int m_score;
             int m_record_count;
+            /// Edit distance table with one column of
+            /// m_history_buffer_size entries for each start of the
+            /// suffix compared against the history.  Each column is
+            /// updated in place as records are added.
             std::vector<uint32_t> m_DP;
+            /// Substitution cost of each record in the history
+            /// against the latest record.
+            std::vector<uint32_t> m_term;
     };
 }
 
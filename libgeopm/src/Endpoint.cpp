@@ -8,7 +8,11 @@
 
 #include <cmath>
 #include <cstring>
+#include <climits>
 #include <unistd.h>
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 #include <algorithm>
 #include <string>
@@ -40,6 +44,20 @@ namespace geopm
         return "-sample";
     }
 
+    static long endpoint_futex(uint32_t *addr, int futex_op, uint32_t val,
+                               const struct timespec *timeout)
+    {
+        // The sample shared memory is mapped by other processes, so
+        // the non-private futex operations are used.
+        return syscall(SYS_futex, addr, futex_op, val, timeout, nullptr, 0);
+    }
+
+    void EndpointImp::notify_agent_change(struct geopm_endpoint_sample_shmem_s *data)
+    {
+        __atomic_add_fetch(&data->agent_seq, 1, __ATOMIC_RELEASE);
+        endpoint_futex(&data->agent_seq, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+
     EndpointImp::EndpointImp(const std::string &data_path)
         : EndpointImp(data_path, nullptr, nullptr, 0, 0)
     {
@@ -159,41 +177,77 @@ namespace geopm
         return agent;
     }
 
+    uint32_t EndpointImp::agent_seq(void)
+    {
+        if (!m_is_open) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): cannot use shmem before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        return __atomic_load_n(&data->agent_seq, __ATOMIC_ACQUIRE);
+    }
+
+    void EndpointImp::wait_agent_change(uint32_t agent_seq,
+                                        const geopm_time_s &start,
+                                        double timeout,
+                                        const std::string &func_name)
+    {
+        double wait_time = M_WAIT_PERIOD;
+        if (timeout >= 0) {
+            double remaining = timeout - geopm_time_since(&start);
+            if (remaining <= 0) {
+                throw Exception("EndpointImp::" + func_name +
+                                "(): timed out waiting for controller.",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            wait_time = std::min(wait_time, remaining);
+        }
+        auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+        struct timespec wait_ts = {(time_t)wait_time,
+                                   (long)((wait_time - (time_t)wait_time) * 1E9)};
+        // Returns immediately if agent_seq has changed since it was
+        // read, so a notification that follows the read is not lost.
+        if (endpoint_futex(&data->agent_seq, FUTEX_WAIT, agent_seq, &wait_ts) == -1 &&
+            errno != EAGAIN && errno != ETIMEDOUT && errno != EINTR) {
+            // Futex is not available: fall back to polling
+            std::this_thread::sleep_for(std::chrono::duration<double>(wait_time));
+        }
+    }
+
     void EndpointImp::wait_for_agent_attach(double timeout)
     {
-        std::string agent = get_agent();
         geopm_time_s start;
         geopm_time(&start);
+        uint32_t seq = agent_seq();
+        std::string agent = get_agent();
         while (m_continue_loop && agent == "") {
+            wait_agent_change(seq, start, timeout, __func__);
+            seq = agent_seq();
             agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
         }
     }
 
     void EndpointImp::wait_for_agent_detach(double timeout)
     {
-        std::string agent = get_agent();
         geopm_time_s start;
         geopm_time(&start);
+        uint32_t seq = agent_seq();
+        std::string agent = get_agent();
         while (m_continue_loop && agent != "") {
+            wait_agent_change(seq, start, timeout, __func__);
+            seq = agent_seq();
             agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
         }
     }
 
     void EndpointImp::stop_wait_loop(void)
     {
         m_continue_loop = false;
+        if (m_is_open) {
+            // Wake the waiting thread without changing agent_seq
+            auto data = (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem->pointer();
+            endpoint_futex(&data->agent_seq, FUTEX_WAKE, INT_MAX, nullptr);
+        }
     }
 
     void EndpointImp::reset_wait_loop(void)
@@ -7,6 +7,7 @@
 #define ENDPOINTIMP_HPP_INCLUDE
 
 #include <pthread.h>
+#include <cstdint>
 
 #include "geopm_endpoint.h"
 #include "geopm_time.h"
@@ -22,6 +23,7 @@ namespace geopm
 
     struct geopm_endpoint_sample_shmem_header {
         geopm_time_s timestamp;   // 16 bytes
+        uint32_t agent_seq;       // 4 bytes
         char agent[GEOPM_ENDPOINT_AGENT_NAME_MAX]; // 256 bytes
         char profile_name[GEOPM_ENDPOINT_PROFILE_NAME_MAX];   // 256 bytes
         char hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX];  // 512 bytes
@@ -41,6 +43,10 @@ namespace geopm
     struct geopm_endpoint_sample_shmem_s {
         /// @brief Time that the memory was last updated.
         geopm_time_s timestamp;
+        /// @brief Incremented each time an Agent attaches or
+        ///        detaches; used as a futex by processes waiting for
+        ///        the change.
+        uint32_t agent_seq;
         /// @brief Holds the name of the Agent attached, if any.
         char agent[GEOPM_ENDPOINT_AGENT_NAME_MAX];
         /// @brief Holds the profile name associated with the
@@ -88,7 +94,24 @@ namespace geopm
             std::set<std::string> get_hostnames(void) override;
             static std::string shm_policy_postfix(void);
             static std::string shm_sample_postfix(void);
+            /// @brief Increment the agent_seq of the sample shared
+            ///        memory and wake all threads that are waiting
+            ///        for an Agent to attach or detach.  Called with
+            ///        the sample shared memory lock held after the
+            ///        agent name is written.
+            static void notify_agent_change(struct geopm_endpoint_sample_shmem_s *data);
         private:
+            // Longest time to block between checks of the agent name,
+            // in case it is changed without notify_agent_change()
+            static constexpr double M_WAIT_PERIOD = 0.1;
+            uint32_t agent_seq(void);
+            // Block until agent_seq changes, the wait loop is stopped,
+            // or M_WAIT_PERIOD elapses.  Throws if the wait started
+            // at start has exceeded the timeout.
+            void wait_agent_change(uint32_t agent_seq,
+                                   const geopm_time_s &start,
+                                   double timeout,
+                                   const std::string &func_name);
             std::string m_path;
             std::shared_ptr<SharedMemory> m_policy_shmem;
             std::shared_ptr<SharedMemory> m_sample_shmem;
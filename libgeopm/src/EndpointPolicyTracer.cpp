@@ -30,7 +30,8 @@ namespace geopm
                                   environment().do_trace_endpoint_policy(),
                                   environment().trace_endpoint_policy(),
                                   PlatformIOProf::platform_io(),
-                                  Agent::policy_names(environment().agent()))
+                                  Agent::policy_names(environment().agent()),
+                                  environment().trace_format())
     {
 
     }
@@ -39,7 +40,8 @@ namespace geopm
                                                      bool is_trace_enabled,
                                                      const std::string &file_name,
                                                      PlatformIO &platform_io,
-                                                     const std::vector<std::string> &policy_names)
+                                                     const std::vector<std::string> &policy_names,
+                                                     const std::string &file_format)
         : m_is_trace_enabled(is_trace_enabled && policy_names.size() > 0)
         , m_platform_io(platform_io)
         , m_time_signal(-1)
@@ -53,7 +55,7 @@ namespace geopm
                 throw Exception("geopm_time_to_string() failed",
                                 err, __FILE__, __LINE__);
             }
-            m_csv = geopm::make_unique<CSVImp>(file_name, "", time_cstr, buffer_size);
+            m_csv = CSV::make_unique(file_name, "", time_cstr, buffer_size, file_format);
 
             m_csv->add_column("timestamp", "double");
             for (const auto &col : policy_names) {
@@ -24,7 +24,8 @@ namespace geopm
                                     bool is_trace_enabled,
                                     const std::string &file_name,
                                     PlatformIO &platform_io,
-                                    const std::vector<std::string> &policy_names);
+                                    const std::vector<std::string> &policy_names,
+                                    const std::string &file_format = "csv");
             virtual ~EndpointPolicyTracerImp();
             void update(const std::vector<double> &policy);
         private:
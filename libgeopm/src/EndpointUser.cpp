@@ -97,6 +97,7 @@ namespace geopm
         }
         data->hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX -1] = '\0';
         strncpy(data->hostlist_path, m_hostlist_path.c_str(), GEOPM_ENDPOINT_HOSTLIST_PATH_MAX - 1);
+        EndpointImp::notify_agent_change(data);
     }
 
     EndpointUserImp::~EndpointUserImp()
@@ -107,6 +108,7 @@ namespace geopm
         data->agent[0] = '\0';
         data->profile_name[0] = '\0';
         data->hostlist_path[0] = '\0';
+        EndpointImp::notify_agent_change(data);
         unlink(m_hostlist_path.c_str());
     }
 
@@ -118,6 +118,7 @@ namespace geopm
                 "GEOPM_ENDPOINT",
                 "GEOPM_AGENT",
                 "GEOPM_TRACE",
+                "GEOPM_TRACE_FORMAT",
                 "GEOPM_TRACE_SIGNALS",
                 "GEOPM_TRACE_PROFILE",
                 "GEOPM_TRACE_ENDPOINT_POLICY",
@@ -126,11 +127,13 @@ namespace geopm
                 "GEOPM_PROFILE",
                 "GEOPM_FREQUENCY_MAP",
                 "GEOPM_MAX_FAN_OUT",
+                "GEOPM_TREE_COMM_LOCK",
                 "GEOPM_OMPT_ENABLE",
                 "GEOPM_OMPT_DISABLE",
                 "GEOPM_RECORD_FILTER",
                 "GEOPM_INIT_CONTROL",
                 "GEOPM_PERIOD",
+                "GEOPM_WAIT_STRATEGY",
                 "GEOPM_NUM_PROC",
                 "GEOPM_PROGRAM_FILTER",
                 "GEOPM_CTL_LOCAL"};
@@ -258,11 +261,29 @@ namespace geopm
         return result;
     }
 
+    std::string EnvironmentImp::wait_strategy(void) const
+    {
+        std::string result = lookup("GEOPM_WAIT_STRATEGY");
+        if (result.empty()) {
+            result = "sleep";
+        }
+        return result;
+    }
+
     std::string EnvironmentImp::trace(void) const
     {
         return lookup("GEOPM_TRACE");
     }
 
+    std::string EnvironmentImp::trace_format(void) const
+    {
+        std::string result = lookup("GEOPM_TRACE_FORMAT");
+        if (result.empty()) {
+            result = "csv";
+        }
+        return result;
+    }
+
     std::string EnvironmentImp::trace_profile(void) const
     {
         return lookup("GEOPM_TRACE_PROFILE");
@@ -329,6 +350,15 @@ namespace geopm
         return result;
     }
 
+    std::string EnvironmentImp::tree_comm_lock(void) const
+    {
+        std::string result = lookup("GEOPM_TREE_COMM_LOCK");
+        if (result.empty()) {
+            result = "lock";
+        }
+        return result;
+    }
+
     int EnvironmentImp::pmpi_ctl(void) const
     {
         int ret = Environment::M_CTL_NONE;
@@ -54,7 +54,8 @@ namespace geopm
 
     FFNetAgent::FFNetAgent()
         : FFNetAgent(platform_io(), platform_topo(), {}, {},
-                     Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                     Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                         environment().wait_strategy()))
     {
 
     }
@@ -103,6 +104,19 @@ namespace geopm
                                                                   domain_key.index));
             }
         }
+
+        for (geopm_domain_e domain_type : m_domain_types) {
+            m_batch_s batch;
+            for (const m_domain_key_s domain_key : m_domains) {
+                if (domain_key.type == domain_type) {
+                    batch.net_map.push_back(m_net_map.at(domain_key));
+                }
+            }
+            if (!batch.net_map.empty()) {
+                batch.input.resize(batch.net_map.size() * batch.net_map[0]->input_dim());
+                m_batch.push_back(std::move(batch));
+            }
+        }
     }
 
     void FFNetAgent::init_domain_indices(const PlatformTopo &topo) {
@@ -235,8 +249,16 @@ namespace geopm
     // Read signals from the platform and calculate samples to be sent up
     void FFNetAgent::sample_platform(std::vector<double> &out_sample)
     {
-        for (auto &kv : m_net_map) {
-            kv.second->sample();
+        // Evaluate the neural net once per domain type with the
+        // inputs of every domain of that type as a batch.
+        for (auto &batch : m_batch) {
+            for (size_t batch_idx = 0; batch_idx < batch.net_map.size(); ++batch_idx) {
+                batch.net_map[batch_idx]->sample_input(batch.input, batch_idx);
+            }
+            batch.net_map[0]->forward_batch(batch.input, batch.net_map.size(), batch.output);
+            for (size_t batch_idx = 0; batch_idx < batch.net_map.size(); ++batch_idx) {
+                batch.net_map[batch_idx]->set_output(batch.output, batch_idx);
+            }
         }
     }
 
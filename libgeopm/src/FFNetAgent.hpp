@@ -83,6 +83,13 @@ namespace geopm
                 int min_idx;
                 double last_value;
             };
+            // Neural net inputs and outputs for all domains of one
+            // type, which share a neural net file.
+            struct m_batch_s {
+                std::vector<std::shared_ptr<DomainNetMap> > net_map;
+                std::vector<double> input;
+                std::vector<double> output;
+            };
 
             static bool is_all_nan(const std::vector<double> &vec);
             static std::string get_env_value(const std::string &env_var);
@@ -96,6 +103,7 @@ namespace geopm
 
             double m_perf_energy_bias;
             std::map<m_domain_key_s, std::shared_ptr<DomainNetMap> > m_net_map;
+            std::vector<m_batch_s> m_batch;
             std::map<geopm_domain_e, std::shared_ptr<RegionHintRecommender> > m_freq_recommender;
 
             std::map<m_domain_key_s, m_control_s> m_freq_control;
@@ -30,7 +30,8 @@ namespace geopm
 {
     FrequencyMapAgent::FrequencyMapAgent()
         : FrequencyMapAgent(PlatformIOProf::platform_io(), platform_topo(),
-                            Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                            Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                                environment().wait_strategy()))
     {
 
     }
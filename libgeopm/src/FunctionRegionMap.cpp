@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "FunctionRegionMap.hpp"
+
+#include "geopm_hash.h"
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    FunctionRegionMap::FunctionRegionMap()
+        : FunctionRegionMap(64)
+    {
+
+    }
+
+    FunctionRegionMap::FunctionRegionMap(size_t capacity)
+        : m_table(nullptr)
+        , m_size(0)
+    {
+        // Keep the table at most half full so that probes are short
+        size_t num_slot = 2;
+        while (num_slot < 2 * capacity) {
+            num_slot *= 2;
+        }
+        m_all_table.push_back(make_table(num_slot));
+        m_table.store(m_all_table.back().get(), std::memory_order_release);
+    }
+
+    std::unique_ptr<FunctionRegionMap::m_table_s> FunctionRegionMap::make_table(size_t num_slot)
+    {
+        std::unique_ptr<m_table_s> result(new m_table_s);
+        result->mask = num_slot - 1;
+        result->slot.reset(new m_slot_s[num_slot]);
+        for (size_t slot_idx = 0; slot_idx != num_slot; ++slot_idx) {
+            result->slot[slot_idx].function_addr.store(0, std::memory_order_relaxed);
+            result->slot[slot_idx].region_id.store(GEOPM_REGION_HASH_UNMARKED, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    size_t FunctionRegionMap::hash(size_t function_addr)
+    {
+        // Fibonacci hashing: the high bits of the product depend on
+        // all bits of the address, and are moved to the low bits.
+        uint64_t product = (uint64_t)function_addr * 0x9E3779B97F4A7C15ULL;
+        return product ^ (product >> 32);
+    }
+
+    uint64_t FunctionRegionMap::find(size_t function_addr) const
+    {
+        uint64_t result = GEOPM_REGION_HASH_UNMARKED;
+        const m_table_s *table = m_table.load(std::memory_order_acquire);
+        for (size_t slot_idx = hash(function_addr) & table->mask; ;
+             slot_idx = (slot_idx + 1) & table->mask) {
+            const m_slot_s &slot = table->slot[slot_idx];
+            size_t slot_addr = slot.function_addr.load(std::memory_order_acquire);
+            if (slot_addr == function_addr) {
+                result = slot.region_id.load(std::memory_order_relaxed);
+                break;
+            }
+            if (slot_addr == 0) {
+                break;
+            }
+        }
+        return result;
+    }
+
+    bool FunctionRegionMap::insert_slot(m_table_s &table, size_t function_addr, uint64_t region_id)
+    {
+        bool result = false;
+        for (size_t slot_idx = hash(function_addr) & table.mask; ;
+             slot_idx = (slot_idx + 1) & table.mask) {
+            m_slot_s &slot = table.slot[slot_idx];
+            size_t slot_addr = slot.function_addr.load(std::memory_order_relaxed);
+            if (slot_addr == function_addr || slot_addr == 0) {
+                result = (slot_addr == 0);
+                // The region ID is visible to any reader that sees
+                // the address stored after it.
+                slot.region_id.store(region_id, std::memory_order_relaxed);
+                slot.function_addr.store(function_addr, std::memory_order_release);
+                break;
+            }
+        }
+        return result;
+    }
+
+    void FunctionRegionMap::insert(size_t function_addr, uint64_t region_id)
+    {
+        if (function_addr == 0) {
+            throw Exception("FunctionRegionMap::insert(): function address must not be zero",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::lock_guard<std::mutex> lock(m_insert_mutex);
+        m_table_s *table = m_all_table.back().get();
+        size_t num_slot = table->mask + 1;
+        if (2 * (m_size + 1) > num_slot) {
+            // Copy into a table twice the size and publish it once it
+            // is complete.
+            m_all_table.push_back(make_table(2 * num_slot));
+            m_table_s *new_table = m_all_table.back().get();
+            for (size_t slot_idx = 0; slot_idx != num_slot; ++slot_idx) {
+                const m_slot_s &slot = table->slot[slot_idx];
+                size_t slot_addr = slot.function_addr.load(std::memory_order_relaxed);
+                if (slot_addr != 0) {
+                    insert_slot(*new_table, slot_addr,
+                                slot.region_id.load(std::memory_order_relaxed));
+                }
+            }
+            table = new_table;
+            m_table.store(table, std::memory_order_release);
+        }
+        if (insert_slot(*table, function_addr, region_id)) {
+            ++m_size;
+        }
+    }
+
+    size_t FunctionRegionMap::size(void) const
+    {
+        std::lock_guard<std::mutex> lock(m_insert_mutex);
+        return m_size;
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FUNCTIONREGIONMAP_HPP_INCLUDE
+#define FUNCTIONREGIONMAP_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Map from function address to geopm region ID that may
+    ///        be read concurrently with updates.
+    ///
+    /// The map is an open addressing hash table with linear probing.
+    /// Lookups do not take a lock.  Insertions are serialized by a
+    /// mutex and are expected to be rare: once for each function.
+    /// When the table grows, the previous table is kept until the
+    /// map is destroyed so that concurrent lookups remain valid.
+    class FunctionRegionMap
+    {
+        public:
+            FunctionRegionMap();
+            /// @param [in] capacity Number of functions that can be
+            ///        inserted before the table grows.
+            FunctionRegionMap(size_t capacity);
+            FunctionRegionMap(const FunctionRegionMap &other) = delete;
+            FunctionRegionMap &operator=(const FunctionRegionMap &other) = delete;
+            virtual ~FunctionRegionMap() = default;
+            /// @brief Look up the region ID of a function.
+            /// @param [in] function_addr Address of the function.
+            /// @return The region ID inserted for the function, or
+            ///         GEOPM_REGION_HASH_UNMARKED if there is none.
+            uint64_t find(size_t function_addr) const;
+            /// @brief Set the region ID of a function.
+            /// @param [in] function_addr Address of the function;
+            ///        must not be zero.
+            /// @param [in] region_id Region ID of the function.
+            void insert(size_t function_addr, uint64_t region_id);
+            /// @brief Get the number of functions in the map.
+            /// @return Number of functions.
+            size_t size(void) const;
+        private:
+            struct m_slot_s {
+                // Zero if the slot is empty
+                std::atomic<size_t> function_addr;
+                std::atomic<uint64_t> region_id;
+            };
+            struct m_table_s {
+                size_t mask;
+                std::unique_ptr<m_slot_s[]> slot;
+            };
+            static std::unique_ptr<m_table_s> make_table(size_t num_slot);
+            static size_t hash(size_t function_addr);
+            // Returns true if the function was not already in the table
+            static bool insert_slot(m_table_s &table, size_t function_addr, uint64_t region_id);
+            std::atomic<const m_table_s *> m_table;
+            // Every table that has been published, including those
+            // replaced by growth
+            std::vector<std::unique_ptr<m_table_s> > m_all_table;
+            mutable std::mutex m_insert_mutex;
+            size_t m_size;
+    };
+}
+
+#endif
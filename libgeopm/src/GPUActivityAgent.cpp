@@ -27,7 +27,8 @@ namespace geopm
 
     GPUActivityAgent::GPUActivityAgent()
         : GPUActivityAgent(PlatformIOProf::platform_io(), platform_topo(),
-                           Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                           Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                               environment().wait_strategy()))
     {
 
     }
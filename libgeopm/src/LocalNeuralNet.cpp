@@ -10,6 +10,10 @@
 #include "DenseLayer.hpp"
 #include "LocalNeuralNetImp.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 
@@ -38,6 +42,10 @@ namespace geopm
         }
 
         m_layers = std::move(layers);
+        m_max_hidden_dim = 0;
+        for (size_t idx = 0; idx + 1 < m_layers.size(); ++idx) {
+            m_max_hidden_dim = std::max(m_max_hidden_dim, m_layers[idx]->get_output_dim());
+        }
     }
 
     TensorOneD LocalNeuralNetImp::forward(const TensorOneD &inp) const
@@ -62,6 +70,49 @@ namespace geopm
         return tmp;
     }
 
+    void LocalNeuralNetImp::forward_batch(const std::vector<double> &input,
+                                          size_t num_batch,
+                                          std::vector<double> &output)
+    {
+        if (input.size() < num_batch * get_input_dim()) {
+            throw Exception("LocalNeuralNetImp::" + std::string(__func__) +
+                            ": Input batch size is incompatible with network.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+
+        size_t hidden_size = num_batch * m_max_hidden_dim;
+        if (m_hidden[0].size() < hidden_size) {
+            m_hidden[0].resize(hidden_size);
+            m_hidden[1].resize(hidden_size);
+        }
+        output.resize(num_batch * get_output_dim());
+
+        const double *layer_in = input.data();
+        for (size_t idx = 0; idx < m_layers.size(); ++idx) {
+            if (idx == m_layers.size() - 1) {
+                m_layers[idx]->forward_batch(layer_in, num_batch, output.data());
+            }
+            else {
+                double *layer_out = m_hidden[idx % 2].data();
+                m_layers[idx]->forward_batch(layer_in, num_batch, layer_out);
+                // Apply a sigmoid on all but the last layer, matching
+                // TensorMathImp::sigmoid()
+                size_t out_size = num_batch * m_layers[idx]->get_output_dim();
+                for (size_t out_idx = 0; out_idx < out_size; ++out_idx) {
+                    double retval = exp(-layer_out[out_idx]);
+                    if (retval == HUGE_VAL) {
+                        errno = 0;
+                        layer_out[out_idx] = 0;
+                    }
+                    else {
+                        layer_out[out_idx] = 1 / (1 + retval);
+                    }
+                }
+                layer_in = layer_out;
+            }
+        }
+    }
+
     size_t LocalNeuralNetImp::get_input_dim() const {
         return m_layers[0]->get_input_dim();
     }
@@ -35,6 +35,26 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             virtual TensorOneD forward(const TensorOneD &inp) const = 0;
+            /// @brief Perform inference on a batch of inputs as one
+            ///        matrix product per layer.  Buffers for the
+            ///        intermediate layers are kept by the object, so
+            ///        memory is only allocated when num_batch grows.
+            ///
+            /// @param [in] input Vector of num_batch input vectors
+            ///        stored one after another, each with
+            ///        get_input_dim() values.
+            ///
+            /// @param [in] num_batch Number of input vectors.
+            ///
+            /// @param [out] output Resized to hold num_batch output
+            ///        vectors stored one after another, each with
+            ///        get_output_dim() values.
+            ///
+            /// @throws geopm::Exception if input size is incompatible
+            /// with network.
+            virtual void forward_batch(const std::vector<double> &input,
+                                       size_t num_batch,
+                                       std::vector<double> &output) = 0;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -8,6 +8,9 @@
 
 #include "LocalNeuralNet.hpp"
 
+#include <array>
+#include <vector>
+
 namespace geopm
 {
     class LocalNeuralNetImp : public LocalNeuralNet
@@ -29,6 +32,19 @@ namespace geopm
             ///
             /// @return Returns a TensorOneD vector of output values.
             TensorOneD forward(const TensorOneD &inp) const override;
+            /// @brief Perform inference on a batch of inputs.
+            ///
+            /// @param [in] input Vector of num_batch input vectors.
+            ///
+            /// @param [in] num_batch Number of input vectors.
+            ///
+            /// @param [out] output Vector of num_batch output vectors.
+            ///
+            /// @throws geopm::Exception if input size is incompatible
+            /// with network.
+            void forward_batch(const std::vector<double> &input,
+                               size_t num_batch,
+                               std::vector<double> &output) override;
             /// @brief Get the dimension required for the input TensorOneD
             /// 
             /// @return Returns a size_t equal to the number of columns of weights
@@ -40,6 +56,10 @@ namespace geopm
 
         private:
             std::vector<std::shared_ptr<DenseLayer> > m_layers;
+            // Largest output dimension of the layers before the last
+            size_t m_max_hidden_dim;
+            // Outputs of alternating hidden layers in forward_batch()
+            std::array<std::vector<double>, 2> m_hidden;
     };
 }
 
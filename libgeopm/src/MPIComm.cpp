@@ -27,6 +27,8 @@ namespace geopm
             CommWindow &operator=(const CommWindow &other) = delete;
             void lock(bool is_exclusive, int rank, int assert);
             void unlock(int rank);
+            void lock_all(int assert);
+            void unlock_all(void);
             void put(const void *send_buf, size_t send_size, int rank, off_t disp);
 #ifndef GEOPM_TEST
         private:
@@ -291,6 +293,18 @@ namespace geopm
         ((CommWindow *) window_id)->unlock(rank);
     }
 
+    void MPIComm::window_lock_all(size_t window_id, int assert) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->lock_all(assert);
+    }
+
+    void MPIComm::window_unlock_all(size_t window_id) const
+    {
+        check_window(window_id);
+        ((CommWindow *) window_id)->unlock_all();
+    }
+
     void MPIComm::coordinate(int rank, std::vector<int> &coord) const
     {
         size_t in_size = coord.size();
@@ -402,6 +416,16 @@ namespace geopm
         check_mpi(PMPI_Win_unlock(rank, m_window));
     }
 
+    void CommWindow::lock_all(int assert)
+    {
+        check_mpi(PMPI_Win_lock_all(assert, m_window));
+    }
+
+    void CommWindow::unlock_all(void)
+    {
+        check_mpi(PMPI_Win_unlock_all(m_window));
+    }
+
     void CommWindow::put(const void *send_buf, size_t send_size, int rank, off_t disp)
     {
         check_mpi(PMPI_Put(GEOPM_MPI_CONST_CAST(void *)(send_buf), send_size, MPI_BYTE, rank, disp,
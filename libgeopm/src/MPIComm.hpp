@@ -58,6 +58,8 @@ namespace geopm
             virtual std::vector<int> coordinate(int rank) const override;
             virtual void window_lock(size_t window_id, bool is_exclusive, int rank, int assert) const override;
             virtual void window_unlock(size_t window_id, int rank) const override;
+            virtual void window_lock_all(size_t window_id, int assert) const override;
+            virtual void window_unlock_all(size_t window_id) const override;
             virtual void barrier(void) const override;
             virtual void broadcast(void *buffer, size_t size, int root) const override;
             virtual bool test(bool is_true) const override;
@@ -17,7 +17,8 @@ namespace geopm
 {
     MonitorAgent::MonitorAgent()
         : MonitorAgent(PlatformIOProf::platform_io(), platform_topo(),
-                       Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                       Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                           environment().wait_strategy()))
     {
 
     }
@@ -5,7 +5,6 @@
 
 #include <cstdint>
 #include <string>
-#include <map>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
@@ -17,6 +16,7 @@
 #include "geopm_error.h"
 #include "geopm/Profile.hpp"
 #include "ELF.hpp"
+#include "FunctionRegionMap.hpp"
 #include "geopm/Environment.hpp"
 #include "geopm/Exception.hpp"
 #include "OMPT.hpp"
@@ -45,7 +45,7 @@ namespace geopm
             std::string region_name(const void *function_ptr);
         private:
             /// Map from function address to geopm region ID
-            std::map<size_t, uint64_t> m_function_region_id_map;
+            FunctionRegionMap m_function_region_id_map;
             bool m_do_ompt;
     };
 
@@ -75,19 +75,15 @@ namespace geopm
     uint64_t OMPTImp::region_id(const void *parallel_function)
     {
         size_t target = (size_t) parallel_function;
-        uint64_t result = GEOPM_REGION_HASH_UNMARKED;
-        auto it = m_function_region_id_map.find(target);
-        if (m_function_region_id_map.end() != it) {
-            result = it->second;
-        }
-        else {
+        uint64_t result = m_function_region_id_map.find(target);
+        if (result == GEOPM_REGION_HASH_UNMARKED) {
             std::string rn = region_name(parallel_function);
             int err = geopm_prof_region(rn.c_str(), GEOPM_REGION_HINT_UNKNOWN, &result);
             if (err) {
                 result = GEOPM_REGION_HASH_UNMARKED;
             }
-            else {
-                m_function_region_id_map.insert(std::pair<size_t, uint64_t>(target, result));
+            else if (target != 0) {
+                m_function_region_id_map.insert(target, result);
             }
         }
         return result;
@@ -585,7 +585,8 @@ namespace geopm
                              {},
                              PlatformIOProf::platform_io().read_signal("CPU_POWER_MIN_AVAIL", GEOPM_DOMAIN_PACKAGE, 0),
                              PlatformIOProf::platform_io().read_signal("CPU_POWER_MAX_AVAIL", GEOPM_DOMAIN_PACKAGE, 0),
-                             Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                             Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                                 environment().wait_strategy()))
     {
 
     }
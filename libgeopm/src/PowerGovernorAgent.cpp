@@ -23,7 +23,8 @@ namespace geopm
 {
     PowerGovernorAgent::PowerGovernorAgent()
         : PowerGovernorAgent(PlatformIOProf::platform_io(), nullptr,
-                             Waiter::make_unique(environment().period(M_WAIT_SEC)))
+                             Waiter::make_unique(environment().period(M_WAIT_SEC),
+                                                 environment().wait_strategy()))
     {
 
     }
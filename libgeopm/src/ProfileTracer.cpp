@@ -34,7 +34,8 @@ namespace geopm
                            environment().do_trace_profile(),
                            environment().trace_profile(),
                            hostname(),
-                           ApplicationSampler::application_sampler())
+                           ApplicationSampler::application_sampler(),
+                           environment().trace_format())
     {
 
     }
@@ -45,13 +46,14 @@ namespace geopm
                                        bool is_trace_enabled,
                                        const std::string &file_name,
                                        const std::string &host_name,
-                                       ApplicationSampler& application_sampler)
+                                       ApplicationSampler& application_sampler,
+                                       const std::string &file_format)
         : m_is_trace_enabled(is_trace_enabled)
         , m_time_zero(time_zero)
     {
         m_application_sampler = &application_sampler;
         if (m_is_trace_enabled) {
-            m_csv = geopm::make_unique<CSVImp>(file_name, host_name, start_time, buffer_size);
+            m_csv = CSV::make_unique(file_name, host_name, start_time, buffer_size, file_format);
 
             m_csv->add_column("TIME", "double");
             m_csv->add_column("PROCESS", "integer");
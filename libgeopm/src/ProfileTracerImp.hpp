@@ -26,7 +26,8 @@ namespace geopm
                              bool is_trace_enabled,
                              const std::string &file_name,
                              const std::string &host_name,
-                             ApplicationSampler& application_sampler = ApplicationSampler::application_sampler());
+                             ApplicationSampler& application_sampler = ApplicationSampler::application_sampler(),
+                             const std::string &file_format = "csv");
             virtual ~ProfileTracerImp();
             void update(const std::vector<record_s> &records);
          private:
@@ -85,6 +85,9 @@ namespace geopm
         , m_total_time(0.0)
         , m_overhead_time(0.0)
         , m_sample_delay(0.0)
+        , m_loop_period_mean(NAN)
+        , m_loop_period_std(NAN)
+        , m_loop_period_max(NAN)
         , m_profile_name(profile_name)
         , m_do_ctl_local(do_ctl_local)
     {
@@ -148,6 +151,13 @@ namespace geopm
         m_sample_delay = sample_delay;
     }
 
+    void ReporterImp::loop_period(double mean, double std_dev, double max)
+    {
+        m_loop_period_mean = mean;
+        m_loop_period_std = std_dev;
+        m_loop_period_max = max;
+    }
+
     void ReporterImp::generate(const std::string &agent_name,
                                const std::vector<std::pair<std::string, std::string> > &agent_report_header,
                                const std::vector<std::pair<std::string, std::string> > &agent_host_report,
@@ -346,6 +356,12 @@ namespace geopm
             {"geopmctl memory HWM (B)", max_memory},
             {"geopmctl network BW (B/s)", comm_overhead / m_total_time}
         };
+        if (!std::isnan(m_loop_period_mean)) {
+            overhead.insert(overhead.begin() + 2,
+                            {{"GEOPM loop period mean (s)", m_loop_period_mean},
+                             {"GEOPM loop period std (s)", m_loop_period_std},
+                             {"GEOPM loop period max (s)", m_loop_period_max}});
+        }
         if (mpi_startup != 0.0) {
             overhead.insert(overhead.begin(),
                             {"MPI startup (s)", mpi_startup});
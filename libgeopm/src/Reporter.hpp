@@ -76,6 +76,15 @@ namespace geopm
                                          const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report) = 0;
             virtual void total_time(double total) = 0;
             virtual void overhead(double overhead_sec, double sample_delay) = 0;
+            /// @brief Set statistics of the control loop period
+            ///        measured between consecutive returns from
+            ///        Agent::wait().  These are added to the host
+            ///        section of the report when set.
+            /// @param [in] mean Average period in seconds.
+            /// @param [in] std_dev Standard deviation of the period
+            ///             in seconds, i.e. the loop jitter.
+            /// @param [in] max Longest period in seconds.
+            virtual void loop_period(double mean, double std_dev, double max) = 0;
     };
 
     class PlatformIO;
@@ -119,6 +128,7 @@ namespace geopm
                                  const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report) override;
             void total_time(double total) override;
             void overhead(double overhead_sec, double sample_delay) override;
+            void loop_period(double mean, double std_dev, double max) override;
 
         private:
             /// @brief number of spaces for each indentation
@@ -197,6 +207,9 @@ namespace geopm
             double m_total_time;
             double m_overhead_time;
             double m_sample_delay;
+            double m_loop_period_mean;
+            double m_loop_period_std;
+            double m_loop_period_max;
             const std::string m_profile_name;
             bool m_do_ctl_local;
     };
@@ -35,6 +35,7 @@ namespace geopm
         , m_is_updated(false)
         , m_period_duration(0.0)
         , m_period_last(0)
+        , m_region_slot(64, -1)
     {
 
     }
@@ -86,6 +87,7 @@ namespace geopm
         }
         auto signal_it = m_sum_signal.find(result);
         if (signal_it == m_sum_signal.end()) {
+            size_t accum_idx = m_sum_signal.size();
             m_sum_signal[result] = {
                 NAN,
                 m_platform_io.push_signal("REGION_HASH", domain_type, domain_idx),
@@ -95,8 +97,8 @@ namespace geopm
                 SumAccumulator::make_unique(),
                 SumAccumulator::make_unique(),
                 SumAccumulator::make_unique(),
-                {},
-                {},
+                accum_idx,
+                -1,
            };
         }
         return result;
@@ -118,6 +120,7 @@ namespace geopm
         }
         auto signal_it = m_avg_signal.find(result);
         if (signal_it == m_avg_signal.end()) {
+            size_t accum_idx = m_avg_signal.size();
             m_avg_signal[result] = {
                 NAN,
                 m_platform_io.push_signal("REGION_HASH", domain_type, domain_idx),
@@ -127,28 +130,81 @@ namespace geopm
                 AvgAccumulator::make_unique(),
                 AvgAccumulator::make_unique(),
                 AvgAccumulator::make_unique(),
-                {},
-                {},
+                accum_idx,
+                -1,
            };
         }
         return result;
     }
 
-    template<typename type>
-    typename std::map<uint64_t, std::shared_ptr<type> >::iterator
-    sample_aggregator_emplace_hash(
-        std::map<uint64_t, std::shared_ptr<type> > &hash_accum_map,
-        uint64_t hash)
+    size_t SampleAggregatorImp::region_slot(uint64_t region_hash, size_t mask)
     {
-        typename std::map<uint64_t, std::shared_ptr<type> >::iterator result;
-        result = hash_accum_map.find(hash);
-        if (result == hash_accum_map.end()) {
-            auto empl_ret = hash_accum_map.emplace(hash, type::make_unique());
-            result = empl_ret.first;
+        // Fibonacci hashing spreads the region hashes, which may
+        // differ only in their low bits, across the table.
+        uint64_t product = region_hash * 0x9E3779B97F4A7C15ULL;
+        return (product ^ (product >> 32)) & mask;
+    }
+
+    int SampleAggregatorImp::find_region(uint64_t region_hash) const
+    {
+        int result = -1;
+        size_t mask = m_region_slot.size() - 1;
+        for (size_t slot_idx = region_slot(region_hash, mask); ;
+             slot_idx = (slot_idx + 1) & mask) {
+            int region_idx = m_region_slot[slot_idx];
+            if (region_idx == -1 || m_region_hash[region_idx] == region_hash) {
+                result = region_idx;
+                break;
+            }
         }
         return result;
     }
 
+    void SampleAggregatorImp::insert_slot(int region_idx)
+    {
+        size_t mask = m_region_slot.size() - 1;
+        size_t slot_idx = region_slot(m_region_hash[region_idx], mask);
+        while (m_region_slot[slot_idx] != -1) {
+            slot_idx = (slot_idx + 1) & mask;
+        }
+        m_region_slot[slot_idx] = region_idx;
+    }
+
+    int SampleAggregatorImp::insert_region(uint64_t region_hash)
+    {
+        int result = find_region(region_hash);
+        if (result == -1) {
+            result = m_region_hash.size();
+            m_region_hash.push_back(region_hash);
+            if (2 * m_region_hash.size() > m_region_slot.size()) {
+                // Keep the table at most half full so that probes are
+                // short: double its size and reinsert every region.
+                m_region_slot.assign(2 * m_region_slot.size(), -1);
+                for (int region_idx = 0; region_idx != result; ++region_idx) {
+                    insert_slot(region_idx);
+                }
+            }
+            insert_slot(result);
+            size_t num_region = m_region_hash.size();
+            m_sum_region_accum.resize(num_region * m_sum_signal.size());
+            m_avg_region_accum.resize(num_region * m_avg_signal.size());
+            m_avg_region_is_sampled.resize(num_region * m_avg_signal.size(), false);
+        }
+        return result;
+    }
+
+    SumAccumulatorImp &SampleAggregatorImp::region_accum(const m_sum_signal_s &signal)
+    {
+        return m_sum_region_accum[signal.region_idx_last * m_sum_signal.size() +
+                                  signal.accum_idx];
+    }
+
+    AvgAccumulatorImp &SampleAggregatorImp::region_accum(const m_avg_signal_s &signal)
+    {
+        return m_avg_region_accum[signal.region_idx_last * m_avg_signal.size() +
+                                  signal.accum_idx];
+    }
+
     template <typename type>
     void sample_aggregator_update_epoch(type &signal, int epoch_count)
     {
@@ -162,24 +218,24 @@ namespace geopm
         }
     }
 
-    template <typename type>
-    void sample_aggregator_update_hash_exit(type &signal, uint64_t hash)
+    template <typename type, typename accum_type>
+    void sample_aggregator_update_hash_exit(type &signal, accum_type &region_accum, uint64_t hash)
     {
         if (signal.region_hash_last != hash) {
             // If we have exited a valid region, call exit()
             if (signal.region_hash_last != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->exit();
+                region_accum.exit();
             }
         }
     }
 
-    template <typename type>
-    void sample_aggregator_update_hash_enter(type &signal, uint64_t hash)
+    template <typename type, typename accum_type>
+    void sample_aggregator_update_hash_enter(type &signal, accum_type &region_accum, uint64_t hash)
     {
         if (signal.region_hash_last != hash) {
             // If we have entered a valid region, call enter()
             if (hash != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->enter();
+                region_accum.enter();
             }
         }
     }
@@ -236,7 +292,7 @@ namespace geopm
                 signal.sample_last = sample;
                 signal.region_hash_last = hash;
                 signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                signal.region_idx_last = insert_region(hash);
             }
             else {
                 if (std::isnan(sample)) {
@@ -256,13 +312,13 @@ namespace geopm
                 // Update the periodic totals
                 signal.period_accum->update(delta);
                 // Update region totals
-                signal.region_accum_it->second->update(delta);
+                region_accum(signal).update(delta);
                 sample_aggregator_update_epoch(signal, epoch_count);
-                sample_aggregator_update_hash_exit(signal, hash);
+                sample_aggregator_update_hash_exit(signal, region_accum(signal), hash);
                 if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                    signal.region_idx_last = insert_region(hash);
                 }
-                sample_aggregator_update_hash_enter(signal, hash);
+                sample_aggregator_update_hash_enter(signal, region_accum(signal), hash);
                 if (period != m_period_last) {
                     sample_aggregator_update_period(signal, period);
                 }
@@ -288,7 +344,9 @@ namespace geopm
                 signal.time_last = 0.0;
                 signal.region_hash_last = hash;
                 signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                signal.region_idx_last = insert_region(hash);
+                m_avg_region_is_sampled[signal.region_idx_last * m_avg_signal.size() +
+                                        signal.accum_idx] = true;
             }
             else {
                 // Measure the time change since the last update
@@ -302,14 +360,16 @@ namespace geopm
                 // Update the periodic totals
                 signal.period_accum->update(delta, sample);
                 // Update region totals
-                signal.region_accum_it->second->update(delta, sample);
+                region_accum(signal).update(delta, sample);
 
                 sample_aggregator_update_epoch(signal, epoch_count);
-                sample_aggregator_update_hash_exit(signal, hash);
+                sample_aggregator_update_hash_exit(signal, region_accum(signal), hash);
                 if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                    signal.region_idx_last = insert_region(hash);
+                    m_avg_region_is_sampled[signal.region_idx_last * m_avg_signal.size() +
+                                            signal.accum_idx] = true;
                 }
-                sample_aggregator_update_hash_enter(signal, hash);
+                sample_aggregator_update_hash_enter(signal, region_accum(signal), hash);
                 if (period != m_period_last) {
                     sample_aggregator_update_period(signal, period);
                 }
@@ -381,19 +441,20 @@ namespace geopm
     {
         double result = NAN;
         auto sum_it = m_sum_signal.find(signal_idx);
+        int region_idx = find_region(region_hash);
         if (sum_it != m_sum_signal.end()) {
-            const auto &region_accum = sum_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it == region_accum.end()) {
+            if (region_idx == -1) {
                 result = 0.0;
             }
             else {
-                auto accum_ptr = region_accum_it->second;
+                const SumAccumulatorImp &accum =
+                    m_sum_region_accum[region_idx * m_sum_signal.size() +
+                                       sum_it->second.accum_idx];
                 if (is_last) {
-                    result = accum_ptr->interval_total();
+                    result = accum.interval_total();
                 }
                 else {
-                    result = accum_ptr->total();
+                    result = accum.total();
                 }
             }
         }
@@ -403,15 +464,17 @@ namespace geopm
                 throw Exception("SampleAggregator::sample_region(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            const auto &region_accum = avg_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it != region_accum.end()) {
-                auto accum_ptr = region_accum_it->second;
+            if (region_idx != -1 &&
+                m_avg_region_is_sampled[region_idx * m_avg_signal.size() +
+                                        avg_it->second.accum_idx]) {
+                const AvgAccumulatorImp &accum =
+                    m_avg_region_accum[region_idx * m_avg_signal.size() +
+                                       avg_it->second.accum_idx];
                 if (is_last) {
-                    result = accum_ptr->interval_average();
+                    result = accum.interval_average();
                 }
                 else {
-                    result = accum_ptr->average();
+                    result = accum.average();
                 }
             }
         }
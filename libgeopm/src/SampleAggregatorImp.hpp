@@ -9,14 +9,14 @@
 #include <cmath>
 
 #include <map>
+#include <vector>
 
 #include "geopm/SampleAggregator.hpp"
+#include "Accumulator.hpp"
 
 namespace geopm
 {
     class PlatformIO;
-    class SumAccumulator;
-    class AvgAccumulator;
 
     class SampleAggregatorImp : public SampleAggregator
     {
@@ -61,10 +61,10 @@ namespace geopm
                 std::shared_ptr<SumAccumulator> epoch_accum;
                 // Accumulator for periodic totals (always updated)
                 std::shared_ptr<SumAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> >::iterator region_accum_it;
+                // Column of the signal in the region accumulator array
+                size_t accum_idx;
+                // Region index of region_hash_last
+                int region_idx_last;
             };
 
             // All of the data relating to each pushed "average" signal
@@ -85,10 +85,10 @@ namespace geopm
                 std::shared_ptr<AvgAccumulator> epoch_accum;
                 // Accumulator for periodic totals (always updated)
                 std::shared_ptr<AvgAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> >::iterator region_accum_it;
+                // Column of the signal in the region accumulator array
+                size_t accum_idx;
+                // Region index of region_hash_last
+                int region_idx_last;
             };
 
             void update_total(void);
@@ -96,6 +96,17 @@ namespace geopm
             double sample_epoch_helper(int signal_idx, bool is_last);
             double sample_region_helper(int signal_idx, uint64_t region_hash, bool is_last);
             uint64_t sample_to_hash(double sample);
+            // Region index of a hash, or -1 if the hash has not been
+            // sampled
+            int find_region(uint64_t region_hash) const;
+            // Region index of a hash, inserting the hash and
+            // accumulators for all signals if it is new
+            int insert_region(uint64_t region_hash);
+            // Add an inserted region index to m_region_slot
+            void insert_slot(int region_idx);
+            static size_t region_slot(uint64_t region_hash, size_t mask);
+            SumAccumulatorImp &region_accum(const m_sum_signal_s &signal);
+            AvgAccumulatorImp &region_accum(const m_avg_signal_s &signal);
 
             PlatformIO &m_platform_io;
             // PlatformIO signal index for time of last sample
@@ -109,6 +120,19 @@ namespace geopm
             std::map<int, m_avg_signal_s> m_avg_signal;
             double m_period_duration;
             int m_period_last;
+            // Open addressing hash table from region hash to region
+            // index; -1 marks an empty slot
+            std::vector<int> m_region_slot;
+            // Region hash for each region index
+            std::vector<uint64_t> m_region_hash;
+            // Region accumulators of all pushed signals: one row for
+            // each region index and one column for each signal
+            std::vector<SumAccumulatorImp> m_sum_region_accum;
+            std::vector<AvgAccumulatorImp> m_avg_region_accum;
+            // True for each element of m_avg_region_accum where the
+            // signal has sampled the region, so that sample_region()
+            // of other regions returns NAN
+            std::vector<bool> m_avg_region_is_sampled;
     };
 }
 
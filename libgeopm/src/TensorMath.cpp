@@ -73,11 +73,10 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        std::vector<double> rval(tensor_a.get_dim());
         const auto &vec_a = tensor_a.get_data();
         const auto &vec_b = tensor_b.get_data();
 
-        return std::inner_product(vec_a.begin(), vec_a.end(), vec_b.begin(), 0);
+        return std::inner_product(vec_a.begin(), vec_a.end(), vec_b.begin(), 0.0);
     }
 
     TensorOneD TensorMathImp::sigmoid(const TensorOneD &tensor) const
@@ -107,12 +106,14 @@ namespace geopm
         }
 
         const auto &MAT = tensor_a.get_data();
+        const auto &vec_b = tensor_b.get_data();
 
-        TensorOneD rval(tensor_a.get_rows());
+        std::vector<double> rval(tensor_a.get_rows());
 
-        for (size_t idx = 0; idx < tensor_a.get_rows(); ++idx) {
-            rval[idx] = MAT[idx] * tensor_b;
+        for (size_t idx = 0; idx < rval.size(); ++idx) {
+            const auto &row = MAT[idx].get_data();
+            rval[idx] = std::inner_product(row.begin(), row.end(), vec_b.begin(), 0.0);
         }
-        return rval;
+        return TensorOneD(rval);
     }
 }
@@ -30,7 +30,8 @@ namespace geopm
     TracerImp::TracerImp(const std::string &start_time)
         : TracerImp(start_time, environment().trace(), hostname(),
                     environment().do_trace(), PlatformIOProf::platform_io(), platform_topo(),
-                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()))
+                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()),
+                    environment().trace_format())
     {
 
     }
@@ -41,19 +42,25 @@ namespace geopm
                          bool do_trace,
                          PlatformIO &platform_io,
                          const PlatformTopo &platform_topo,
-                         const std::vector<std::pair<std::string, int> > &env_column)
+                         const std::vector<std::pair<std::string, int> > &env_column,
+                         const std::string &file_format)
         : m_is_trace_enabled(do_trace)
         , m_platform_io(platform_io)
         , m_platform_topo(platform_topo)
         , m_env_column(env_column)
         , M_BUFFER_SIZE(134217728) // 128 MiB
+        , M_QUEUE_SIZE(4096)
         , m_region_hash_idx(-1)
         , m_region_hint_idx(-1)
         , m_region_progress_idx(-1)
         , m_region_runtime_idx(-1)
     {
         if (m_is_trace_enabled) {
-            m_csv = geopm::make_unique<CSVImp>(file_path, hostname, start_time, M_BUFFER_SIZE);
+            // Rows are formatted and written by a background thread so
+            // that tracing does not delay the control loop.
+            m_csv = geopm::make_unique<AsyncCSV>(
+                CSV::make_unique(file_path, hostname, start_time, M_BUFFER_SIZE, file_format),
+                M_QUEUE_SIZE);
         }
     }
 
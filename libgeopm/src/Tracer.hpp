@@ -58,7 +58,8 @@ namespace geopm
                       bool do_trace,
                       PlatformIO &platform_io,
                       const PlatformTopo &platform_topo,
-                      const std::vector<std::pair<std::string, int> > &env_column);
+                      const std::vector<std::pair<std::string, int> > &env_column,
+                      const std::string &file_format = "csv");
             /// @brief TracerImp destructor, virtual.
             virtual ~TracerImp() = default;
             void columns(const std::vector<std::string> &agent_cols,
@@ -88,6 +89,8 @@ namespace geopm
             std::vector<int> m_column_idx; // columns sampled by TracerImp
             std::vector<double> m_last_telemetry;
             const size_t M_BUFFER_SIZE;
+            /// Number of rows that may wait for the writer thread
+            const size_t M_QUEUE_SIZE;
             std::unique_ptr<CSV> m_csv;
             int m_region_hash_idx;
             int m_region_hint_idx;
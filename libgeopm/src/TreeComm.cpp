@@ -22,7 +22,8 @@ namespace geopm
     TreeCommImp::TreeCommImp(std::shared_ptr<Comm> comm,
                              int num_send_down,
                              int num_send_up)
-        : TreeCommImp(comm, fan_out(comm), 0, num_send_down, num_send_up, {})
+        : TreeCommImp(comm, fan_out(comm), 0, num_send_down, num_send_up, {},
+                      environment().tree_comm_lock())
     {
 
     }
@@ -33,6 +34,19 @@ namespace geopm
                              int num_send_down,
                              int num_send_up,
                              std::vector<std::shared_ptr<TreeCommLevel> > mock_level)
+        : TreeCommImp(comm, fan_out, num_level_ctl, num_send_down, num_send_up,
+                      std::move(mock_level), "lock")
+    {
+
+    }
+
+    TreeCommImp::TreeCommImp(std::shared_ptr<Comm> comm,
+                             const std::vector<int> &fan_out,
+                             int num_level_ctl,
+                             int num_send_down,
+                             int num_send_up,
+                             std::vector<std::shared_ptr<TreeCommLevel> > mock_level,
+                             const std::string &lock_type)
         : m_comm(comm)
         , m_fan_out(fan_out)
         , m_root_level(fan_out.size())
@@ -41,6 +55,7 @@ namespace geopm
         , m_num_node(comm->num_rank()) // Assume that comm has one rank per node
         , m_num_send_down(num_send_down)
         , m_num_send_up(num_send_up)
+        , m_lock_type(lock_type)
         , m_level_ctl(std::move(mock_level))
     {
         if (m_level_ctl.size() == 0) {
@@ -86,9 +101,9 @@ namespace geopm
         for (; level < m_max_level; ++level) {
             parent_coords[root_level - 1 - level] = 0;
             result.emplace_back(
-                std::make_shared<TreeCommLevelImp>(comm_cart->split(
-                                                   comm_cart->cart_rank(parent_coords), rank_cart),
-                                                   m_num_send_up, m_num_send_down));
+                TreeCommLevel::make_unique(comm_cart->split(
+                                           comm_cart->cart_rank(parent_coords), rank_cart),
+                                           m_num_send_up, m_num_send_down, m_lock_type));
         }
         for (; level < root_level; ++level) {
             comm_cart->split(Comm::M_SPLIT_COLOR_UNDEFINED, 0);
@@ -175,6 +190,12 @@ namespace geopm
     }
 
     std::vector<int> TreeComm::fan_out(const std::shared_ptr<Comm> &comm)
+    {
+        return fan_out(comm, environment().max_fan_out());
+    }
+
+    std::vector<int> TreeComm::fan_out(const std::shared_ptr<Comm> &comm,
+                                       int max_fan_out)
     {
         std::vector<int> fan_out;
         int num_nodes = comm->num_rank();
@@ -183,7 +204,6 @@ namespace geopm
             fan_out.resize(num_fan_out);
             fan_out[0] = num_nodes;
 
-            const int max_fan_out = environment().max_fan_out();
             while (fan_out[0] > max_fan_out && fan_out[num_fan_out - 1] != 1) {
                 ++num_fan_out;
                 fan_out.resize(num_fan_out);
@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace geopm
@@ -53,6 +54,11 @@ namespace geopm
             virtual size_t overhead_send(void) const = 0;
             /// @brief Returns the number of children at each level.
             static std::vector<int> fan_out(const std::shared_ptr<Comm> &comm);
+            /// @brief Returns the number of children at each level
+            ///        given the largest fan out allowed for any
+            ///        level.
+            static std::vector<int> fan_out(const std::shared_ptr<Comm> &comm,
+                                            int max_fan_out);
     };
 
     class TreeCommLevel;
@@ -69,6 +75,15 @@ namespace geopm
                         int num_send_down,
                         int num_send_up,
                         std::vector<std::shared_ptr<TreeCommLevel> > mock_level);
+            /// @param [in] lock_type Window synchronization used by
+            ///        each level, see TreeCommLevel::make_unique().
+            TreeCommImp(std::shared_ptr<Comm> comm,
+                        const std::vector<int> &fan_out,
+                        int num_level_ctl,
+                        int num_send_down,
+                        int num_send_up,
+                        std::vector<std::shared_ptr<TreeCommLevel> > mock_level,
+                        const std::string &lock_type);
             virtual ~TreeCommImp();
             int num_level_controlled(void) const override;
             int max_level(void) const override;
@@ -97,6 +112,7 @@ namespace geopm
             int m_num_node;
             int m_num_send_down;
             int m_num_send_up;
+            std::string m_lock_type;
             std::vector<std::shared_ptr<TreeCommLevel> > m_level_ctl;
     };
 }
@@ -11,9 +11,25 @@
 
 #include "Comm.hpp"
 #include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
 
 namespace geopm
 {
+    std::unique_ptr<TreeCommLevel> TreeCommLevel::make_unique(std::shared_ptr<Comm> comm,
+                                                              int num_send_up,
+                                                              int num_send_down,
+                                                              const std::string &lock_type)
+    {
+        if (lock_type == "lock") {
+            return geopm::make_unique<TreeCommLevelImp>(comm, num_send_up, num_send_down);
+        }
+        else if (lock_type == "lock_all") {
+            return geopm::make_unique<TreeCommLevelLockAllImp>(comm, num_send_up, num_send_down);
+        }
+        throw Exception("TreeCommLevel::make_unique(): unknown lock type: " + lock_type,
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
     TreeCommLevelImp::TreeCommLevelImp(std::shared_ptr<Comm> comm, int num_send_up, int num_send_down)
         : m_comm(comm)
         , m_size(comm->num_rank())
@@ -95,7 +111,13 @@ namespace geopm
         m_policy_mailbox[0] = is_ready;
         // Copy message to self for rank zero
         memcpy(m_policy_mailbox + 1, policy[0].data(), msg_size);
+        send_down_children(policy);
+    }
 
+    void TreeCommLevelImp::send_down_children(const std::vector<std::vector<double> > &policy)
+    {
+        size_t msg_size = sizeof(double) * m_num_send_down;
+        double is_ready = 1.0;
         for (int child_rank = 1; child_rank != m_size; ++child_rank) {
             if (policy[child_rank] != m_policy_last[child_rank]) {
                 m_comm->window_lock(m_policy_window, true, child_rank, 0);
@@ -158,7 +180,7 @@ namespace geopm
     {
         bool is_complete = false;
         if (m_rank) {
-            m_comm->window_lock(m_policy_window, false, m_rank, 0);
+            m_comm->window_lock(m_policy_window, is_policy_read_exclusive(), m_rank, 0);
         }
         if (m_policy_mailbox[0] == 1.0) {
             is_complete = true;
@@ -179,6 +201,11 @@ namespace geopm
         return m_overhead_send;
     }
 
+    bool TreeCommLevelImp::is_policy_read_exclusive(void) const
+    {
+        return false;
+    }
+
     void TreeCommLevelImp::create_window()
     {
         // Create policy window
@@ -203,4 +230,37 @@ namespace geopm
             m_sample_window = m_comm->window_create(0, NULL);
         }
     }
+
+    TreeCommLevelLockAllImp::TreeCommLevelLockAllImp(std::shared_ptr<Comm> comm, int num_send_up, int num_send_down)
+        : TreeCommLevelImp(comm, num_send_up, num_send_down)
+    {
+
+    }
+
+    void TreeCommLevelLockAllImp::send_down_children(const std::vector<std::vector<double> > &policy)
+    {
+        size_t msg_size = sizeof(double) * m_num_send_down;
+        double is_ready = 1.0;
+        bool is_locked = false;
+        for (int child_rank = 1; child_rank != m_size; ++child_rank) {
+            if (policy[child_rank] != m_policy_last[child_rank]) {
+                if (!is_locked) {
+                    m_comm->window_lock_all(m_policy_window, 0);
+                    is_locked = true;
+                }
+                m_comm->window_put(&is_ready, sizeof(double), child_rank, 0, m_policy_window);
+                m_comm->window_put(policy[child_rank].data(), msg_size, child_rank, sizeof(double), m_policy_window);
+                m_overhead_send += sizeof(double) + msg_size;
+                m_policy_last[child_rank] = policy[child_rank];
+            }
+        }
+        if (is_locked) {
+            m_comm->window_unlock_all(m_policy_window);
+        }
+    }
+
+    bool TreeCommLevelLockAllImp::is_policy_read_exclusive(void) const
+    {
+        return true;
+    }
 }
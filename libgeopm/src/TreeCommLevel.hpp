@@ -8,9 +8,12 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 namespace geopm
 {
+    class Comm;
+
     class TreeCommLevel
     {
         public:
@@ -29,10 +32,17 @@ namespace geopm
             /// @brief Returns the total number of bytes sent at this
             ///        level.
             virtual size_t overhead_send(void) const = 0;
+            /// @brief Create a level that synchronizes the RMA
+            ///        windows with the named method.
+            /// @param [in] lock_type Either "lock" for
+            ///        TreeCommLevelImp or "lock_all" for
+            ///        TreeCommLevelLockAllImp.
+            static std::unique_ptr<TreeCommLevel> make_unique(std::shared_ptr<Comm> comm,
+                                                              int num_send_up,
+                                                              int num_send_down,
+                                                              const std::string &lock_type);
     };
 
-    class Comm;
-
     class TreeCommLevelImp : public TreeCommLevel
     {
         public:
@@ -46,7 +56,13 @@ namespace geopm
             bool receive_up(std::vector<std::vector<double> > &sample) override;
             bool receive_down(std::vector<double> &policy) override;
             size_t overhead_send(void) const override;
-        private:
+        protected:
+            /// @brief Put the policy of each child whose policy
+            ///        changed into its window, one lock per child.
+            virtual void send_down_children(const std::vector<std::vector<double> > &policy);
+            /// @brief Whether a rank locks its own policy window
+            ///        exclusively to read it.
+            virtual bool is_policy_read_exclusive(void) const;
             void create_window();
             std::shared_ptr<Comm> m_comm;
             int m_size;
@@ -60,6 +76,24 @@ namespace geopm
             size_t m_num_send_up;
             size_t m_num_send_down;
     };
+
+    /// @brief Level that sends policies to all children in a single
+    ///        passive target epoch.  The root of the level acquires a
+    ///        shared lock on every rank at once rather than locking
+    ///        and unlocking the window of each child in turn, so the
+    ///        synchronization cost of send_down() does not grow with
+    ///        the fan out.  Children lock their own window
+    ///        exclusively while reading so that they do not observe
+    ///        a partially written policy.
+    class TreeCommLevelLockAllImp : public TreeCommLevelImp
+    {
+        public:
+            TreeCommLevelLockAllImp(std::shared_ptr<Comm> comm, int num_send_up, int num_send_down);
+            virtual ~TreeCommLevelLockAllImp() = default;
+        protected:
+            void send_down_children(const std::vector<std::vector<double> > &policy) override;
+            bool is_policy_read_exclusive(void) const override;
+    };
 }
 
 #endif
@@ -7,6 +7,12 @@
 #include "geopm/Waiter.hpp"
 
 #include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
 
 #include "geopm/Exception.hpp"
 #include "geopm_time.h"
@@ -14,6 +20,25 @@
 
 namespace geopm
 {
+    static void time_monotonic(geopm_time_s *time)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &(time->t));
+    }
+
+    static void sleep_monotonic(const geopm_time_s &time_target)
+    {
+        int err = 0;
+        do {
+            err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+                                  &(time_target.t), nullptr);
+        } while(err == EINTR);
+
+        if (err != 0) {
+            throw Exception("Waiter::wait(): Failed with error: ",
+                            err, __FILE__, __LINE__);
+        }
+    }
+
     std::unique_ptr<Waiter> Waiter::make_unique(double period)
     {
         return Waiter::make_unique(period, "sleep");
@@ -25,6 +50,15 @@ namespace geopm
         if (strategy == "sleep") {
             return std::make_unique<SleepWaiter>(period);
         }
+        else if (strategy == "hybrid") {
+            return std::make_unique<HybridWaiter>(period);
+        }
+        else if (strategy == "timerfd") {
+            return std::make_unique<TimerFdWaiter>(period);
+        }
+        else if (strategy == "adaptive") {
+            return std::make_unique<AdaptiveWaiter>(period);
+        }
         else {
             throw Exception("Waiter::make_unique(): Unknown strategy: " + strategy,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -74,4 +108,165 @@ namespace geopm
     {
         return m_period;
     }
+
+    HybridWaiter::HybridWaiter(double period)
+        : HybridWaiter(period, M_SPIN_MARGIN)
+    {
+
+    }
+
+    HybridWaiter::HybridWaiter(double period, double spin_margin)
+        : m_period(period)
+        , m_spin_margin(spin_margin)
+        , m_time_target({{0, 0}})
+        , m_is_first_time(true)
+    {
+
+    }
+
+    void HybridWaiter::reset(void)
+    {
+        time_monotonic(&m_time_target);
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    void HybridWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void HybridWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        geopm_time_s time_sleep;
+        geopm_time_add(&m_time_target, -std::min(m_spin_margin, m_period), &time_sleep);
+        sleep_monotonic(time_sleep);
+        geopm_time_s time_curr;
+        do {
+            time_monotonic(&time_curr);
+        } while (geopm_time_comp(&time_curr, &m_time_target));
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    double HybridWaiter::period(void) const
+    {
+        return m_period;
+    }
+
+    TimerFdWaiter::TimerFdWaiter(double period)
+        : m_period(period)
+        , m_timer_fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC))
+        , m_is_first_time(true)
+    {
+        if (m_timer_fd == -1) {
+            throw Exception("TimerFdWaiter: Failed to create timer",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    TimerFdWaiter::~TimerFdWaiter()
+    {
+        close(m_timer_fd);
+    }
+
+    void TimerFdWaiter::reset(void)
+    {
+        double period_sec = 0.0;
+        double period_frac = std::modf(m_period, &period_sec);
+        struct itimerspec timer_spec = {};
+        timer_spec.it_interval.tv_sec = (time_t)period_sec;
+        timer_spec.it_interval.tv_nsec = (long)(period_frac * 1E9);
+        if (timer_spec.it_interval.tv_sec == 0 &&
+            timer_spec.it_interval.tv_nsec == 0) {
+            // A zero value disarms the timer: use the shortest period
+            timer_spec.it_interval.tv_nsec = 1;
+        }
+        timer_spec.it_value = timer_spec.it_interval;
+        if (timerfd_settime(m_timer_fd, 0, &timer_spec, nullptr) == -1) {
+            throw Exception("TimerFdWaiter::reset(): Failed to arm timer",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    void TimerFdWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void TimerFdWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        uint64_t num_expired = 0;
+        ssize_t num_read = 0;
+        do {
+            num_read = read(m_timer_fd, &num_expired, sizeof(num_expired));
+        } while (num_read == -1 && errno == EINTR);
+
+        if (num_read != sizeof(num_expired)) {
+            throw Exception("TimerFdWaiter::wait(): Failed to read timer",
+                            num_read == -1 ? errno : GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+    }
+
+    double TimerFdWaiter::period(void) const
+    {
+        return m_period;
+    }
+
+    AdaptiveWaiter::AdaptiveWaiter(double period)
+        : m_period(period)
+        , m_lateness(0.0)
+        , m_time_target({{0, 0}})
+        , m_is_first_time(true)
+    {
+
+    }
+
+    void AdaptiveWaiter::reset(void)
+    {
+        time_monotonic(&m_time_target);
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    void AdaptiveWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void AdaptiveWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        geopm_time_s time_sleep;
+        geopm_time_add(&m_time_target, -m_lateness, &time_sleep);
+        geopm_time_s time_curr;
+        time_monotonic(&time_curr);
+        if (geopm_time_comp(&time_curr, &time_sleep)) {
+            sleep_monotonic(time_sleep);
+            time_monotonic(&time_curr);
+            // Only wake ups from a sleep measure the lateness: the
+            // loop body may overrun the period for other reasons.
+            double lateness = geopm_time_diff(&time_sleep, &time_curr);
+            m_lateness += M_LATENESS_GAIN * (lateness - m_lateness);
+            m_lateness = std::min(std::max(m_lateness, 0.0), 0.5 * m_period);
+        }
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    double AdaptiveWaiter::period(void) const
+    {
+        return m_period;
+    }
 }
@@ -3,6 +3,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <atomic>
+#include <set>
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "geopm_test.hpp"
@@ -28,13 +32,14 @@ class ApplicationRecordLogTest : public ::testing::Test
         std::shared_ptr<MockSharedMemory> m_mock_shared_memory;
         std::unique_ptr<ApplicationRecordLog> m_record_log;
         const int M_PROC_ID = 123;
+        const int M_NUM_SLOT = 4;
         std::shared_ptr<MockScheduler> m_scheduler;
         // Note time_zero is one second after 1970
 };
 
 void ApplicationRecordLogTest::SetUp()
 {
-    size_t buffer_size = ApplicationRecordLog::buffer_size();
+    size_t buffer_size = ApplicationRecordLog::buffer_size(M_NUM_SLOT);
     m_mock_shared_memory = std::make_shared<MockSharedMemory>(buffer_size);
     m_scheduler = std::make_shared<MockScheduler>();
     m_record_log.reset(new ApplicationRecordLogImp(m_mock_shared_memory, M_PROC_ID, m_scheduler));
@@ -45,7 +50,7 @@ void ApplicationRecordLogTest::SetUp()
 
 TEST_F(ApplicationRecordLogTest, bad_shmem)
 {
-    size_t buffer_size = ApplicationRecordLog::buffer_size();
+    size_t buffer_size = ApplicationRecordLog::buffer_size(0);
     std::shared_ptr<MockSharedMemory> shmem = std::make_shared<MockSharedMemory>(buffer_size - 1);
     GEOPM_EXPECT_THROW_MESSAGE(ApplicationRecordLog::make_unique(shmem),
                                GEOPM_ERROR_INVALID,
@@ -54,20 +59,29 @@ TEST_F(ApplicationRecordLogTest, bad_shmem)
 
 TEST_F(ApplicationRecordLogTest, get_sizes)
 {
-    size_t buffer = ApplicationRecordLog::buffer_size();
-    size_t record = ApplicationRecordLog::max_record();
-    size_t region = ApplicationRecordLog::max_region();
+    size_t buffer = ApplicationRecordLog::buffer_size(0);
+    size_t record = ApplicationRecordLog::max_record(buffer);
+    size_t region = ApplicationRecordLog::max_region(buffer);
     EXPECT_LT(0ULL, buffer);
     EXPECT_LT(0ULL, record);
     EXPECT_LT(0ULL, region);
     EXPECT_LT(record, region);
     EXPECT_GT(buffer, region * sizeof(geopm::short_region_s) + record * sizeof(geopm::record_s));
+    EXPECT_EQ(0, ApplicationRecordLog::num_slot(buffer));
+
+    buffer = ApplicationRecordLog::buffer_size(M_NUM_SLOT);
+    EXPECT_EQ(M_NUM_SLOT, ApplicationRecordLog::num_slot(buffer));
+    EXPECT_EQ(M_NUM_SLOT, ApplicationRecordLog::num_slot(buffer + 1));
+    EXPECT_EQ(M_NUM_SLOT - 1, ApplicationRecordLog::num_slot(buffer - 1));
+    EXPECT_EQ((M_NUM_SLOT + 1) * record, ApplicationRecordLog::max_record(buffer));
+    EXPECT_EQ((M_NUM_SLOT + 1) * region, ApplicationRecordLog::max_region(buffer));
 }
 
 TEST_F(ApplicationRecordLogTest, empty_dump)
 {
     std::vector<record_s> records;
     std::vector<short_region_s> short_regions;
+    // Only dump() takes the lock to read the shared table
     EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
         .Times(1);
     m_record_log->dump(records, short_regions);
@@ -75,34 +89,160 @@ TEST_F(ApplicationRecordLogTest, empty_dump)
     EXPECT_EQ(0ULL, short_regions.size());
 }
 
-TEST_F(ApplicationRecordLogTest, scoped_lock_test)
+TEST_F(ApplicationRecordLogTest, no_lock_test)
 {
     uint64_t hash = 0x1234abcd;
     geopm_time_s time = {{2, 0}};
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(0);
+    m_record_log->enter(hash, time);
+    m_record_log->exit(hash, time);
+    m_record_log->epoch(time);
+    testing::Mock::VerifyAndClearExpectations(m_mock_shared_memory.get());
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(1);
+    m_record_log->dump(records, short_regions);
+}
+
+TEST_F(ApplicationRecordLogTest, multiple_threads)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
 
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->enter(hash, time);
+    // Each thread compresses its own short regions.  The threads run
+    // one after the other, so each reuses the slot released by the
+    // previous one.
+    std::thread([this]() {
+        m_record_log->enter(0xA, {{2, 0}});
+        m_record_log->exit(0xA, {{3, 0}});
+        m_record_log->enter(0xA, {{5, 0}});
+        m_record_log->exit(0xA, {{7, 0}});
+    }).join();
+    std::thread([this]() {
+        m_record_log->enter(0xB, {{1, 0}});
+        m_record_log->epoch({{4, 0}});
+    }).join();
+    std::thread([this]() {
+        m_record_log->enter(0xC, {{6, 0}});
+        m_record_log->exit(0xC, {{8, 0}});
+    }).join();
+    m_record_log->dump(records, short_regions);
+
+    ASSERT_EQ(4ULL, records.size());
+    EXPECT_EQ(1, records[0].time.t.tv_sec);
+    EXPECT_EQ(geopm::EVENT_REGION_ENTRY, records[0].event);
+    EXPECT_EQ(0xBULL, records[0].signal);
+    EXPECT_EQ(2, records[1].time.t.tv_sec);
+    EXPECT_EQ(geopm::EVENT_SHORT_REGION, records[1].event);
+    EXPECT_EQ(4, records[2].time.t.tv_sec);
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[2].event);
+    EXPECT_EQ(1ULL, records[2].signal);
+    EXPECT_EQ(6, records[3].time.t.tv_sec);
+    EXPECT_EQ(geopm::EVENT_SHORT_REGION, records[3].event);
+    ASSERT_EQ(2ULL, short_regions.size());
+    ASSERT_LT(records[1].signal, short_regions.size());
+    ASSERT_LT(records[3].signal, short_regions.size());
+    const auto &region_a = short_regions[records[1].signal];
+    EXPECT_EQ(0xAULL, region_a.hash);
+    EXPECT_EQ(2, region_a.num_complete);
+    EXPECT_EQ(3.0, region_a.total_time);
+    const auto &region_c = short_regions[records[3].signal];
+    EXPECT_EQ(0xCULL, region_c.hash);
+    EXPECT_EQ(1, region_c.num_complete);
+    EXPECT_EQ(2.0, region_c.total_time);
+
+    m_record_log->dump(records, short_regions);
+    EXPECT_EQ(0ULL, records.size());
+    EXPECT_EQ(0ULL, short_regions.size());
+}
+
+TEST_F(ApplicationRecordLogTest, shared_table_lock)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    // Threads that are alive at the same time claim one slot each,
+    // and the threads that find no free slot write to the shared
+    // table under the lock.
+    int num_thread = M_NUM_SLOT + 3;
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(num_thread - M_NUM_SLOT + 1);
+    std::atomic<int> num_done(0);
+    std::vector<std::thread> threads;
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        threads.emplace_back([this, thread_idx, num_thread, &num_done]() {
+            m_record_log->epoch({{thread_idx + 1, 0}});
+            ++num_done;
+            while (num_done.load() != num_thread) {
+                std::this_thread::yield();
+            }
+        });
     }
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->exit(hash, time);
+    for (auto &thread : threads) {
+        thread.join();
     }
-    {
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->epoch(time);
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ((size_t)num_thread, records.size());
+    std::set<uint64_t> epoch_count;
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        EXPECT_EQ(thread_idx + 1, records[thread_idx].time.t.tv_sec);
+        EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[thread_idx].event);
+        epoch_count.insert(records[thread_idx].signal);
     }
-    {
-        std::vector<record_s> records;
-        std::vector<short_region_s> short_regions;
-        EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
-            .Times(1);
-        m_record_log->dump(records, short_regions);
+    EXPECT_EQ((size_t)num_thread, epoch_count.size());
+    EXPECT_EQ(1ULL, *epoch_count.begin());
+    EXPECT_EQ((uint64_t)num_thread, *epoch_count.rbegin());
+}
+
+TEST_F(ApplicationRecordLogTest, slot_reuse)
+{
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    // Slots are released when threads exit, so many short lived
+    // threads never take the lock.
+    int num_thread = 4 * M_NUM_SLOT;
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(0);
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        std::thread([this, thread_idx]() {
+            m_record_log->epoch({{thread_idx + 1, 0}});
+        }).join();
     }
+    testing::Mock::VerifyAndClearExpectations(m_mock_shared_memory.get());
+    EXPECT_CALL(*m_mock_shared_memory, get_scoped_lock())
+        .Times(1);
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ((size_t)num_thread, records.size());
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        EXPECT_EQ(thread_idx + 1, records[thread_idx].time.t.tv_sec);
+        EXPECT_EQ((uint64_t)thread_idx + 1, records[thread_idx].signal);
+    }
+}
 
+TEST_F(ApplicationRecordLogTest, legacy_size)
+{
+    // Size of the buffer created by older versions of the service:
+    // there are no slots and all events take the lock.
+    size_t buffer_size = ApplicationRecordLog::buffer_size(0);
+    EXPECT_EQ(57384ULL, buffer_size);
+    auto shmem = std::make_shared<MockSharedMemory>(buffer_size);
+    ApplicationRecordLogImp record_log(shmem, M_PROC_ID, m_scheduler);
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    EXPECT_CALL(*shmem, get_scoped_lock())
+        .Times(4);
+    record_log.enter(0xA, {{2, 0}});
+    record_log.exit(0xA, {{3, 0}});
+    record_log.epoch({{4, 0}});
+    record_log.dump(records, short_regions);
+    ASSERT_EQ(2ULL, records.size());
+    EXPECT_EQ(geopm::EVENT_SHORT_REGION, records[0].event);
+    EXPECT_EQ(geopm::EVENT_EPOCH_COUNT, records[1].event);
+    ASSERT_EQ(1ULL, short_regions.size());
+    EXPECT_EQ(0xAULL, short_regions[0].hash);
+    EXPECT_EQ(1.0, short_regions[0].total_time);
 }
 
 TEST_F(ApplicationRecordLogTest, one_entry)
@@ -268,31 +408,51 @@ TEST_F(ApplicationRecordLogTest, overflow_record_table)
     std::vector<record_s> records;
     std::vector<short_region_s> short_regions;
 
+    // The slot table fills, then the shared table, then records are
+    // dropped until the next dump().
     int max_size = 1024;
-    for (int ii = 0; ii < max_size; ++ii) {
-        m_record_log->epoch({ii, 0});
+    for (int ii = 0; ii < 3 * max_size; ++ii) {
+        EXPECT_NO_THROW(m_record_log->epoch({{ii, 0}}));
+    }
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(2ULL * max_size, records.size());
+    for (int ii = 0; ii < 2 * max_size; ++ii) {
+        EXPECT_EQ(ii, records[ii].time.t.tv_sec);
+        EXPECT_EQ((uint64_t)ii + 1, records[ii].signal);
     }
-    GEOPM_EXPECT_THROW_MESSAGE(m_record_log->epoch({max_size, 0}),
-                               GEOPM_ERROR_RUNTIME, "maximum number of records reached");
+    m_record_log->epoch({{3 * max_size, 0}});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ(1ULL, records.size());
+    EXPECT_EQ(3 * max_size, records[0].time.t.tv_sec);
 }
 
-TEST_F(ApplicationRecordLogTest, cannot_overflow_region_table)
+TEST_F(ApplicationRecordLogTest, overflow_region_table)
 {
     std::vector<record_s> records;
     std::vector<short_region_s> short_regions;
     uint64_t hash = 0xABCD;
 
-    m_record_log->enter(hash, {2, 0});
-    m_record_log->exit(hash, {3, 0});
-    m_record_log->enter(hash, {4, 0});
+    m_record_log->enter(hash, {{2, 0}});
+    m_record_log->exit(hash, {{3, 0}});
+    m_record_log->enter(hash, {{4, 0}});
     m_record_log->dump(records, short_regions);
 
-    m_record_log->exit(hash, {5, 0});
+    m_record_log->exit(hash, {{5, 0}});
     int max_size = 1024;
     for (int ii = 0; ii < max_size; ++ii) {
-        m_record_log->enter(hash+ii, {6+ii, 0});
-        m_record_log->exit(hash+ii, {6+ii, 0});
+        m_record_log->enter(hash+ii, {{6+ii, 0}});
+        m_record_log->exit(hash+ii, {{6+ii, 0}});
     }
-    GEOPM_EXPECT_THROW_MESSAGE(m_record_log->enter(hash+max_size, {6+max_size, 0}),
-                               GEOPM_ERROR_RUNTIME, "maximum number of records reached");
+    // The slot table is full: the short region is created in the
+    // shared table along with its entry record.
+    m_record_log->enter(hash+max_size, {{6+max_size, 0}});
+    m_record_log->exit(hash+max_size, {{7+max_size, 0}});
+    m_record_log->dump(records, short_regions);
+    ASSERT_EQ((size_t)max_size + 1, records.size());
+    ASSERT_EQ((size_t)max_size + 1, short_regions.size());
+    const auto &last = records.back();
+    EXPECT_EQ(geopm::EVENT_SHORT_REGION, last.event);
+    ASSERT_LT(last.signal, short_regions.size());
+    EXPECT_EQ(hash + max_size, short_regions[last.signal].hash);
+    EXPECT_EQ(1.0, short_regions[last.signal].total_time);
 }
@@ -247,3 +247,25 @@ TEST_F(ApplicationStatusTest, update_cache)
     EXPECT_EQ(0.25, m_status->get_progress_cpu(0));
 
 }
+
+TEST_F(ApplicationStatusTest, update_cache_changed_only)
+{
+    uint64_t hash = 0xABC;
+    m_status->set_hash(1, hash, GEOPM_REGION_HINT_COMPUTE);
+    m_status->update_cache();
+    EXPECT_EQ(hash, m_status->get_hash(1));
+
+    // A change to the shared memory that is not published with a new
+    // version is not copied into the cache.
+    uint32_t *raw_status = (uint32_t *)((char *)m_mock_shared_memory->pointer() +
+                                        geopm::ApplicationStatus::buffer_size(1));
+    raw_status[2] = 0xDEF;
+    m_status->update_cache();
+    EXPECT_EQ(hash, m_status->get_hash(1));
+
+    // The next update to the CPU publishes all of its fields.
+    m_status->set_total_work_units(1, 2);
+    m_status->update_cache();
+    EXPECT_EQ(0xDEFULL, m_status->get_hash(1));
+    EXPECT_EQ(0.0, m_status->get_progress_cpu(1));
+}
@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <cstring>
 #include <unistd.h>
 #include <errno.h>
 #include "gtest/gtest.h"
@@ -17,6 +18,7 @@
 #include "geopm_version.h"
 #include "geopm_hash.h"
 #include "geopm_field.h"
+#include "geopm/json11.hpp"
 
 
 class CSVTest: public :: testing :: Test
@@ -196,3 +198,156 @@ TEST_F(CSVTest, negative)
     csv->update({1.0});
     unlink(output_path.c_str());
 }
+
+TEST_F(CSVTest, async)
+{
+    std::string sync_path = "CSVTest-async-sync-output";
+    std::string async_path = "CSVTest-async-output";
+    {
+        std::unique_ptr<geopm::CSV> sync_csv =
+            geopm::make_unique<geopm::CSVImp>(sync_path, "", m_start_time, m_buffer_size);
+        // Queue is smaller than the number of rows so update() must
+        // wait for the writer thread.
+        std::unique_ptr<geopm::CSV> async_csv = geopm::make_unique<geopm::AsyncCSV>(
+            geopm::make_unique<geopm::CSVImp>(async_path, "", m_start_time, m_buffer_size), 4);
+        for (auto &csv : {sync_csv.get(), async_csv.get()}) {
+            csv->add_column("COLUMN_DOUBLE", "double");
+            csv->add_column("COLUMN_HEX", "hex");
+            csv->add_column("COLUMN_DEFAULT");
+            csv->activate();
+        }
+        for (int count = 0; count != 100; ++count) {
+            std::vector<double> sample {count / 3.0, (double)count, count * 1e10};
+            sync_csv->update(sample);
+            async_csv->update(sample);
+        }
+        sync_csv->flush();
+        async_csv->flush();
+        EXPECT_EQ(geopm::read_file(sync_path), geopm::read_file(async_path));
+        // Rows queued before destruction are written
+        async_csv->update({0.5, 1.0, 2.0});
+        GEOPM_EXPECT_THROW_MESSAGE(async_csv->update({1.0}),
+                                   GEOPM_ERROR_INVALID, "incorrectly sized");
+    }
+    std::vector<std::string> output_lines = geopm::string_split(geopm::read_file(async_path), "\n");
+    ASSERT_EQ(108u, output_lines.size());
+    EXPECT_EQ("0.5|0x00000001|2", output_lines[106]);
+    unlink(sync_path.c_str());
+    unlink(async_path.c_str());
+}
+
+TEST_F(CSVTest, binary)
+{
+    std::string output_path = "CSVTest-binary-output";
+    {
+        // Buffer of 256 bytes holds ten rows of three columns
+        std::unique_ptr<geopm::CSV> csv =
+            geopm::CSV::make_unique(output_path, m_host_name, m_start_time, m_buffer_size, "binary");
+        csv->add_column("COLUMN_DOUBLE", "double");
+        csv->add_column("COLUMN_HEX", geopm::string_format_hex);
+        csv->add_column("COLUMN_CUSTOM", [](double value) { return std::to_string(value); });
+        GEOPM_EXPECT_THROW_MESSAGE(csv->add_column("name", "bad-format"),
+                                   GEOPM_ERROR_INVALID, "format is unknown");
+        GEOPM_EXPECT_THROW_MESSAGE(csv->update({1.0, 2.0, 3.0}),
+                                   GEOPM_ERROR_INVALID, "activate() must be called prior");
+        csv->activate();
+        GEOPM_EXPECT_THROW_MESSAGE(csv->update({1.0}),
+                                   GEOPM_ERROR_INVALID, "incorrectly sized");
+        for (int count = 0; count != 25; ++count) {
+            csv->update({count / 3.0, (double)count, count * 1e10});
+        }
+    }
+    output_path += "-" + m_host_name;
+    std::string output = geopm::read_file(output_path);
+    ASSERT_LT(16u, output.size());
+    EXPECT_EQ(std::string(geopm::BinaryCSVImp::M_MAGIC), output.substr(0, 8));
+    uint64_t header_size = 0;
+    memcpy(&header_size, output.data() + 8, sizeof(header_size));
+    EXPECT_EQ(0u, header_size % 8);
+    ASSERT_LE(16 + header_size, output.size());
+    std::string err;
+    json11::Json header = json11::Json::parse(output.substr(16, header_size), err);
+    ASSERT_TRUE(err.empty()) << err;
+    EXPECT_EQ(geopm_version(), header["geopm_version"].string_value());
+    EXPECT_EQ(m_start_time, header["start_time"].string_value());
+    EXPECT_EQ(m_host_name, header["node_name"].string_value());
+    ASSERT_EQ(3u, header["columns"].array_items().size());
+    EXPECT_EQ("COLUMN_DOUBLE", header["columns"][0]["name"].string_value());
+    EXPECT_EQ("double", header["columns"][0]["format"].string_value());
+    EXPECT_EQ("COLUMN_HEX", header["columns"][1]["name"].string_value());
+    EXPECT_EQ("hex", header["columns"][1]["format"].string_value());
+    EXPECT_EQ("COLUMN_CUSTOM", header["columns"][2]["name"].string_value());
+    EXPECT_EQ("double", header["columns"][2]["format"].string_value());
+
+    // Blocks of ten, ten and five rows in column-major order
+    size_t offset = 16 + header_size;
+    int count = 0;
+    std::vector<uint64_t> block_rows;
+    while (offset < output.size()) {
+        uint64_t num_row = 0;
+        memcpy(&num_row, output.data() + offset, sizeof(num_row));
+        offset += sizeof(num_row);
+        ASSERT_LE(offset + 3 * num_row * sizeof(double), output.size());
+        std::vector<double> block(3 * num_row);
+        memcpy(block.data(), output.data() + offset, block.size() * sizeof(double));
+        offset += block.size() * sizeof(double);
+        for (uint64_t row_idx = 0; row_idx != num_row; ++row_idx, ++count) {
+            EXPECT_EQ(count / 3.0, block[row_idx]);
+            EXPECT_EQ((double)count, block[num_row + row_idx]);
+            EXPECT_EQ(count * 1e10, block[2 * num_row + row_idx]);
+        }
+        block_rows.push_back(num_row);
+    }
+    EXPECT_EQ(25, count);
+    EXPECT_EQ((std::vector<uint64_t>{10, 10, 5}), block_rows);
+    unlink(output_path.c_str());
+
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::CSV::make_unique(output_path, "", m_start_time, m_buffer_size, "xml"),
+                               GEOPM_ERROR_INVALID, "unknown file format");
+}
+
+TEST_F(CSVTest, binary_large_buffer)
+{
+    std::string output_path = "CSVTest-binary-large-buffer-output";
+    {
+        // One flush of 3000 rows of three columns is written in
+        // blocks of at most 8192 values
+        std::unique_ptr<geopm::CSV> csv =
+            geopm::CSV::make_unique(output_path, "", m_start_time, 1024 * 1024, "binary");
+        csv->add_column("COLUMN_A");
+        csv->add_column("COLUMN_B");
+        csv->add_column("COLUMN_C");
+        csv->activate();
+        for (int count = 0; count != 3000; ++count) {
+            csv->update({(double)count, count + 0.5, -1.0 * count});
+        }
+    }
+    std::string output = geopm::read_file(output_path);
+    ASSERT_LT(16u, output.size());
+    // The header size is stored in little-endian byte order
+    uint64_t header_size = 0;
+    for (int byte_idx = 7; byte_idx >= 0; --byte_idx) {
+        header_size = (header_size << 8) | (uint8_t)output[8 + byte_idx];
+    }
+    size_t offset = 16 + header_size;
+    int count = 0;
+    std::vector<uint64_t> block_rows;
+    while (offset < output.size()) {
+        uint64_t num_row = 0;
+        memcpy(&num_row, output.data() + offset, sizeof(num_row));
+        offset += sizeof(num_row);
+        ASSERT_LE(offset + 3 * num_row * sizeof(double), output.size());
+        std::vector<double> block(3 * num_row);
+        memcpy(block.data(), output.data() + offset, block.size() * sizeof(double));
+        offset += block.size() * sizeof(double);
+        for (uint64_t row_idx = 0; row_idx != num_row; ++row_idx, ++count) {
+            EXPECT_EQ((double)count, block[row_idx]);
+            EXPECT_EQ(count + 0.5, block[num_row + row_idx]);
+            EXPECT_EQ(-1.0 * count, block[2 * num_row + row_idx]);
+        }
+        block_rows.push_back(num_row);
+    }
+    EXPECT_EQ(3000, count);
+    EXPECT_EQ((std::vector<uint64_t>{2730, 270}), block_rows);
+    unlink(output_path.c_str());
+}
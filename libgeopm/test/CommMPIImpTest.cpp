@@ -285,6 +285,25 @@ extern "C"
 #define MPI_Win_unlock(p0, p1) mock_win_unlock(p0, p1)
 #define PMPI_Win_unlock(p0, p1) mock_win_unlock(p0, p1)
 
+    static int mock_win_lock_all(int param0, MPI_Win param1)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        return 0;
+    }
+
+#define MPI_Win_lock_all(p0, p1) mock_win_lock_all(p0, p1)
+#define PMPI_Win_lock_all(p0, p1) mock_win_lock_all(p0, p1)
+
+    static int mock_win_unlock_all(MPI_Win param0)
+    {
+        memcpy(g_params[0], &param0, g_sizes[0]);
+        return 0;
+    }
+
+#define MPI_Win_unlock_all(p0) mock_win_unlock_all(p0)
+#define PMPI_Win_unlock_all(p0) mock_win_unlock_all(p0)
+
     static int mock_put(const void *param0, int param1, MPI_Datatype param2, int param3, MPI_Aint param4,
             int param5, MPI_Datatype param6, MPI_Win param7)
     {
@@ -943,6 +962,34 @@ TEST_F(CommMPIImpTest, mpi_win_ops)
     reset();
     m_params.clear();
 
+    // lock all
+    int assert = 1;
+    g_sizes.push_back(sizeof(int));
+    g_params.push_back(malloc(g_sizes[0]));
+    g_sizes.push_back(sizeof(MPI_Win));
+    g_params.push_back(malloc(g_sizes[1]));
+
+    m_params.push_back(&assert);
+    m_params.push_back((void *) tmp2);
+
+    tmp_comm.window_lock_all(win_handle, assert);
+
+    check_params();
+    reset();
+    m_params.clear();
+
+    // unlock all
+    g_sizes.push_back(sizeof(MPI_Win));
+    g_params.push_back(malloc(g_sizes[0]));
+
+    m_params.push_back((void *) tmp2);
+
+    tmp_comm.window_unlock_all(win_handle);
+
+    check_params();
+    reset();
+    m_params.clear();
+
     // win destroy
     g_sizes.push_back(sizeof(size_t));
     g_params.push_back(malloc(g_sizes[0]));
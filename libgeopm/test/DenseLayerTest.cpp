@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cmath>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -65,6 +66,24 @@ TEST_F(DenseLayerTest, test_inference) {
     EXPECT_THAT(layer.forward(m_inp3), TensorOneDEqualTo(m_tmp2));
 }
 
+TEST_F(DenseLayerTest, test_inference_batch) {
+    DenseLayerImp layer(m_weights, m_biases);
+
+    // More inputs than fit in one block
+    std::vector<double> input = {1, 2, 3,
+                                 0, 0, 0,
+                                 1, 0, 0,
+                                 0, 1, 0,
+                                 0, 0, 1};
+    std::vector<double> output(10, NAN);
+    layer.forward_batch(input.data(), 5, output.data());
+    EXPECT_EQ(std::vector<double>({21, 40,
+                                   7, 8,
+                                   8, 12,
+                                   9, 13,
+                                   10, 14}), output);
+}
+
 TEST_F(DenseLayerTest, test_bad_dimensions) {
     DenseLayerImp layer(m_weights, m_biases);
 
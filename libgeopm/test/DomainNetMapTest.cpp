@@ -4,6 +4,7 @@
  */
 
 
+#include <cmath>
 #include <fstream>
 #include <string>
 
@@ -529,3 +530,72 @@ TEST_F(DomainNetMapTest, test_plumbing)
     std::map<std::string, double> expected_output({{"GEO", 4}, {"PM", 3}, {"@", -1}, {"INTEL", 0}, {"2023", 2}});
     EXPECT_EQ(expected_output, net_map.last_output());
 }
+
+TEST_F(DomainNetMapTest, test_plumbing_batch)
+{
+    std::ofstream good_json(M_FILENAME);
+    good_json <<
+        "{\"layers\": ["
+        "[[[1, 2, 3], [4, 5, 6]], [7, 8]]"
+        "],"
+        "\"signal_inputs\": [\"A\"],"
+        "\"delta_inputs\": ["
+        "[\"B\", \"C\"],"
+        "[\"D\", \"E\"]"
+        "],"
+        "\"trace_outputs\": [\"GEO\", \"PM\"]}" << std::endl;
+    good_json.close();
+
+    EXPECT_CALL(*m_fake_nn_factory, createTensorOneD(_))
+        .WillOnce(Return(m_biases));
+    EXPECT_CALL(*m_fake_nn_factory, createTensorTwoD(m_weight_vals))
+        .WillOnce(Return(m_weights));
+    EXPECT_CALL(*m_fake_nn_factory,
+            createDenseLayer(TensorTwoDEqualTo(m_weights),
+                TensorOneDEqualTo(m_biases)))
+        .WillOnce(Return(m_fake_layer));
+    EXPECT_CALL(*m_fake_nn_factory, createLocalNeuralNet(ElementsAre(m_fake_layer)))
+        .WillOnce(Return(m_fake_nn));
+
+    EXPECT_CALL(*m_fake_nn, get_input_dim()).WillRepeatedly(Return(3));
+    EXPECT_CALL(*m_fake_nn, get_output_dim()).WillRepeatedly(Return(2));
+
+    EXPECT_CALL(m_fake_plat_io, push_signal("A", _, _)).WillOnce(Return(0));
+    EXPECT_CALL(m_fake_plat_io, push_signal("B", _, _)).WillOnce(Return(1));
+    EXPECT_CALL(m_fake_plat_io, push_signal("C", _, _)).WillOnce(Return(2));
+    EXPECT_CALL(m_fake_plat_io, push_signal("D", _, _)).WillOnce(Return(3));
+    EXPECT_CALL(m_fake_plat_io, push_signal("E", _, _)).WillOnce(Return(4));
+
+    EXPECT_CALL(m_fake_plat_io, sample(0)).WillOnce(Return(1)).WillOnce(Return(0));
+    EXPECT_CALL(m_fake_plat_io, sample(1)).WillOnce(Return(2)).WillOnce(Return(4));
+    EXPECT_CALL(m_fake_plat_io, sample(2)).WillOnce(Return(3)).WillOnce(Return(4));
+    EXPECT_CALL(m_fake_plat_io, sample(3)).WillOnce(Return(4)).WillOnce(Return(0));
+    EXPECT_CALL(m_fake_plat_io, sample(4)).WillOnce(Return(5)).WillOnce(Return(6));
+
+    DomainNetMapImp net_map(M_FILENAME, GEOPM_DOMAIN_PACKAGE, 0,
+                            m_fake_plat_io, m_fake_nn_factory);
+    EXPECT_EQ(3u, net_map.input_dim());
+
+    std::vector<double> input(6, NAN);
+    net_map.sample_input(input, 1);
+    net_map.sample_input(input, 1);
+    EXPECT_TRUE(std::isnan(input[0]));
+    EXPECT_EQ(0, input[3]);
+    EXPECT_EQ(2, input[4]);
+    EXPECT_EQ(-4, input[5]);
+    GEOPM_EXPECT_THROW_MESSAGE(net_map.sample_input(input, 2),
+                               GEOPM_ERROR_INVALID,
+                               "Input batch is too small");
+
+    std::vector<double> output = {1, 2, 3, 4};
+    EXPECT_CALL(*m_fake_nn, forward_batch(_, 2, _));
+    net_map.forward_batch(input, 2, output);
+
+    net_map.set_output(output, 1);
+    EXPECT_EQ(std::vector<double>({3, 4}), net_map.trace_values());
+    std::map<std::string, double> expected_output({{"GEO", 3}, {"PM", 4}});
+    EXPECT_EQ(expected_output, net_map.last_output());
+    GEOPM_EXPECT_THROW_MESSAGE(net_map.set_output(output, 2),
+                               GEOPM_ERROR_INVALID,
+                               "Output batch is too small");
+}
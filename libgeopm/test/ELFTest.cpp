@@ -76,3 +76,20 @@ TEST_F(ELFTest, symbol_lookup)
     symbol = geopm::symbol_lookup((void*)fn_off);
     EXPECT_EQ("geopm_crc32_str", symbol.second);
 }
+
+static bool elf_test_static_function(void)
+{
+    return random() % 8;
+}
+
+TEST_F(ELFTest, symbol_lookup_static)
+{
+    // A static function is not found by dladdr(), so it is found in
+    // the symbol table read from the executable.
+    size_t fn_off = (size_t)elf_test_static_function;
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        std::pair<size_t, std::string> symbol = geopm::symbol_lookup((void*)(fn_off + 4));
+        EXPECT_EQ(fn_off, symbol.first);
+        EXPECT_EQ("elf_test_static_function()", symbol.second);
+    }
+}
@@ -135,6 +135,29 @@ TEST_F(EditDistPeriodicityDetectorTest, fft_small)
     check_vals(m_trace_file_prefix + "fft_small.trace", warmup, period, history_size);
 }
 
+/// Pattern with a period of 150 records and repeated region names
+TEST_F(EditDistPeriodicityDetectorTest, long_period)
+{
+    int period = 150;
+    int history_size = 500;
+    int warmup = 2 * period - 1;
+    std::vector<record_s> recs;
+    std::vector<std::vector<int> > expected;
+    for (int rec_idx = 0; rec_idx < 800; ++rec_idx) {
+        record_s rec = {};
+        rec.event = geopm::EVENT_REGION_ENTRY;
+        rec.signal = (rec_idx % period) % 7;
+        recs.push_back(rec);
+        if (rec_idx < warmup) {
+            expected.push_back({-1, 0});
+        }
+        else {
+            expected.push_back({period, 0});
+        }
+    }
+    check_vals(recs, expected, history_size);
+}
+
 /// HELPER FUNCTIONS
 
 /// start: inclusive
@@ -362,6 +362,32 @@ TEST_F(EndpointTest, wait_stops_when_agent_attaches)
     mio->close();
 }
 
+TEST_F(EndpointTest, wait_wakes_on_agent_notify)
+{
+    GEOPM_TEST_EXTENDED("Requires multiple threads");
+    set_up_expectations();
+
+    struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer();
+    std::shared_ptr<Endpoint> mio = std::make_shared<EndpointImp>(m_shm_path, m_policy_shmem, m_sample_shmem, 0, 0);
+    mio->open();
+
+    auto run_thread = std::async(std::launch::async,
+                                 &Endpoint::wait_for_agent_attach,
+                                 mio,
+                                 m_timeout);
+    ASSERT_TRUE(run_thread.valid());
+    // let the thread block on the agent change
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // simulate agent attach as done by EndpointUser
+    strncpy(data->agent, "monitor", GEOPM_ENDPOINT_AGENT_NAME_MAX);
+    EndpointImp::notify_agent_change(data);
+    // notified wait returns well before the polling period
+    auto result = run_thread.wait_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(result, std::future_status::ready);
+    run_thread.get();
+    mio->close();
+}
+
 TEST_F(EndpointTest, wait_attach_timeout_0)
 {
     set_up_expectations();
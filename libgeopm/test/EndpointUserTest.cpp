@@ -191,3 +191,20 @@ TEST_F(EndpointUserTestIntegration, parse_shm)
     expected = {tmp, tmp + num_policy};
     EXPECT_EQ(expected, result);
 }
+
+TEST_F(EndpointUserTestIntegration, attach_detach_notify)
+{
+    auto smp = SharedMemory::make_unique_owner(m_shm_path + "-policy", sizeof(struct geopm_endpoint_policy_shmem_s));
+    auto sms = SharedMemory::make_unique_owner(m_shm_path + "-sample", sizeof(struct geopm_endpoint_sample_shmem_s));
+    struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) sms->pointer();
+    EXPECT_EQ(0U, data->agent_seq);
+    {
+        EndpointUserImp gp(m_shm_path, nullptr, nullptr, "myagent", 0, "myprofile", "", {});
+        // Waiters are notified of the attach
+        EXPECT_EQ(1U, data->agent_seq);
+        EXPECT_STREQ("myagent", data->agent);
+    }
+    // Waiters are notified of the detach
+    EXPECT_EQ(2U, data->agent_seq);
+    EXPECT_STREQ("", data->agent);
+}
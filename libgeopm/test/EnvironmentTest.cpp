@@ -655,6 +655,36 @@ TEST_F(EnvironmentTest, init_control_unset)
     EXPECT_EQ("", m_env->init_control());
 }
 
+TEST_F(EnvironmentTest, wait_strategy)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("sleep", m_env->wait_strategy());
+
+    setenv("GEOPM_WAIT_STRATEGY", "hybrid", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("hybrid", m_env->wait_strategy());
+}
+
+TEST_F(EnvironmentTest, trace_format)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("csv", m_env->trace_format());
+
+    setenv("GEOPM_TRACE_FORMAT", "binary", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("binary", m_env->trace_format());
+}
+
+TEST_F(EnvironmentTest, tree_comm_lock)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("lock", m_env->tree_comm_lock());
+
+    setenv("GEOPM_TREE_COMM_LOCK", "lock_all", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("lock_all", m_env->tree_comm_lock());
+}
+
 TEST_F(EnvironmentTest, signal_parser)
 {
     std::vector<std::pair<std::string, int> >& expected_signals = m_trace_signals;
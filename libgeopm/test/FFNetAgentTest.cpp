@@ -40,6 +40,7 @@ using ::testing::Invoke;
 using ::testing::Sequence;
 using ::testing::Return;
 using ::testing::AtLeast;
+using ::testing::SizeIs;
 using geopm::FFNetAgent;
 using geopm::PlatformTopo;
 using geopm::DomainNetMap;
@@ -66,6 +67,7 @@ class FFNetAgentTest : public ::testing::Test
         int construct_and_init(bool m_do_gpu);
         static constexpr int M_NUM_PKG = 2;
         static constexpr int M_NUM_GPU = 6;
+        static constexpr int M_NUM_INPUT = 3;
 
         std::vector<double> m_default_policy = {0.5};
         const std::map<std::string, double> M_REGION_CLASS = {{"dgemm", 0.75},
@@ -95,6 +97,10 @@ int FFNetAgentTest::init(bool do_gpu)
         m_net_map[std::make_pair(GEOPM_DOMAIN_GPU, idx)]
             = std::make_shared<MockDomainNetMap>();
     }
+    for (const auto &net_map_pair : m_net_map) {
+        EXPECT_CALL(*net_map_pair.second, input_dim())
+            .WillRepeatedly(Return(M_NUM_INPUT));
+    }
 
     m_freq_recommender[GEOPM_DOMAIN_PACKAGE]
         = std::make_shared<MockRegionHintRecommender>();
@@ -366,13 +372,21 @@ TEST_F(FFNetAgentTest, adjust_platform_no_gpu)
 
 }
 
-// Test sample_platform: All signals are queried when do_gpu=True
+// Test sample_platform: All signals are queried when do_gpu=True and
+// each neural net is applied once to the inputs of all domains of its type
 TEST_F(FFNetAgentTest, sample_platform)
 {
     construct_and_init(true);
 
-    for (const auto &net_map_pair : m_net_map) {
-        EXPECT_CALL(*net_map_pair.second, sample());
+    for (geopm_domain_e domain_type : {GEOPM_DOMAIN_PACKAGE, GEOPM_DOMAIN_GPU}) {
+        int num_domain = domain_type == GEOPM_DOMAIN_PACKAGE ? M_NUM_PKG : M_NUM_GPU;
+        for (int idx = 0; idx < num_domain; ++idx) {
+            auto net_map = m_net_map.at(std::make_pair(domain_type, idx));
+            EXPECT_CALL(*net_map, sample_input(SizeIs(num_domain * M_NUM_INPUT), idx));
+            EXPECT_CALL(*net_map, set_output(_, idx));
+        }
+        EXPECT_CALL(*m_net_map.at(std::make_pair(domain_type, 0)),
+                    forward_batch(SizeIs(num_domain * M_NUM_INPUT), num_domain, _));
     }
 
     std::vector<double> tmp;
@@ -386,14 +400,18 @@ TEST_F(FFNetAgentTest, sample_platform_no_gpu)
 
     for (const auto &net_map_pair : m_net_map) {
         if (net_map_pair.first.first == GEOPM_DOMAIN_PACKAGE) {
-            EXPECT_CALL(*net_map_pair.second, sample())
+            EXPECT_CALL(*net_map_pair.second, sample_input(_, net_map_pair.first.second))
+                .Times(1);
+            EXPECT_CALL(*net_map_pair.second, set_output(_, net_map_pair.first.second))
                 .Times(1);
         }
         else if (net_map_pair.first.first == GEOPM_DOMAIN_GPU) {
-            EXPECT_CALL(*net_map_pair.second, sample())
+            EXPECT_CALL(*net_map_pair.second, sample_input(_, _))
                 .Times(0);
         }
     }
+    EXPECT_CALL(*m_net_map.at(std::make_pair(GEOPM_DOMAIN_PACKAGE, 0)),
+                forward_batch(_, M_NUM_PKG, _));
 
     std::vector<double> tmp;
     m_agent->sample_platform(tmp);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "FunctionRegionMap.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "geopm_hash.h"
+#include "geopm/Exception.hpp"
+
+#include "gtest/gtest.h"
+#include "geopm_test.hpp"
+
+using geopm::FunctionRegionMap;
+
+TEST(FunctionRegionMapTest, find_insert)
+{
+    FunctionRegionMap map(4);
+    EXPECT_EQ(0ULL, map.size());
+    EXPECT_EQ(GEOPM_REGION_HASH_UNMARKED, map.find(0x401000));
+    map.insert(0x401000, 0x1234);
+    map.insert(0x402000, 0x5678);
+    EXPECT_EQ(2ULL, map.size());
+    EXPECT_EQ(0x1234ULL, map.find(0x401000));
+    EXPECT_EQ(0x5678ULL, map.find(0x402000));
+    EXPECT_EQ(GEOPM_REGION_HASH_UNMARKED, map.find(0x403000));
+    // Insert of an existing function replaces its region ID
+    map.insert(0x401000, 0x9abc);
+    EXPECT_EQ(2ULL, map.size());
+    EXPECT_EQ(0x9abcULL, map.find(0x401000));
+    GEOPM_EXPECT_THROW_MESSAGE(map.insert(0, 0x1234), GEOPM_ERROR_INVALID,
+                               "function address must not be zero");
+}
+
+TEST(FunctionRegionMapTest, grow)
+{
+    FunctionRegionMap map(2);
+    size_t num_function = 1000;
+    for (size_t func_idx = 1; func_idx <= num_function; ++func_idx) {
+        map.insert(0x400000 + 16 * func_idx, func_idx);
+    }
+    EXPECT_EQ(num_function, map.size());
+    for (size_t func_idx = 1; func_idx <= num_function; ++func_idx) {
+        EXPECT_EQ(func_idx, map.find(0x400000 + 16 * func_idx));
+    }
+    EXPECT_EQ(GEOPM_REGION_HASH_UNMARKED, map.find(0x400000));
+}
+
+TEST(FunctionRegionMapTest, concurrent_find)
+{
+    FunctionRegionMap map(2);
+    size_t num_function = 4096;
+    int num_reader = 4;
+    std::vector<std::thread> readers;
+    std::vector<int> num_error(num_reader, 0);
+    for (int reader_idx = 0; reader_idx < num_reader; ++reader_idx) {
+        readers.emplace_back([&map, &num_error, num_function, reader_idx]() {
+            for (int repeat = 0; repeat < 10; ++repeat) {
+                for (size_t func_idx = 1; func_idx <= num_function; ++func_idx) {
+                    uint64_t region_id = map.find(0x400000 + 16 * func_idx);
+                    // A function is either not found yet or found
+                    // with the region ID that was inserted.
+                    if (region_id != GEOPM_REGION_HASH_UNMARKED &&
+                        region_id != func_idx) {
+                        ++num_error[reader_idx];
+                    }
+                }
+            }
+        });
+    }
+    for (size_t func_idx = 1; func_idx <= num_function; ++func_idx) {
+        map.insert(0x400000 + 16 * func_idx, func_idx);
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (int reader_idx = 0; reader_idx < num_reader; ++reader_idx) {
+        EXPECT_EQ(0, num_error[reader_idx]);
+    }
+    EXPECT_EQ(num_function, map.size());
+}
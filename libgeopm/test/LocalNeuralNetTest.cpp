@@ -12,7 +12,9 @@
 #include "LocalNeuralNet.hpp"
 #include "LocalNeuralNetImp.hpp"
 #include "DenseLayer.hpp"
+#include "DenseLayerImp.hpp"
 #include "TensorOneD.hpp"
+#include "TensorTwoD.hpp"
 
 #include "MockDenseLayer.hpp"
 #include "MockTensorMath.hpp"
@@ -20,6 +22,8 @@
 
 using geopm::TensorOneD;
 using geopm::DenseLayer;
+using geopm::DenseLayerImp;
+using geopm::TensorTwoD;
 using geopm::LocalNeuralNet;
 using geopm::LocalNeuralNetImp;
 using ::testing::Mock;
@@ -65,6 +69,47 @@ TEST_F(LocalNeuralNetTest, test_inference)
     EXPECT_THAT(net.forward(m_inp2), TensorOneDEqualTo(m_inp3));
 }
 
+TEST_F(LocalNeuralNetTest, test_inference_batch)
+{
+    // Hidden layer wider than one block of outputs in
+    // DenseLayerImp::forward_batch()
+    size_t num_hidden = 300;
+    std::vector<std::vector<double> > weights1(num_hidden);
+    std::vector<double> biases1(num_hidden);
+    std::vector<std::vector<double> > weights2(3, std::vector<double>(num_hidden));
+    for (size_t idx = 0; idx < num_hidden; ++idx) {
+        weights1[idx] = {0.01 * idx, -0.02 * idx};
+        biases1[idx] = 1.0 - 0.005 * idx;
+        weights2[0][idx] = 0.1;
+        weights2[1][idx] = idx % 2 == 0 ? 1 : -1;
+        weights2[2][idx] = -0.001 * idx;
+    }
+    LocalNeuralNetImp net({std::make_shared<DenseLayerImp>(TensorTwoD(weights1),
+                                                           TensorOneD(biases1)),
+                           std::make_shared<DenseLayerImp>(TensorTwoD(weights2),
+                                                           TensorOneD({1, 2, 3}))});
+
+    size_t num_batch = 6;
+    std::vector<double> input(num_batch * 2);
+    for (size_t idx = 0; idx < input.size(); ++idx) {
+        input[idx] = 0.5 * idx - 2;
+    }
+    std::vector<double> output;
+    net.forward_batch(input, num_batch, output);
+    ASSERT_EQ(num_batch * 3, output.size());
+    for (size_t batch_idx = 0; batch_idx < num_batch; ++batch_idx) {
+        TensorOneD expected = net.forward(TensorOneD({input[2 * batch_idx],
+                                                      input[2 * batch_idx + 1]}));
+        for (size_t out_idx = 0; out_idx < 3; ++out_idx) {
+            EXPECT_NEAR(expected[out_idx], output[3 * batch_idx + out_idx], 1e-12);
+        }
+    }
+
+    GEOPM_EXPECT_THROW_MESSAGE(net.forward_batch(input, num_batch + 1, output),
+                               GEOPM_ERROR_INVALID,
+                               "Input batch size is incompatible");
+}
+
 TEST_F(LocalNeuralNetTest, test_dims)
 {
     LocalNeuralNetImp net({m_fake_layer1, m_fake_layer2});
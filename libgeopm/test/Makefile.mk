@@ -3,11 +3,17 @@
 #
 
 check_PROGRAMS += test/geopm_test
+check_PROGRAMS += test/app_status_bench
+check_PROGRAMS += test/edit_dist_periodicity_bench
+check_PROGRAMS += test/endpoint_attach_bench
+check_PROGRAMS += test/ffnet_inference_bench
+check_PROGRAMS += test/symbol_lookup_bench
 check_SCRIPTS += test/geopm_test.test
 noinst_SCRIPTS += $(check_SCRIPTS)
 
 if ENABLE_MPI
     check_PROGRAMS += test/geopm_mpi_test_api
+    check_PROGRAMS += test/tree_comm_bench
 endif
 
 TEST_LOG_DRIVER = env AM_TAP_AWK='$(AWK)' $(SHELL) \
@@ -63,6 +69,7 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/FrequencyGovernorTest.cpp \
                           test/FrequencyMapAgentTest.cpp \
                           test/FrequencyTimeBalancerTest.cpp \
+                          test/FunctionRegionMapTest.cpp \
                           test/InitControlTest.cpp \
                           test/LocalNeuralNetTest.cpp \
                           test/MockAgent.hpp \
@@ -160,8 +167,10 @@ endif
 
 if ENABLE_OMPT
     test_geopm_test_SOURCES += test/ELFTest.cpp
+    check_PROGRAMS += test/ompt_parallel_bench
 else
     EXTRA_DIST += test/ELFTest.cpp
+    EXTRA_DIST += test/ompt_parallel_bench.cpp
 endif
 
 test_geopm_test_LDADD = libgeopm.la
@@ -170,6 +179,30 @@ test_geopm_test_CPPFLAGS = $(AM_CPPFLAGS) -Iplugin
 test_geopm_test_CFLAGS = $(AM_CFLAGS)
 test_geopm_test_CXXFLAGS = $(AM_CXXFLAGS)
 
+test_app_status_bench_SOURCES = test/app_status_bench.cpp
+test_app_status_bench_LDADD = libgeopm.la
+test_app_status_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
+test_edit_dist_periodicity_bench_SOURCES = test/edit_dist_periodicity_bench.cpp
+test_edit_dist_periodicity_bench_LDADD = libgeopm.la
+test_edit_dist_periodicity_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
+test_endpoint_attach_bench_SOURCES = test/endpoint_attach_bench.cpp
+test_endpoint_attach_bench_LDADD = libgeopm.la
+test_endpoint_attach_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
+test_ffnet_inference_bench_SOURCES = test/ffnet_inference_bench.cpp
+test_ffnet_inference_bench_LDADD = libgeopm.la
+test_ffnet_inference_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
+test_symbol_lookup_bench_SOURCES = test/symbol_lookup_bench.cpp
+test_symbol_lookup_bench_LDADD = libgeopm.la
+test_symbol_lookup_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
+test_ompt_parallel_bench_SOURCES = test/ompt_parallel_bench.cpp
+test_ompt_parallel_bench_LDADD = libgeopm.la
+test_ompt_parallel_bench_CXXFLAGS = $(AM_CXXFLAGS)
+
 if ENABLE_MPI
     test_geopm_mpi_test_api_SOURCES = test/MPIInterfaceTest.cpp \
                                       test/geopm_test.cpp \
@@ -183,9 +216,14 @@ if ENABLE_MPI
     test_geopm_mpi_test_api_LDFLAGS = $(AM_LDFLAGS)
     test_geopm_mpi_test_api_CFLAGS = $(AM_CFLAGS)
     test_geopm_mpi_test_api_CXXFLAGS= $(AM_CXXFLAGS)
+
+    test_tree_comm_bench_SOURCES = test/tree_comm_bench.cpp
+    test_tree_comm_bench_LDADD = libgeopm.la $(MPI_CLIBS)
+    test_tree_comm_bench_CXXFLAGS = $(AM_CXXFLAGS)
 else
     EXTRA_DIST += test/MPIInterfaceTest.cpp \
                   test/geopm_test.cpp \
+                  test/tree_comm_bench.cpp \
                   # end
 endif
 
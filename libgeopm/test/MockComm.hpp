@@ -40,6 +40,9 @@ class MockComm : public geopm::Comm
                     (const, override));
         MOCK_METHOD(void, window_unlock, (size_t window_id, int rank),
                     (const, override));
+        MOCK_METHOD(void, window_lock_all, (size_t window_id, int assert),
+                    (const, override));
+        MOCK_METHOD(void, window_unlock_all, (size_t window_id), (const, override));
         MOCK_METHOD(void, coordinate, (int rank, std::vector<int> &coord),
                     (const, override));
         MOCK_METHOD(std::vector<int>, coordinate, (int rank), (const, override));
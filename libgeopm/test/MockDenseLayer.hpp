@@ -15,6 +15,9 @@ class MockDenseLayer : public geopm::DenseLayer
     public:
         MOCK_METHOD(geopm::TensorOneD, forward, (const geopm::TensorOneD &input),
                     (const override));
+        MOCK_METHOD(void, forward_batch,
+                    (const double *input, size_t num_batch, double *output),
+                    (const override));
         MOCK_METHOD(size_t, get_input_dim, (), (const override));
         MOCK_METHOD(size_t, get_output_dim, (), (const override));
 };
@@ -13,6 +13,14 @@ class MockDomainNetMap : public geopm::DomainNetMap
 {
     public:
         MOCK_METHOD(void, sample, (), (override));
+        MOCK_METHOD(size_t, input_dim, (), (const, override));
+        MOCK_METHOD(void, sample_input, (std::vector<double> &input, size_t batch_idx),
+                    (override));
+        MOCK_METHOD(void, forward_batch,
+                    (const std::vector<double> &input, size_t num_batch,
+                     std::vector<double> &output), (override));
+        MOCK_METHOD(void, set_output, (const std::vector<double> &output, size_t batch_idx),
+                    (override));
         MOCK_METHOD(std::vector<std::string>, trace_names, (), (const, override));
         MOCK_METHOD(std::vector<double>, trace_values, (), (const, override));
         MOCK_METHOD((std::map<std::string, double>), last_output, (), (const, override));
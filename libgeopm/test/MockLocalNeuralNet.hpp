@@ -14,6 +14,9 @@ class MockLocalNeuralNet : public geopm::LocalNeuralNet
     public:
         MOCK_METHOD(geopm::TensorOneD, forward, (const geopm::TensorOneD &input),
                     (const override));
+        MOCK_METHOD(void, forward_batch,
+                    (const std::vector<double> &input, size_t num_batch,
+                     std::vector<double> &output), (override));
         MOCK_METHOD(size_t, get_input_dim, (), (const override));
         MOCK_METHOD(size_t, get_output_dim, (), (const override));
 };
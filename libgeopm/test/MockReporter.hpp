@@ -36,6 +36,7 @@ class MockReporter : public geopm::Reporter
                     (override));
         MOCK_METHOD(void, total_time, (double total), (override));
         MOCK_METHOD(void, overhead, (double overhead_sec, double sample_delay), (override));
+        MOCK_METHOD(void, loop_period, (double mean, double std_dev, double max), (override));
 };
 
 #endif
@@ -720,12 +720,16 @@ TEST_F(ReporterTest, generate_conditional)
              << "      MPI startup (s): 22.11\n"
              << "      GEOPM startup (s): 0.321\n"
              << "      GEOPM overhead (s): 0.123\n"
+             << "      GEOPM loop period mean (s): 0.005\n"
+             << "      GEOPM loop period std (s): 0.0001\n"
+             << "      GEOPM loop period max (s): 0.0062\n"
              << "      geopmctl memory HWM (B): @ANY_STRING@\n"
              << "      geopmctl network BW (B/s): 678\n\n";
 
     std::istringstream exp_istream(expected.str());
     m_reporter->update();
     m_reporter->overhead(0.123, 0.321);
+    m_reporter->loop_period(0.005, 0.0001, 0.0062);
     m_reporter->generate("my_agent", agent_header, agent_node_report, m_region_agent_detail,
                          m_application_io,
                          m_comm, m_tree_comm);
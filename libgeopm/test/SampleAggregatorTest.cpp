@@ -26,6 +26,7 @@ using geopm::PlatformTopo;
 using geopm::IOGroup;
 using testing::_;
 using testing::Return;
+using testing::Invoke;
 
 class SampleAggregatorTest : public ::testing::Test
 {
@@ -49,7 +50,8 @@ class SampleAggregatorTest : public ::testing::Test
             M_SIGNAL_R_HASH_CPU_1,
             M_SIGNAL_R_HASH_CPU_2,
             M_SIGNAL_R_HASH_CPU_3,
-            M_SIGNAL_EPOCH_COUNT
+            M_SIGNAL_EPOCH_COUNT,
+            M_SIGNAL_POWER_0,
         };
 };
 
@@ -365,6 +367,60 @@ TEST_F(SampleAggregatorTest, epoch_application_total)
     EXPECT_DOUBLE_EQ(7.0, m_agg->sample_application(M_SIGNAL_TIME));
 }
 
+TEST_F(SampleAggregatorTest, many_regions)
+{
+    // Board is in a different region on each step and package 0
+    // stays in one region
+    uint64_t reg_pkg = 0x1111;
+    int num_region = 1000;
+    int step = 0;
+    auto board_region = [&step, num_region](int) {
+        // Last step is unmarked so that every region has been exited
+        return step == 2 * num_region ? (double)GEOPM_REGION_HASH_UNMARKED :
+                                        (double)(0x10000 + step % num_region);
+    };
+    EXPECT_CALL(m_platio, push_signal("TIME", GEOPM_DOMAIN_BOARD, 0));
+    EXPECT_CALL(m_platio, push_signal("POWER", GEOPM_DOMAIN_PACKAGE, 0))
+        .WillOnce(Return(M_SIGNAL_POWER_0));
+    EXPECT_CALL(m_platio, push_signal("REGION_HASH", GEOPM_DOMAIN_BOARD, 0));
+    EXPECT_CALL(m_platio, push_signal("REGION_HASH", GEOPM_DOMAIN_PACKAGE, 0));
+    EXPECT_CALL(m_platio, signal_behavior("TIME"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE));
+    EXPECT_CALL(m_platio, signal_behavior("POWER"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    m_agg->push_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+    m_agg->push_signal("POWER", GEOPM_DOMAIN_PACKAGE, 0);
+    EXPECT_CALL(m_platio, sample(M_SIGNAL_TIME))
+        .WillRepeatedly(Invoke([&step](int) { return (double)step; }));
+    EXPECT_CALL(m_platio, sample(M_SIGNAL_POWER_0))
+        .WillRepeatedly(Return(100.0));
+    EXPECT_CALL(m_platio, sample(M_SIGNAL_R_HASH_BOARD))
+        .WillRepeatedly(Invoke(board_region));
+    EXPECT_CALL(m_platio, sample(M_SIGNAL_R_HASH_PKG_0))
+        .WillRepeatedly(Return(reg_pkg));
+    EXPECT_CALL(m_platio, sample(M_SIGNAL_EPOCH_COUNT))
+        .WillRepeatedly(Return(0));
+    // Run through all regions twice
+    for (step = 0; step <= 2 * num_region; ++step) {
+        m_agg->update();
+    }
+    for (int region_idx = 0; region_idx < num_region; ++region_idx) {
+        uint64_t region = 0x10000 + region_idx;
+        EXPECT_DOUBLE_EQ(2.0, m_agg->sample_region(M_SIGNAL_TIME, region))
+            << "Region hash: " << geopm::string_format_hex(region);
+        EXPECT_DOUBLE_EQ(1.0, m_agg->sample_region_last(M_SIGNAL_TIME, region))
+            << "Region hash: " << geopm::string_format_hex(region);
+        // The package was never in the board regions
+        EXPECT_TRUE(std::isnan(m_agg->sample_region(M_SIGNAL_POWER_0, region)));
+    }
+    EXPECT_DOUBLE_EQ(0.0, m_agg->sample_region(M_SIGNAL_TIME, reg_pkg));
+    EXPECT_DOUBLE_EQ(100.0, m_agg->sample_region(M_SIGNAL_POWER_0, reg_pkg));
+    EXPECT_DOUBLE_EQ(2.0 * num_region, m_agg->sample_application(M_SIGNAL_TIME));
+    // Unseen region
+    EXPECT_DOUBLE_EQ(0.0, m_agg->sample_region(M_SIGNAL_TIME, 0x9999));
+    EXPECT_TRUE(std::isnan(m_agg->sample_region(M_SIGNAL_POWER_0, 0x9999)));
+}
+
 TEST_F(SampleAggregatorTest, test_sample_before_update)
 {
     EXPECT_CALL(m_platio, push_signal("TIME", GEOPM_DOMAIN_BOARD, 0));
@@ -89,6 +89,8 @@ TEST_F(TensorMathTest, test_self_diff)
 TEST_F(TensorMathTest, test_dot)
 {
     EXPECT_EQ(11, m_math.inner_product(m_one, m_two));
+    EXPECT_DOUBLE_EQ(0.75, m_math.inner_product(TensorOneD({0.5, 0.25}),
+                                                TensorOneD({0.5, 2})));
 }
 
 TEST_F(TensorMathTest, test_sigmoid)
@@ -28,6 +28,7 @@ class TreeCommLevelTest : public ::testing::Test
         int m_num_up = 3;
         int m_num_down = 2;
         int m_num_rank = 4;
+        std::string m_lock_type = "lock";
         std::shared_ptr<MockComm> m_comm_0;
         std::shared_ptr<MockComm> m_comm_1;
         std::shared_ptr<TreeCommLevel> m_level_rank_0;
@@ -79,8 +80,8 @@ void TreeCommLevelTest::SetUp()
     EXPECT_CALL(*m_comm_1, window_create(0, NULL)).WillOnce(Return((size_t)m_sample_window[1])); // sample window
     EXPECT_CALL(*m_comm_1, window_create(policy_size, _)).WillOnce(Return((size_t)m_policy_window[1]));
 
-    m_level_rank_0 = std::make_shared<TreeCommLevelImp>(m_comm_0, m_num_up, m_num_down);
-    m_level_rank_1 = std::make_shared<TreeCommLevelImp>(m_comm_1, m_num_up, m_num_down);
+    m_level_rank_0 = TreeCommLevel::make_unique(m_comm_0, m_num_up, m_num_down, m_lock_type);
+    m_level_rank_1 = TreeCommLevel::make_unique(m_comm_1, m_num_up, m_num_down, m_lock_type);
 }
 
 void TreeCommLevelTest::TearDown()
@@ -324,3 +325,70 @@ TEST_F(TreeCommLevelTest, receive_down_incomplete)
         EXPECT_TRUE(std::isnan(pp));
     }
 }
+
+class TreeCommLevelLockAllTest : public TreeCommLevelTest
+{
+    protected:
+        void SetUp();
+};
+
+void TreeCommLevelLockAllTest::SetUp()
+{
+    m_lock_type = "lock_all";
+    TreeCommLevelTest::SetUp();
+}
+
+TEST_F(TreeCommLevelLockAllTest, send_down)
+{
+    std::vector<std::vector<double> > policy {{2.2, 3.3}, {2.9, 3.9}, {2.1, 3.1}, {2.0, 3.0}};
+    ASSERT_EQ(m_num_rank, (int)policy.size());
+    size_t msg_size = sizeof(double) * m_num_down;
+
+    // one epoch for all children
+    EXPECT_CALL(*m_comm_0, window_lock(_, _, _, _)).Times(0);
+    EXPECT_CALL(*m_comm_0, window_lock_all((size_t)m_policy_window[0], 0));
+    EXPECT_CALL(*m_comm_0, window_unlock_all((size_t)m_policy_window[0]));
+    for (int child_rank = 1; child_rank < m_num_rank; ++child_rank) {
+        EXPECT_CALL(*m_comm_0, window_put(_, sizeof(double), child_rank, 0, _));
+        EXPECT_CALL(*m_comm_0, window_put(_, msg_size, child_rank, sizeof(double), _));
+    }
+    m_level_rank_0->send_down(policy);
+    EXPECT_EQ((sizeof(double) + msg_size) * (m_num_rank - 1), m_level_rank_0->overhead_send());
+
+    // only the changed policy is sent
+    policy[2] = {5.5, 6.6};
+    EXPECT_CALL(*m_comm_0, window_lock_all(_, _));
+    EXPECT_CALL(*m_comm_0, window_unlock_all(_));
+    EXPECT_CALL(*m_comm_0, window_put(_, sizeof(double), 2, 0, _));
+    EXPECT_CALL(*m_comm_0, window_put(_, msg_size, 2, sizeof(double), _));
+    m_level_rank_0->send_down(policy);
+
+    // no epoch if nothing changed
+    EXPECT_CALL(*m_comm_0, window_lock_all(_, _)).Times(0);
+    EXPECT_CALL(*m_comm_0, window_unlock_all(_)).Times(0);
+    m_level_rank_0->send_down(policy);
+    EXPECT_EQ((sizeof(double) + msg_size) * m_num_rank, m_level_rank_0->overhead_send());
+}
+
+TEST_F(TreeCommLevelLockAllTest, receive_down)
+{
+    // children read under an exclusive lock
+    EXPECT_CALL(*m_comm_1, window_lock(_, true, 1, 0));
+    EXPECT_CALL(*m_comm_1, window_unlock(_, 1));
+
+    std::vector<double> policy = {77.7, 88.8};
+    double complete = 1.0;
+    memcpy(m_policy_mem_1, &complete, sizeof(complete));
+    memcpy(m_policy_mem_1 + 1, policy.data(), sizeof(double) * policy.size());
+
+    std::vector<double> policy_out;
+    EXPECT_TRUE(m_level_rank_1->receive_down(policy_out));
+    EXPECT_EQ(policy, policy_out);
+}
+
+TEST(TreeCommLevelFactoryTest, invalid_lock_type)
+{
+    auto comm = std::make_shared<MockComm>();
+    GEOPM_EXPECT_THROW_MESSAGE(TreeCommLevel::make_unique(comm, 1, 1, "fence"),
+                               GEOPM_ERROR_INVALID, "unknown lock type: fence");
+}
@@ -32,6 +32,12 @@ TEST_F(WaiterTest, make_unique)
     ASSERT_EQ(1.0, waiter->period());
     waiter = Waiter::make_unique(2.0, "sleep");
     ASSERT_EQ(2.0, waiter->period());
+    waiter = Waiter::make_unique(3.0, "hybrid");
+    ASSERT_EQ(3.0, waiter->period());
+    waiter = Waiter::make_unique(4.0, "timerfd");
+    ASSERT_EQ(4.0, waiter->period());
+    waiter = Waiter::make_unique(5.0, "adaptive");
+    ASSERT_EQ(5.0, waiter->period());
 }
 
 TEST_F(WaiterTest, reset)
@@ -62,3 +68,27 @@ TEST_F(WaiterTest, wait)
         EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
     }
 }
+
+TEST_F(WaiterTest, wait_strategy)
+{
+    for (const auto &strategy : {"hybrid", "timerfd", "adaptive"}) {
+        std::shared_ptr<Waiter> waiter = Waiter::make_unique(m_period, strategy);
+        geopm_time_s time_0;
+        geopm_time_s time_1;
+        waiter->reset();
+        for (int count = 0; count < 5; ++count) {
+            geopm_time(&time_0);
+            waiter->wait();
+            geopm_time(&time_1);
+            EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon)
+                << "strategy: " << strategy;
+        }
+        waiter->reset(m_period / 2);
+        EXPECT_EQ(m_period / 2, waiter->period());
+        geopm_time(&time_0);
+        waiter->wait();
+        geopm_time(&time_1);
+        EXPECT_NEAR(m_period / 2, geopm_time_diff(&time_0, &time_1), m_epsilon)
+            << "strategy: " << strategy;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the rate of work unit posts into the ApplicationStatus
+/// shared memory, which is what geopm_tprof_post() does for each
+/// application thread, while another thread reads the status with
+/// update_cache() as the Controller does.  Each application thread
+/// posts to the status of its own CPU, and the time per call to
+/// update_cache() is reported along with the time to copy the whole
+/// shared memory buffer for comparison.
+///
+/// Usage: app_status_bench [num_thread [num_post]]
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "geopm_time.h"
+#include "geopm/SharedMemory.hpp"
+#include "ApplicationStatus.hpp"
+
+int main(int argc, char **argv)
+{
+    int num_thread = 224;
+    int num_post = 100000;
+    if (argc > 1) {
+        num_thread = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_post = std::atoi(argv[2]);
+    }
+    std::string shm_key = "/geopm-app-status-bench-" + std::to_string(getpid());
+    std::shared_ptr<geopm::SharedMemory> shmem =
+        geopm::SharedMemory::make_unique_owner(shm_key, geopm::ApplicationStatus::buffer_size(num_thread));
+    auto writer = geopm::ApplicationStatus::make_unique(num_thread, shmem);
+    auto reader = geopm::ApplicationStatus::make_unique(num_thread, shmem);
+    for (int cpu_idx = 0; cpu_idx < num_thread; ++cpu_idx) {
+        writer->set_total_work_units(cpu_idx, num_post);
+    }
+
+    std::atomic<int> num_done(0);
+    std::vector<std::thread> threads;
+    geopm_time_s begin;
+    geopm_time(&begin);
+    for (int cpu_idx = 0; cpu_idx < num_thread; ++cpu_idx) {
+        threads.emplace_back([&writer, &num_done, cpu_idx, num_post]() {
+            for (int post_idx = 0; post_idx < num_post; ++post_idx) {
+                writer->increment_work_unit(cpu_idx);
+            }
+            ++num_done;
+        });
+    }
+    long num_update = 0;
+    double update_time = 0.0;
+    while (num_done.load() != num_thread) {
+        geopm_time_s update_begin;
+        geopm_time(&update_begin);
+        reader->update_cache();
+        update_time += geopm_time_since(&update_begin);
+        ++num_update;
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    double post_time = geopm_time_since(&begin);
+
+    // Reference time to copy the whole buffer
+    std::vector<char> copy(shmem->size());
+    int num_copy = 1000;
+    geopm_time(&begin);
+    for (int copy_idx = 0; copy_idx < num_copy; ++copy_idx) {
+        std::memcpy(copy.data(), shmem->pointer(), copy.size());
+        __asm__ __volatile__("" : : "g"(copy.data()) : "memory");
+    }
+    double copy_time = geopm_time_since(&begin);
+
+    reader->update_cache();
+    int num_incomplete = 0;
+    for (int cpu_idx = 0; cpu_idx < num_thread; ++cpu_idx) {
+        if (reader->get_progress_cpu(cpu_idx) != 1.0) {
+            ++num_incomplete;
+        }
+    }
+    if (num_incomplete != 0) {
+        fprintf(stderr, "Warning: progress of %d CPUs is incomplete\n", num_incomplete);
+    }
+    shmem->unlink();
+
+    printf("num_thread | post_per_sec | num_update | update_cache_usec | buffer_copy_usec\n");
+    printf("%d | %g | %ld | %f | %f\n", num_thread,
+           (double)num_thread * num_post / post_time, num_update,
+           num_update ? 1e6 * update_time / num_update : 0.0,
+           1e6 * copy_time / num_copy);
+    return 0;
+}
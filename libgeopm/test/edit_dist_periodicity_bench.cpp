@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time spent by EditDistPeriodicityDetector::update()
+/// once the history buffer is full, for a range of history sizes.
+/// The records repeat with a period of one quarter of the history.
+///
+/// Usage: edit_dist_periodicity_bench [max_history_size [num_update]]
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "geopm_time.h"
+#include "EditDistPeriodicityDetector.hpp"
+#include "record.hpp"
+
+int main(int argc, char **argv)
+{
+    int max_history_size = 4096;
+    int num_update = 100;
+    if (argc > 1) {
+        max_history_size = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_update = std::atoi(argv[2]);
+    }
+    printf("history_size | period | detected_period | score | usec_per_update\n");
+    for (int history_size = 16; history_size <= max_history_size; history_size *= 2) {
+        int period = history_size / 4;
+        geopm::EditDistPeriodicityDetector detector(history_size);
+        geopm::record_s record = {};
+        record.event = geopm::EVENT_REGION_ENTRY;
+        int rec_idx = 0;
+        for (; rec_idx < history_size; ++rec_idx) {
+            record.signal = (rec_idx % period) % 13;
+            detector.update(record);
+        }
+        geopm_time_s begin;
+        geopm_time(&begin);
+        for (int update_idx = 0; update_idx < num_update; ++update_idx, ++rec_idx) {
+            record.signal = (rec_idx % period) % 13;
+            detector.update(record);
+        }
+        double elapsed = geopm_time_since(&begin);
+        printf("%d | %d | %d | %d | %f\n", history_size, period,
+               detector.get_period(), detector.get_score(),
+               1e6 * elapsed / num_update);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time from an Agent attaching to, or detaching from, an
+/// endpoint until wait_for_agent_attach() or wait_for_agent_detach()
+/// returns in the resource manager thread.  The attach is done by an
+/// EndpointUser in the same process, as the Controller would on
+/// startup.
+///
+/// Usage: endpoint_attach_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+#include "geopm_time.h"
+#include "geopm/SharedMemory.hpp"
+#include "EndpointImp.hpp"
+#include "EndpointUser.hpp"
+
+static geopm_time_s wait_time(geopm::Endpoint &endpoint, bool is_attach)
+{
+    if (is_attach) {
+        endpoint.wait_for_agent_attach(1.0);
+    }
+    else {
+        endpoint.wait_for_agent_detach(1.0);
+    }
+    geopm_time_s result;
+    geopm_time(&result);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 100;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    std::string path = "/endpoint_attach_bench_" + std::to_string(getpid());
+    geopm::EndpointImp endpoint(path);
+    endpoint.open();
+    double attach_time = 0.0;
+    double detach_time = 0.0;
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        auto attach_thread = std::async(std::launch::async, wait_time,
+                                        std::ref(endpoint), true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        geopm_time_s begin;
+        geopm_time(&begin);
+        auto user = std::make_unique<geopm::EndpointUserImp>(path, nullptr, nullptr, "monitor", 0,
+                                                             "endpoint_attach_bench", "",
+                                                             std::set<std::string>{});
+        geopm_time_s end = attach_thread.get();
+        attach_time += geopm_time_diff(&begin, &end);
+
+        auto detach_thread = std::async(std::launch::async, wait_time,
+                                        std::ref(endpoint), false);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        geopm_time(&begin);
+        user.reset();
+        end = detach_thread.get();
+        detach_time += geopm_time_diff(&begin, &end);
+    }
+    endpoint.close();
+
+    printf("num_iteration | attach_usec | detach_usec\n");
+    printf("%d | %f | %f\n", num_iteration,
+           1e6 * attach_time / num_iteration, 1e6 * detach_time / num_iteration);
+    return 0;
+}
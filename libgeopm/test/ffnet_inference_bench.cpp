@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time spent applying one neural net to the inputs of
+/// every domain of a type, as the FFNetAgent does each control
+/// period, for a range of hidden layer sizes.  The net is applied
+/// once per domain with LocalNeuralNet::forward() and once for all
+/// domains with LocalNeuralNet::forward_batch().
+///
+/// Usage: ffnet_inference_bench [num_domain [num_iteration]]
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "geopm_time.h"
+#include "DenseLayerImp.hpp"
+#include "LocalNeuralNetImp.hpp"
+#include "TensorOneD.hpp"
+#include "TensorTwoD.hpp"
+
+static const size_t NUM_INPUT = 16;
+static const size_t NUM_OUTPUT = 8;
+
+static std::shared_ptr<geopm::DenseLayer> make_layer(size_t num_input, size_t num_output)
+{
+    std::vector<std::vector<double> > weights(num_output, std::vector<double>(num_input));
+    std::vector<double> biases(num_output);
+    for (size_t out_idx = 0; out_idx < num_output; ++out_idx) {
+        for (size_t in_idx = 0; in_idx < num_input; ++in_idx) {
+            weights[out_idx][in_idx] = ((out_idx * 7 + in_idx * 3) % 11) / 11.0 - 0.5;
+        }
+        biases[out_idx] = (out_idx % 5) / 5.0 - 0.4;
+    }
+    return std::make_shared<geopm::DenseLayerImp>(geopm::TensorTwoD(weights),
+                                                  geopm::TensorOneD(biases));
+}
+
+int main(int argc, char **argv)
+{
+    size_t num_domain = 8;
+    int num_iteration = 100;
+    if (argc > 1) {
+        num_domain = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_iteration = std::atoi(argv[2]);
+    }
+    printf("num_domain | hidden_size | forward_usec | forward_batch_usec | max_diff\n");
+    for (size_t hidden_size = 32; hidden_size <= 1024; hidden_size *= 2) {
+        geopm::LocalNeuralNetImp net({make_layer(NUM_INPUT, hidden_size),
+                                      make_layer(hidden_size, hidden_size),
+                                      make_layer(hidden_size, NUM_OUTPUT)});
+        std::vector<double> input(num_domain * NUM_INPUT);
+        for (size_t idx = 0; idx < input.size(); ++idx) {
+            input[idx] = (idx % 13) / 13.0;
+        }
+        std::vector<geopm::TensorOneD> domain_output(num_domain);
+        geopm_time_s begin;
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            for (size_t domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
+                std::vector<double> domain_input(input.begin() + domain_idx * NUM_INPUT,
+                                                 input.begin() + (domain_idx + 1) * NUM_INPUT);
+                domain_output[domain_idx] = net.forward(geopm::TensorOneD(domain_input));
+            }
+        }
+        double forward_time = geopm_time_since(&begin);
+        std::vector<double> output;
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            net.forward_batch(input, num_domain, output);
+        }
+        double batch_time = geopm_time_since(&begin);
+        double max_diff = 0.0;
+        for (size_t domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
+            for (size_t out_idx = 0; out_idx < NUM_OUTPUT; ++out_idx) {
+                double diff = std::abs(domain_output[domain_idx][out_idx] -
+                                       output[domain_idx * NUM_OUTPUT + out_idx]);
+                max_diff = diff > max_diff ? diff : max_diff;
+            }
+        }
+        printf("%zu | %zu | %f | %f | %g\n", num_domain, hidden_size,
+               1e6 * forward_time / num_iteration, 1e6 * batch_time / num_iteration,
+               max_diff);
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time to enter and exit an empty OpenMP parallel region.
+/// Run once with GEOPM_OMPT_ENABLE set in the environment, so that
+/// the OMPT parallel_begin and parallel_end callbacks look up the
+/// region of the parallel function, and once without it.  The time
+/// to look up the region ID of a function in the FunctionRegionMap
+/// used by the callbacks is reported along with the time to look up
+/// the same function in a std::map.
+///
+/// Usage: ompt_parallel_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+#include <omp.h>
+
+#include "geopm_time.h"
+#include "FunctionRegionMap.hpp"
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 100000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    // First region creates the thread team
+    #pragma omp parallel
+    {
+        __asm__ __volatile__("" : : : "memory");
+    }
+    geopm_time_s begin;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        #pragma omp parallel
+        {
+            // Keep the compiler from removing the region
+            __asm__ __volatile__("" : : : "memory");
+        }
+    }
+    double parallel_time = geopm_time_since(&begin);
+
+    // Region IDs of as many functions as a large OpenMP application
+    // has parallel regions
+    const size_t num_function = 1000;
+    geopm::FunctionRegionMap function_map;
+    std::map<size_t, uint64_t> std_map;
+    for (size_t func_idx = 0; func_idx < num_function; ++func_idx) {
+        function_map.insert(0x400000 + 64 * func_idx, func_idx);
+        std_map[0x400000 + 64 * func_idx] = func_idx;
+    }
+    uint64_t map_sum = 0;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        map_sum += function_map.find(0x400000 + 64 * (iter % num_function));
+    }
+    double map_time = geopm_time_since(&begin);
+    uint64_t std_map_sum = 0;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        std_map_sum += std_map.find(0x400000 + 64 * (iter % num_function))->second;
+    }
+    double std_map_time = geopm_time_since(&begin);
+    if (map_sum != std_map_sum) {
+        fprintf(stderr, "Warning: FunctionRegionMap and std::map differ\n");
+    }
+
+    printf("num_thread | ompt_enabled | parallel_usec | find_usec | std_map_find_usec\n");
+    printf("%d | %d | %f | %f | %f\n", omp_get_max_threads(),
+           getenv("GEOPM_OMPT_ENABLE") != nullptr,
+           1e6 * parallel_time / num_iteration, 1e6 * map_time / num_iteration,
+           1e6 * std_map_time / num_iteration);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time to name the OpenMP regions of a program with
+/// 10000 parallel functions, as the OMPT parallel_begin callback does
+/// the first time each region is entered.  The functions are static,
+/// so dladdr() does not find their names and the symbol table of the
+/// executable is used.  The time of the first symbol_lookup() of each
+/// function is reported along with the time of a repeated lookup, and
+/// the time to read the whole symbol table with elf_symbol_map().
+///
+/// Usage: symbol_lookup_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "geopm_time.h"
+#include "ELF.hpp"
+
+// Define a distinct function for each number from 10000 to 19999
+#define DIGIT_1(M, p) M(p##0) M(p##1) M(p##2) M(p##3) M(p##4) \
+                      M(p##5) M(p##6) M(p##7) M(p##8) M(p##9)
+#define DIGIT_2(M, p) DIGIT_1(M, p##0) DIGIT_1(M, p##1) DIGIT_1(M, p##2) DIGIT_1(M, p##3) DIGIT_1(M, p##4) \
+                      DIGIT_1(M, p##5) DIGIT_1(M, p##6) DIGIT_1(M, p##7) DIGIT_1(M, p##8) DIGIT_1(M, p##9)
+#define DIGIT_3(M, p) DIGIT_2(M, p##0) DIGIT_2(M, p##1) DIGIT_2(M, p##2) DIGIT_2(M, p##3) DIGIT_2(M, p##4) \
+                      DIGIT_2(M, p##5) DIGIT_2(M, p##6) DIGIT_2(M, p##7) DIGIT_2(M, p##8) DIGIT_2(M, p##9)
+#define DIGIT_4(M, p) DIGIT_3(M, p##0) DIGIT_3(M, p##1) DIGIT_3(M, p##2) DIGIT_3(M, p##3) DIGIT_3(M, p##4) \
+                      DIGIT_3(M, p##5) DIGIT_3(M, p##6) DIGIT_3(M, p##7) DIGIT_3(M, p##8) DIGIT_3(M, p##9)
+#define REGION_FUNCTION(n) \
+    __attribute__((noinline)) static int bench_region_##n(void) { return n; }
+#define REGION_POINTER(n) (const void *)bench_region_##n,
+
+extern "C" {
+DIGIT_4(REGION_FUNCTION, 1)
+}
+
+static const void *const REGION_FUNCTIONS[] = {DIGIT_4(REGION_POINTER, 1)};
+static const int NUM_REGION = sizeof(REGION_FUNCTIONS) / sizeof(REGION_FUNCTIONS[0]);
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 10;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    int num_error = 0;
+    geopm_time_s begin;
+    geopm_time(&begin);
+    geopm::symbol_lookup(REGION_FUNCTIONS[0]);
+    double first_time = geopm_time_since(&begin);
+    geopm_time(&begin);
+    for (int region_idx = 1; region_idx < NUM_REGION; ++region_idx) {
+        geopm::symbol_lookup(REGION_FUNCTIONS[region_idx]);
+    }
+    double cold_time = geopm_time_since(&begin);
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        for (int region_idx = 0; region_idx < NUM_REGION; ++region_idx) {
+            auto symbol = geopm::symbol_lookup(REGION_FUNCTIONS[region_idx]);
+            if (symbol.second != "bench_region_" + std::to_string(10000 + region_idx)) {
+                ++num_error;
+            }
+        }
+    }
+    double warm_time = geopm_time_since(&begin);
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        geopm::elf_symbol_map("/proc/self/exe");
+    }
+    double map_time = geopm_time_since(&begin);
+    if (num_error != 0) {
+        fprintf(stderr, "Warning: %d lookups did not find the region function\n", num_error);
+    }
+
+    printf("num_region | first_lookup_usec | lookup_usec | repeat_lookup_usec | elf_symbol_map_usec\n");
+    printf("%d | %f | %f | %f | %f\n", NUM_REGION, 1e6 * first_time,
+           1e6 * cold_time / (NUM_REGION - 1),
+           1e6 * warm_time / (num_iteration * NUM_REGION),
+           1e6 * map_time / num_iteration);
+    return 0;
+}
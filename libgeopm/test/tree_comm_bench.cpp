@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measure the time spent by every rank in one pass of TreeComm
+/// messages up and down the tree for each window lock type and for a
+/// range of maximum fan out values given to TreeComm::fan_out().
+///
+/// Usage: mpiexec -n <num_node> tree_comm_bench [num_iteration]
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm_time.h"
+#include "Comm.hpp"
+#include "TreeComm.hpp"
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    int num_iteration = 1000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    const int num_send_up = 8;
+    const int num_send_down = 8;
+    {
+        std::shared_ptr<geopm::Comm> comm = geopm::Comm::make_unique("MPIComm");
+        int rank = comm->rank();
+        if (rank == 0) {
+            printf("lock_type | max_fan_out | fan_out | usec_per_iteration\n");
+        }
+        for (std::string lock_type : {"lock", "lock_all"}) {
+            for (int max_fan_out : {2, 4, 8, 16, 32, 64}) {
+                std::vector<int> fan_out = geopm::TreeComm::fan_out(comm, max_fan_out);
+                if (fan_out.empty()) {
+                    continue;
+                }
+                geopm::TreeCommImp tree(comm, fan_out, 0, num_send_down, num_send_up,
+                                        {}, lock_type);
+                int num_level_ctl = tree.num_level_controlled();
+                int root_level = tree.root_level();
+                std::vector<double> sample(num_send_up, 1.0);
+                std::vector<double> policy(num_send_down, 1.0);
+                std::vector<std::vector<double> > child_sample;
+                std::vector<std::vector<double> > child_policy;
+                comm->barrier();
+                geopm_time_s begin;
+                geopm_time(&begin);
+                for (int iter = 0; iter < num_iteration; ++iter) {
+                    // New policy each iteration so that every level
+                    // sends to every child
+                    std::fill(policy.begin(), policy.end(), (double)iter);
+                    if (num_level_ctl < root_level) {
+                        tree.send_up(num_level_ctl, sample);
+                    }
+                    for (int level = 0; level < num_level_ctl; ++level) {
+                        child_sample.resize(tree.level_size(level));
+                        tree.receive_up(level, child_sample);
+                    }
+                    for (int level = num_level_ctl - 1; level >= 0; --level) {
+                        child_policy.assign(tree.level_size(level), policy);
+                        tree.send_down(level, child_policy);
+                    }
+                    if (num_level_ctl < root_level) {
+                        tree.receive_down(num_level_ctl, policy);
+                    }
+                }
+                double elapsed = geopm_time_since(&begin);
+                double max_elapsed = 0.0;
+                MPI_Reduce(&elapsed, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+                if (rank == 0) {
+                    std::string fan_out_str;
+                    for (int ff : fan_out) {
+                        fan_out_str += (fan_out_str.empty() ? "" : "x") + std::to_string(ff);
+                    }
+                    printf("%s | %d | %s | %f\n", lock_type.c_str(), max_fan_out,
+                           fan_out_str.c_str(), 1e6 * max_elapsed / num_iteration);
+                }
+            }
+        }
+    }
+    MPI_Finalize();
+    return 0;
+}
@@ -6,6 +6,7 @@
 #ifndef AGG_HPP_INCLUDE
 #define AGG_HPP_INCLUDE
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <vector>
@@ -105,6 +106,18 @@ namespace geopm
             ///        one of the Agg:m_type_e enum values.  If the
             ///        agg_type is out of range, it throws an error.
             static std::string type_to_name(int agg_type);
+            /// @brief Aggregate an array of operands with the
+            ///        built in function for one of the Agg::m_type_e
+            ///        enum values.  The result is the same as calling
+            ///        the function on a vector of the operands, but
+            ///        no std::function is invoked and no memory is
+            ///        allocated except by median.  If the agg_type is
+            ///        out of range, it throws an error.
+            /// @param [in] agg_type One of the Agg::m_type_e enum
+            ///        values.
+            /// @param [in] operand Pointer to the first operand.
+            /// @param [in] num_operand Number of operands.
+            static double aggregate(int agg_type, const double *operand, size_t num_operand);
     };
 }
 
@@ -189,6 +189,16 @@ namespace geopm
             ///
             /// @param [in] signal_name Name of the signal.
             virtual int signal_behavior(const std::string &signal_name) const = 0;
+            /// @brief Test if a signal is computed from other signals,
+            ///        e.g. a rate of change over the recent samples
+            ///        read through the IOGroup, so that its value
+            ///        depends on the history of the IOGroup.
+            ///
+            /// @param [in] signal_name Name of the signal.
+            ///
+            /// @return True if the signal is derived.  The default
+            ///         implementation returns false.
+            virtual bool is_signal_derived(const std::string &signal_name) const;
             virtual void save_control(const std::string &save_path) = 0;
             virtual void restore_control(const std::string &save_path) = 0;
             /// @brief Get the IOGroup name
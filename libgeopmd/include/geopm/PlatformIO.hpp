@@ -7,6 +7,7 @@
 #define PLATFORMIO_HPP_INCLUDE
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -133,6 +134,14 @@ namespace geopm
             ///        previously given to adjust() are written to the
             ///        platform.
             virtual void write_batch(void) = 0;
+            /// @brief Get the time spent by each registered IOGroup
+            ///        in the most recent call to read_batch().
+            /// @return Map from IOGroup name to elapsed seconds.
+            virtual std::map<std::string, double> read_batch_duration(void) const = 0;
+            /// @brief Get the time spent by each registered IOGroup
+            ///        in the most recent call to write_batch().
+            /// @return Map from IOGroup name to elapsed seconds.
+            virtual std::map<std::string, double> write_batch_duration(void) const = 0;
             /// @brief Read from platform and interpret into SI units
             ///        a signal given its name and domain.  Does not
             ///        modify the values stored by calling
@@ -216,6 +225,15 @@ namespace geopm
             /// @return One of the IOGroup::m_signal_behavior_e enum
             ///         values that identifies the signal behavior
             virtual int signal_behavior(const std::string &signal_name) const = 0;
+            /// @brief Test if a signal is computed from other signals
+            ///        so that its value depends on the history of the
+            ///        IOGroup that provides it, e.g. a power computed
+            ///        from recent energy samples.
+            ///
+            /// @param [in] signal_name Name of the signal.
+            ///
+            /// @return True if the signal is derived.
+            virtual bool is_signal_derived(const std::string &signal_name) const = 0;
             /// @brief Save the state of all controls so that any
             ///        subsequent changes made through PlatformIO can
             ///        be undone with a call to the restore_control()
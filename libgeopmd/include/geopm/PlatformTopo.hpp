@@ -59,6 +59,38 @@ namespace geopm
             /// @return The set of domain indices for the inner domain that are
             ///         within the indexed outer domain.
             virtual std::set<int> domain_nested(int inner_domain, int outer_domain, int outer_idx) const = 0;
+            /// @brief Nesting of all domains of one type within all
+            ///        domains of another type in compressed sparse
+            ///        row form.
+            struct nested_table_s {
+                /// @brief Offset into inner_idx for each outer
+                ///        domain followed by the size of inner_idx:
+                ///        the inner domains within outer domain j are
+                ///        inner_idx[offset[j]] up to but not including
+                ///        inner_idx[offset[j + 1]].
+                std::vector<int> offset;
+                /// @brief Inner domain indices in increasing order
+                ///        for each outer domain.
+                std::vector<int> inner_idx;
+                /// @brief Index of the lowest outer domain that
+                ///        contains each inner domain, or -1 if there
+                ///        is none.
+                std::vector<int> outer_idx;
+            };
+            /// @brief Get the table of all smaller domains contained
+            ///        in each larger one.  Each table is computed
+            ///        on first use and kept, so this is preferred over
+            ///        repeated calls to domain_nested().  If the inner domain is not
+            ///        the same as or contained within the outer
+            ///        domain, it throws an error.
+            ///
+            /// @param [in] inner_domain The contained domain type.
+            ///
+            /// @param [in] outer_domain The containing domain type.
+            ///
+            /// @return Reference to the table which is valid for the
+            ///         lifetime of the PlatformTopo object.
+            virtual const nested_table_s &domain_nested_table(int inner_domain, int outer_domain) const = 0;
             /// @brief Convert a domain type enum to a string.
             ///
             /// @details These strings are used by the geopmread and geopmwrite tools.
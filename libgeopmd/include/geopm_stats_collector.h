@@ -68,6 +68,35 @@ int GEOPM_PUBLIC
     geopm_stats_collector_create(size_t num_requests, const struct geopm_request_s *requests,
                                  struct geopm_stats_collector_s **collector);
 
+/// @brief Create a stats collector handle that also estimates quantiles
+///
+/// Same as geopm_stats_collector_create(), and additionally estimates a set of
+/// quantiles for each request.  The estimates are reported with
+/// geopm_stats_collector_report_quantile(), and the YAML report includes one
+/// entry for each quantile named by the percentile, e.g. "p95" for 0.95.  The
+/// estimates are within one percent of a sampled value and use bounded memory.
+///
+/// @param [in] num_requests Number of requests in array pointed to by the
+///        request pointer
+///
+/// @param [in] requests Array of PlatformIO signal requests that configures the
+///        report contents
+///
+/// @param [in] num_quantile Number of quantiles in array pointed to by the
+///        quantiles pointer
+///
+/// @param [in] quantiles Array of values between zero and one, e.g. 0.5 for
+///        the median
+///
+/// @param [out] collector Handle to the constructed StatsCollector object, must
+///        be de-allocated with geopm_stats_collector_free()
+///
+/// @returns 0 upon success, or error code upon failure
+int GEOPM_PUBLIC
+    geopm_stats_collector_create_quantile(size_t num_requests, const struct geopm_request_s *requests,
+                                          size_t num_quantile, const double *quantiles,
+                                          struct geopm_stats_collector_s **collector);
+
 /// @brief Update a stat collector with new values
 ///
 /// User is expected to call PlatformIO::read_batch() prior to calling this
@@ -125,6 +154,30 @@ int GEOPM_PUBLIC
     geopm_stats_collector_report(const struct geopm_stats_collector_s *collector,
                                  size_t num_requests, struct geopm_report_s *report);
 
+/// @brief Report quantile estimates
+///
+/// Provides the estimate of each quantile requested with
+/// geopm_stats_collector_create_quantile() for each request, based on the
+/// samples gathered since the last reset.
+///
+/// @param [in] collector Handle created with a call to
+///        geopm_stats_collector_create_quantile()
+///
+/// @param [in] num_requests Number of requests the quantile_values array has
+///        room for, must be at least the number used to create the collector
+///
+/// @param [in] num_quantile Number of quantiles used to create the collector
+///
+/// @param [out] quantile_values Array of num_requests * num_quantile values
+///        allocated by the user.  The estimate of quantile jj for request ii is
+///        stored at index ii * num_quantile + jj.
+///
+/// @returns 0 upon success, or error code upon failure
+int GEOPM_PUBLIC
+    geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests, size_t num_quantile,
+                                          double *quantile_values);
+
 /// @brief Reset statistics
 ///
 /// Called by user to zero all statistics gathered.  This may be called after a
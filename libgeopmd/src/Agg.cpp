@@ -9,188 +9,371 @@
 #include "geopm_hash.h"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include <algorithm>
-#include <numeric>
+#include <iterator>
 #include <map>
 
 #include "geopm/Exception.hpp"
 
+// The summation kernels are compiled for each of these instruction
+// sets and the dynamic loader selects the best one supported by the
+// CPU.  Each kernel accumulates into a fixed number of lanes in a
+// fixed order, so all versions produce identical results.  Sums,
+// averages and standard deviations may differ in the last bits from
+// those computed with a sequential loop.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_LLVM_COMPILER)
+#define GEOPM_AGG_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define GEOPM_AGG_TARGET_CLONES
+#endif
+
 namespace geopm
 {
-    std::vector<double> nan_filter(const std::vector<double> &operand)
+    static constexpr size_t M_NUM_LANE = 8;
+
+    /// Zero if the value is NAN, otherwise the value.  Masks the bits
+    /// rather than selecting so that the loops using it vectorize.
+    static inline double nan_to_zero(double value)
     {
-        std::vector<double> result;
-        std::copy_if(operand.begin(), operand.end(), std::back_inserter(result),
-                     [](double x) -> bool { return !std::isnan(x); });
-        return result;
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits &= value == value ? ~UINT64_C(0) : UINT64_C(0);
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
     }
 
-    double Agg::sum(const std::vector<double> &operand)
+    /// Sum of the non-NAN operands, returns the number of them.
+    GEOPM_AGG_TARGET_CLONES
+    static size_t nan_sum(const double *operand, size_t num_operand, double &sum)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = std::accumulate(filtered.begin(), filtered.end(), 0.0);
+        double lane_sum[M_NUM_LANE] = {};
+        double lane_count[M_NUM_LANE] = {};
+        size_t idx = 0;
+        for (; idx + M_NUM_LANE <= num_operand; idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                double value = operand[idx + lane];
+                lane_sum[lane] += nan_to_zero(value);
+                lane_count[lane] += value == value ? 1.0 : 0.0;
+            }
         }
-        return result;
+        sum = 0.0;
+        double count = 0.0;
+        for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+            sum += lane_sum[lane];
+            count += lane_count[lane];
+        }
+        for (; idx < num_operand; ++idx) {
+            if (!std::isnan(operand[idx])) {
+                sum += operand[idx];
+                count += 1.0;
+            }
+        }
+        return count;
     }
 
-    double Agg::average(const std::vector<double> &operand)
+    /// Sum and sum of squares of the non-NAN operands, returns the
+    /// number of them.
+    GEOPM_AGG_TARGET_CLONES
+    static size_t nan_sum_squares(const double *operand, size_t num_operand,
+                                  double &sum, double &sum_squares)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = Agg::sum(filtered) / filtered.size();
+        double lane_sum[M_NUM_LANE] = {};
+        double lane_sum_squares[M_NUM_LANE] = {};
+        double lane_count[M_NUM_LANE] = {};
+        size_t idx = 0;
+        for (; idx + M_NUM_LANE <= num_operand; idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                double value = operand[idx + lane];
+                lane_count[lane] += value == value ? 1.0 : 0.0;
+                value = nan_to_zero(value);
+                lane_sum[lane] += value;
+                lane_sum_squares[lane] += value * value;
+            }
         }
-        return result;
+        sum = 0.0;
+        sum_squares = 0.0;
+        double count = 0.0;
+        for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+            sum += lane_sum[lane];
+            sum_squares += lane_sum_squares[lane];
+            count += lane_count[lane];
+        }
+        for (; idx < num_operand; ++idx) {
+            if (!std::isnan(operand[idx])) {
+                sum += operand[idx];
+                sum_squares += operand[idx] * operand[idx];
+                count += 1.0;
+            }
+        }
+        return count;
     }
 
-    double Agg::median(const std::vector<double> &operand)
+    /// Minimum, or maximum if is_max is true, of the non-NAN
+    /// operands.  Returns NAN if there are none.
+    GEOPM_AGG_TARGET_CLONES
+    static double nan_extreme(const double *operand, size_t num_operand, bool is_max)
+    {
+        double sign = is_max ? -1.0 : 1.0;
+        double lane_min[M_NUM_LANE];
+        double lane_count[M_NUM_LANE] = {};
+        std::fill(lane_min, lane_min + M_NUM_LANE, INFINITY);
+        size_t idx = 0;
+        for (; idx + M_NUM_LANE <= num_operand; idx += M_NUM_LANE) {
+            for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+                // Comparisons with NAN are false
+                double value = sign * operand[idx + lane];
+                lane_min[lane] = value < lane_min[lane] ? value : lane_min[lane];
+                lane_count[lane] += std::isnan(value) ? 0.0 : 1.0;
+            }
+        }
+        double result = INFINITY;
+        double count = 0.0;
+        for (size_t lane = 0; lane < M_NUM_LANE; ++lane) {
+            result = lane_min[lane] < result ? lane_min[lane] : result;
+            count += lane_count[lane];
+        }
+        for (; idx < num_operand; ++idx) {
+            double value = sign * operand[idx];
+            if (!std::isnan(value)) {
+                result = value < result ? value : result;
+                count += 1.0;
+            }
+        }
+        return count != 0.0 ? sign * result : NAN;
+    }
+
+    static double agg_sum(const double *operand, size_t num_operand)
     {
-        auto filtered = nan_filter(operand);
+        double sum = 0.0;
+        return nan_sum(operand, num_operand, sum) ? sum : NAN;
+    }
+
+    static double agg_average(const double *operand, size_t num_operand)
+    {
+        double sum = 0.0;
+        size_t count = nan_sum(operand, num_operand, sum);
+        return count ? sum / count : NAN;
+    }
+
+    static double agg_median(const double *operand, size_t num_operand)
+    {
+        std::vector<double> filtered;
+        filtered.reserve(num_operand);
+        std::copy_if(operand, operand + num_operand, std::back_inserter(filtered),
+                     [](double x) -> bool { return !std::isnan(x); });
         double result = NAN;
         size_t num_op = filtered.size();
         if (num_op) {
             size_t mid_idx = num_op / 2;
             bool is_even = ((num_op % 2) == 0);
-            std::vector<double> operand_sorted(std::move(filtered));
-            std::sort(operand_sorted.begin(), operand_sorted.end());
-            result = operand_sorted[mid_idx];
+            std::nth_element(filtered.begin(), filtered.begin() + mid_idx, filtered.end());
+            result = filtered[mid_idx];
             if (is_even) {
-                result += operand_sorted[mid_idx - 1];
+                result += *std::max_element(filtered.begin(), filtered.begin() + mid_idx);
                 result /= 2.0;
             }
         }
         return result;
     }
 
-    double Agg::integer_bitwise_or(const std::vector<double> &operand)
+    static double agg_integer_bitwise_or(const double *operand, size_t num_operand)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            int64_t agg_tmp = 0;
-            for (const auto &it : filtered) {
-                agg_tmp |= (int64_t) it;
+        int64_t agg_tmp = 0;
+        for (size_t idx = 0; idx < num_operand; ++idx) {
+            if (!std::isnan(operand[idx])) {
+                agg_tmp |= (int64_t)operand[idx];
+                result = 0.0;
             }
-            result = (double) agg_tmp;
+        }
+        if (result == 0.0) {
+            result = (double)agg_tmp;
         }
         return result;
     }
 
-    double Agg::logical_and(const std::vector<double> &operand)
+    /// Returns 1.0 if any non-NAN operand satisfies is_nonzero ==
+    /// (operand != 0.0), 0.0 if none do, or NAN if all are NAN.
+    static double any_nonzero(const double *operand, size_t num_operand, bool is_nonzero)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            result = std::all_of(filtered.begin(), filtered.end(),
-                                 [](double it) {return (it != 0.0);});
+        for (size_t idx = 0; idx < num_operand; ++idx) {
+            if (!std::isnan(operand[idx])) {
+                if ((operand[idx] != 0.0) == is_nonzero) {
+                    return 1.0;
+                }
+                result = 0.0;
+            }
         }
         return result;
     }
 
-    double Agg::logical_or(const std::vector<double> &operand)
+    static double agg_logical_and(const double *operand, size_t num_operand)
+    {
+        double any_zero = any_nonzero(operand, num_operand, false);
+        return std::isnan(any_zero) ? NAN : 1.0 - any_zero;
+    }
+
+    static double agg_logical_or(const double *operand, size_t num_operand)
+    {
+        return any_nonzero(operand, num_operand, true);
+    }
+
+    static double common_value(const double *operand, size_t num_operand, double no_match)
     {
-        auto filtered = nan_filter(operand);
         double result = NAN;
-        if (filtered.size()) {
-            result = std::any_of(filtered.begin(), filtered.end(),
-                                 [](double it) {return (it != 0.0);});
+        for (size_t idx = 0; idx < num_operand; ++idx) {
+            if (!std::isnan(operand[idx])) {
+                if (std::isnan(result)) {
+                    result = operand[idx];
+                }
+                else if (operand[idx] != result) {
+                    return no_match;
+                }
+            }
         }
         return result;
     }
 
-    static double common_value(const std::vector<double> &operand, double no_match)
+    static double agg_stddev(const double *operand, size_t num_operand)
     {
-        auto filtered = nan_filter(operand);
+        double sum = 0.0;
+        double sum_squares = 0.0;
+        size_t count = nan_sum_squares(operand, num_operand, sum, sum_squares);
         double result = NAN;
-        if (filtered.size() != 0) {
-            result = std::all_of(filtered.cbegin(), filtered.cend(),
-                                [filtered](double x) {
-                                    return x == filtered[0];
-                                }) ?
-                     filtered[0] : no_match;
+        if (count > 1) {
+            double aa = 1.0 / (count - 1);
+            double bb = aa / count;
+            result = std::sqrt(aa * sum_squares - bb * sum * sum);
+        }
+        else if (count == 1) {
+            result = 0.0;
         }
         return result;
     }
 
+    static double agg_select_first(const double *operand, size_t num_operand)
+    {
+        // do not filter out NAN in case we are dealing with 64-bit raw MSRs
+        return num_operand > 0 ? operand[0] : 0.0;
+    }
+
+    double Agg::sum(const std::vector<double> &operand)
+    {
+        return agg_sum(operand.data(), operand.size());
+    }
+
+    double Agg::average(const std::vector<double> &operand)
+    {
+        return agg_average(operand.data(), operand.size());
+    }
+
+    double Agg::median(const std::vector<double> &operand)
+    {
+        return agg_median(operand.data(), operand.size());
+    }
+
+    double Agg::integer_bitwise_or(const std::vector<double> &operand)
+    {
+        return agg_integer_bitwise_or(operand.data(), operand.size());
+    }
+
+    double Agg::logical_and(const std::vector<double> &operand)
+    {
+        return agg_logical_and(operand.data(), operand.size());
+    }
+
+    double Agg::logical_or(const std::vector<double> &operand)
+    {
+        return agg_logical_or(operand.data(), operand.size());
+    }
+
     double Agg::region_hash(const std::vector<double> &operand)
     {
-        return common_value(operand, GEOPM_REGION_HASH_UNMARKED);
+        return common_value(operand.data(), operand.size(), GEOPM_REGION_HASH_UNMARKED);
     }
 
     double Agg::region_hint(const std::vector<double> &operand)
     {
-        return common_value(operand, GEOPM_REGION_HINT_UNKNOWN);
+        return common_value(operand.data(), operand.size(), GEOPM_REGION_HINT_UNKNOWN);
     }
 
     double Agg::min(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = *std::min_element(filtered.begin(), filtered.end());
-        }
-        return result;
+        return nan_extreme(operand.data(), operand.size(), false);
     }
 
     double Agg::max(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size()) {
-            result = *std::max_element(filtered.begin(), filtered.end());
-        }
-        return result;
+        return nan_extreme(operand.data(), operand.size(), true);
     }
 
     double Agg::stddev(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double result = NAN;
-        if (filtered.size() > 1) {
-            double sum_squared = Agg::sum(filtered);
-            sum_squared *= sum_squared;
-            std::vector<double> operand_squared(filtered);
-            for (auto &it : operand_squared) {
-                it *= it;
-            }
-            double sum_squares = Agg::sum(operand_squared);
-            double aa = 1.0 / (filtered.size() - 1);
-            double bb = aa / filtered.size();
-            result = std::sqrt(aa * sum_squares - bb * sum_squared);
-        }
-        else if (filtered.size() == 1) {
-            result = 0.0;
-        }
-        return result;
+        return agg_stddev(operand.data(), operand.size());
     }
 
     double Agg::select_first(const std::vector<double> &operand)
     {
-        // do not filter out NAN in case we are dealing with 64-bit raw MSRs
-        double result = 0.0;
-        if (operand.size() > 0) {
-            result = operand[0];
-        }
-        return result;
+        return agg_select_first(operand.data(), operand.size());
     }
 
     double Agg::expect_same(const std::vector<double> &operand)
     {
-        auto filtered = nan_filter(operand);
-        double value = NAN;
-        if (filtered.size() > 0) {
-            value = filtered[0];
-        }
-        for (auto vv : filtered) {
-            if (vv != value) {
-                value = NAN;
+        return common_value(operand.data(), operand.size(), NAN);
+    }
+
+    double Agg::aggregate(int agg_type, const double *operand, size_t num_operand)
+    {
+        double result = NAN;
+        switch (agg_type) {
+            case M_SUM:
+                result = agg_sum(operand, num_operand);
                 break;
-            }
+            case M_AVERAGE:
+                result = agg_average(operand, num_operand);
+                break;
+            case M_MEDIAN:
+                result = agg_median(operand, num_operand);
+                break;
+            case M_INTEGER_BITWISE_OR:
+                result = agg_integer_bitwise_or(operand, num_operand);
+                break;
+            case M_LOGICAL_AND:
+                result = agg_logical_and(operand, num_operand);
+                break;
+            case M_LOGICAL_OR:
+                result = agg_logical_or(operand, num_operand);
+                break;
+            case M_MIN:
+                result = nan_extreme(operand, num_operand, false);
+                break;
+            case M_MAX:
+                result = nan_extreme(operand, num_operand, true);
+                break;
+            case M_STDDEV:
+                result = agg_stddev(operand, num_operand);
+                break;
+            case M_REGION_HASH:
+                result = common_value(operand, num_operand, GEOPM_REGION_HASH_UNMARKED);
+                break;
+            case M_REGION_HINT:
+                result = common_value(operand, num_operand, GEOPM_REGION_HINT_UNKNOWN);
+                break;
+            case M_SELECT_FIRST:
+                result = agg_select_first(operand, num_operand);
+                break;
+            case M_EXPECT_SAME:
+                result = common_value(operand, num_operand, NAN);
+                break;
+            default:
+                throw Exception("Agg::aggregate(): agg_type out of range: " + std::to_string(agg_type),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        return value;
+        return result;
     }
 
     std::function<double(const std::vector<double> &)> Agg::name_to_function(const std::string &name)
@@ -237,8 +420,8 @@ namespace geopm
             {expect_same, "expect_same"},
         };
 
-        auto f_ref = *(func.target<decltype(&sum)>());
-        auto result = function_map.find(f_ref);
+        auto f_ptr = func.target<decltype(&sum)>();
+        auto result = f_ptr ? function_map.find(*f_ptr) : function_map.end();
         if (result == function_map.end()) {
             throw Exception("Agg::function_to_name(): unknown aggregation function.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -264,8 +447,8 @@ namespace geopm
             {expect_same, M_EXPECT_SAME},
         };
 
-        auto f_ref = *(func.target<decltype(&sum)>());
-        auto result = function_map.find(f_ref);
+        auto f_ptr = func.target<decltype(&sum)>();
+        auto result = f_ptr ? function_map.find(*f_ptr) : function_map.end();
         if (result == function_map.end()) {
             throw Exception("Agg::function_to_name(): unknown aggregation function.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BatchCache.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <sched.h>
+
+#include "geopm_time.h"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/SharedMemory.hpp"
+
+namespace geopm
+{
+    std::unique_ptr<BatchCache> BatchCache::make_unique(void)
+    {
+        return geopm::make_unique<BatchCacheImp>();
+    }
+
+    size_t BatchCacheImp::buffer_size(int num_entry)
+    {
+        return num_entry * sizeof(m_entry_s);
+    }
+
+    BatchCacheImp::BatchCacheImp()
+        : BatchCacheImp(create_or_attach(), M_NUM_ENTRY)
+    {
+
+    }
+
+    BatchCacheImp::BatchCacheImp(std::shared_ptr<SharedMemory> shmem,
+                                 int num_entry)
+        : BatchCacheImp(std::move(shmem), num_entry, M_ENTRY_MAX_AGE)
+    {
+
+    }
+
+    BatchCacheImp::BatchCacheImp(std::shared_ptr<SharedMemory> shmem,
+                                 int num_entry,
+                                 double max_age)
+        : m_shmem(std::move(shmem))
+        , m_num_entry(num_entry)
+        , m_max_age(max_age)
+        , m_entry(nullptr)
+        , m_key_seq(std::max(num_entry, 0), 0)
+    {
+        if (m_num_entry <= 0 ||
+            m_shmem->size() < buffer_size(m_num_entry)) {
+            throw Exception("BatchCacheImp::BatchCacheImp(): shared memory is too small for the table",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_entry = (m_entry_s *)m_shmem->pointer();
+    }
+
+    std::shared_ptr<SharedMemory> BatchCacheImp::create_or_attach(void)
+    {
+        std::shared_ptr<SharedMemory> result;
+        try {
+            result = SharedMemory::make_unique_owner_secure(
+                M_SHMEM_KEY, buffer_size(M_NUM_ENTRY));
+        }
+        catch (const Exception &ex) {
+            if (ex.err_value() != EEXIST) {
+                throw;
+            }
+            // Created by another batch server, wait up to one second
+            // for it to be sized.
+            result = SharedMemory::make_unique_user(M_SHMEM_KEY, 1);
+        }
+        return result;
+    }
+
+    bool BatchCacheImp::is_match(const m_entry_s &entry,
+                                 const geopm_request_s &request) const
+    {
+        return entry.domain_type == request.domain_type &&
+               entry.domain_idx == request.domain_idx &&
+               std::strncmp(entry.name, request.name, GEOPM_NAME_MAX) == 0;
+    }
+
+    bool BatchCacheImp::is_owned(int entry_idx, const m_entry_s &entry) const
+    {
+        return m_key_seq[entry_idx] != 0 &&
+               entry.key_seq.load(std::memory_order_relaxed) == m_key_seq[entry_idx];
+    }
+
+    bool BatchCacheImp::claim(m_entry_s &entry,
+                              uint64_t seq,
+                              const geopm_request_s &request,
+                              double time)
+    {
+        if (!entry.seq.compare_exchange_strong(seq, 1, std::memory_order_acq_rel)) {
+            return false;
+        }
+        entry.time = -INFINITY;
+        entry.value = NAN;
+        entry.touch_time = time;
+        entry.domain_type = request.domain_type;
+        entry.domain_idx = request.domain_idx;
+        std::strncpy(entry.name, request.name, GEOPM_NAME_MAX - 1);
+        entry.name[GEOPM_NAME_MAX - 1] = '\0';
+        // A reused entry gets a sequence number it never had before,
+        // so readers of the previous request detect the change.
+        entry.key_seq.store(seq + 2, std::memory_order_release);
+        entry.seq.store(seq + 2, std::memory_order_release);
+        return true;
+    }
+
+    int BatchCacheImp::entry_idx(const geopm_request_s &request)
+    {
+        geopm_time_s curr_time;
+        geopm_time(&curr_time);
+        double time = curr_time.t.tv_sec + curr_time.t.tv_nsec * 1E-9;
+        size_t hash = std::hash<std::string>{}(request.name);
+        hash ^= (size_t)request.domain_type * 31 + (size_t)request.domain_idx;
+        int result = -1;
+        int stale_idx = -1;
+        uint64_t stale_seq = 0;
+        for (int probe = 0; result == -1 && probe < m_num_entry; ++probe) {
+            int idx = (hash + probe) % m_num_entry;
+            m_entry_s &entry = m_entry[idx];
+            uint64_t seq = entry.seq.load(std::memory_order_acquire);
+            if (seq == 0) {
+                if (claim(entry, seq, request, time)) {
+                    m_key_seq[idx] = seq + 2;
+                    result = idx;
+                    continue;
+                }
+                // Another server claimed the entry first
+                seq = entry.seq.load(std::memory_order_acquire);
+            }
+            // The key is written only while seq is one.  If the
+            // inserting server died the entry is never used.
+            for (int spin = 0; seq == 1 && spin < M_INSERT_MAX_SPIN; ++spin) {
+                sched_yield();
+                seq = entry.seq.load(std::memory_order_acquire);
+            }
+            // The key_seq is stored after the key, so an unchanged
+            // key_seq identifies the key that was compared.
+            uint64_t key_seq = entry.key_seq.load(std::memory_order_acquire);
+            if (seq != 1 && is_match(entry, request)) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (entry.key_seq.load(std::memory_order_relaxed) == key_seq) {
+                    m_key_seq[idx] = key_seq;
+                    result = idx;
+                }
+            }
+            else if (stale_idx == -1 && seq != 1 && seq % 2 == 0 &&
+                     time - entry.touch_time >= m_max_age) {
+                stale_idx = idx;
+                stale_seq = seq;
+            }
+        }
+        // Table is full along the probe sequence: reuse the first
+        // entry that has not been published recently.
+        if (result == -1 && stale_idx != -1 &&
+            claim(m_entry[stale_idx], stale_seq, request, time)) {
+            m_key_seq[stale_idx] = stale_seq + 2;
+            result = stale_idx;
+        }
+        return result;
+    }
+
+    bool BatchCacheImp::lookup(const std::vector<int> &entry,
+                               double min_time,
+                               std::vector<double> &sample) const
+    {
+        sample.resize(entry.size());
+        for (size_t sample_idx = 0; sample_idx < entry.size(); ++sample_idx) {
+            if (entry[sample_idx] < 0) {
+                return false;
+            }
+            const m_entry_s &curr = m_entry[entry[sample_idx]];
+            uint64_t seq = curr.seq.load(std::memory_order_acquire);
+            if (seq % 2 == 1) {
+                return false;
+            }
+            double time = curr.time;
+            double value = curr.value;
+            bool is_valid = is_owned(entry[sample_idx], curr);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (curr.seq.load(std::memory_order_relaxed) != seq ||
+                !is_valid || !(time >= min_time)) {
+                return false;
+            }
+            sample[sample_idx] = value;
+        }
+        return true;
+    }
+
+    void BatchCacheImp::publish(const std::vector<int> &entry,
+                                double time,
+                                const std::vector<double> &sample)
+    {
+        if (entry.size() != sample.size()) {
+            throw Exception("BatchCacheImp::publish(): sample size does not match entry size",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t sample_idx = 0; sample_idx < entry.size(); ++sample_idx) {
+            if (entry[sample_idx] < 0) {
+                continue;
+            }
+            m_entry_s &curr = m_entry[entry[sample_idx]];
+            uint64_t seq = curr.seq.load(std::memory_order_relaxed);
+            // Skip entries being written by another server
+            if (seq % 2 == 1 ||
+                !curr.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire)) {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+            // The entry may have been reused for another request
+            if (is_owned(entry[sample_idx], curr) && curr.time < time) {
+                curr.time = time;
+                curr.value = sample[sample_idx];
+                if (curr.touch_time < time) {
+                    curr.touch_time = time;
+                }
+            }
+            curr.seq.store(seq + 2, std::memory_order_release);
+        }
+    }
+}
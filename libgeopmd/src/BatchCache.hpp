@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BATCHCACHE_HPP_INCLUDE
+#define BATCHCACHE_HPP_INCLUDE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "geopm_pio.h"
+
+namespace geopm
+{
+    class SharedMemory;
+
+    /// @brief Table of recently sampled signal values shared by all
+    ///        batch servers running on the node.
+    ///
+    /// Each batch server that reads its signals publishes the values
+    /// with the time they were sampled.  Other batch servers that
+    /// were asked for the same signals may copy the published values
+    /// instead of reading the hardware again, so that concurrent
+    /// sessions sampling the same signals share one read.  The table
+    /// holds at most M_NUM_ENTRY entries; an entry that was not
+    /// published for M_ENTRY_MAX_AGE seconds may be reused for another
+    /// request when no free entry is found, and servers that hold the
+    /// old index then read their own values.  Each entry is protected
+    /// by a sequence counter so that no lock is held across processes:
+    /// a server that dies while updating an entry only disables that
+    /// entry.  The table is removed by geopmd when it starts.
+    class BatchCache
+    {
+        public:
+            BatchCache() = default;
+            virtual ~BatchCache() = default;
+            /// @brief Find or insert the entry for a signal request.
+            /// @param [in] request Signal name and domain.
+            /// @return Index used with lookup() and publish(), or -1
+            ///         if no entry is available.
+            virtual int entry_idx(const geopm_request_s &request) = 0;
+            /// @brief Copy the values of all entries if every one of
+            ///        them was published at or after a given time.
+            /// @param [in] entry Indices returned by entry_idx().
+            /// @param [in] min_time Oldest acceptable sample time in
+            ///        seconds from geopm_time().
+            /// @param [out] sample Values for each entry, only
+            ///        valid if the method returns true.
+            /// @return True if every value was copied, false if any
+            ///         entry index is negative or any value is stale.
+            virtual bool lookup(const std::vector<int> &entry,
+                                double min_time,
+                                std::vector<double> &sample) const = 0;
+            /// @brief Publish freshly read values.  An entry is
+            ///        skipped if its index is negative, if another
+            ///        server is updating it, or if it holds a newer
+            ///        value.
+            /// @param [in] entry Indices returned by entry_idx().
+            /// @param [in] time Sample time in seconds from
+            ///        geopm_time().
+            /// @param [in] sample Values for each entry.
+            virtual void publish(const std::vector<int> &entry,
+                                 double time,
+                                 const std::vector<double> &sample) = 0;
+            /// @brief Create the node wide table, or attach to it
+            ///        if another batch server created it.
+            static std::unique_ptr<BatchCache> make_unique(void);
+            /// @brief Number of entries in the node wide table.
+            static constexpr int M_NUM_ENTRY = 1024;
+            /// @brief Seconds without a publish after which an entry
+            ///        may be reused for another request.
+            static constexpr double M_ENTRY_MAX_AGE = 60.0;
+    };
+
+    class BatchCacheImp : public BatchCache
+    {
+        public:
+            BatchCacheImp();
+            /// @brief Use a table stored in shared memory, the
+            ///        region must be zero filled when first used.
+            BatchCacheImp(std::shared_ptr<SharedMemory> shmem,
+                          int num_entry);
+            /// @brief Use a table stored in shared memory with a
+            ///        given age in seconds after which unused entries
+            ///        may be reused.
+            BatchCacheImp(std::shared_ptr<SharedMemory> shmem,
+                          int num_entry,
+                          double max_age);
+            virtual ~BatchCacheImp() = default;
+            int entry_idx(const geopm_request_s &request) override;
+            bool lookup(const std::vector<int> &entry,
+                        double min_time,
+                        std::vector<double> &sample) const override;
+            void publish(const std::vector<int> &entry,
+                         double time,
+                         const std::vector<double> &sample) override;
+            /// @brief Number of bytes required to store the table.
+            static size_t buffer_size(int num_entry);
+        private:
+            struct m_entry_s {
+                /// Zero while unused, one while being inserted,
+                /// otherwise odd while being published
+                std::atomic<uint64_t> seq;
+                double time;
+                double value;
+                /// Time of insertion or of the last publish
+                double touch_time;
+                /// Sequence number stored when the key was written,
+                /// unique to each insertion
+                std::atomic<uint64_t> key_seq;
+                int domain_type;
+                int domain_idx;
+                char name[GEOPM_NAME_MAX];
+            };
+            static constexpr const char *M_SHMEM_KEY =
+                "/run/geopm/batch-cache";
+            static constexpr int M_INSERT_MAX_SPIN = 1000;
+            static std::shared_ptr<SharedMemory> create_or_attach(void);
+            bool is_match(const m_entry_s &entry,
+                          const geopm_request_s &request) const;
+            /// @brief Check that an entry still holds the request
+            ///        this server inserted or found at the index.
+            bool is_owned(int entry_idx, const m_entry_s &entry) const;
+            /// @brief Store a request in an entry that is unused or
+            ///        stale, fails if the entry changed after seq was
+            ///        loaded.
+            bool claim(m_entry_s &entry,
+                       uint64_t seq,
+                       const geopm_request_s &request,
+                       double time);
+            std::shared_ptr<SharedMemory> m_shmem;
+            const int m_num_entry;
+            const double m_max_age;
+            m_entry_s *m_entry;
+            /// Value of key_seq for each index returned by
+            /// entry_idx(), zero for other indices
+            std::vector<uint64_t> m_key_seq;
+    };
+}
+
+#endif
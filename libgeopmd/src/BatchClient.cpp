@@ -12,6 +12,7 @@
 #include "geopm/SharedMemory.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/PlatformIO.hpp"
+#include "BatchRing.hpp"
 #include "BatchServer.hpp"
 #include "BatchStatus.hpp"
 
@@ -53,15 +54,23 @@ namespace geopm
         , m_batch_status(std::move(batch_status))
         , m_signal_shmem(std::move(signal_shmem))
         , m_control_shmem(std::move(control_shmem))
+        , m_is_stream(false)
     {
 
     }
 
+    BatchClientImp::~BatchClientImp() = default;
+
     std::vector<double> BatchClientImp::read_batch(void)
     {
         if (m_num_signal == 0) {
             return {};
         }
+        if (m_is_stream) {
+            std::vector<double> result;
+            m_stream_ring->latest(result);
+            return result;
+        }
         try {
             m_batch_status->send_message(BatchStatus::M_MESSAGE_READ);
             m_batch_status->receive_message(BatchStatus::M_MESSAGE_CONTINUE);
@@ -110,4 +119,56 @@ namespace geopm
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
     }
+
+    void BatchClientImp::start_stream(double period)
+    {
+        if (!(period > 0.0)) {
+            throw Exception("BatchClientImp::start_stream(): period must be positive",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_num_signal == 0) {
+            return;
+        }
+        if (m_stream_ring == nullptr) {
+            size_t offset = BatchServer::signal_ring_offset(m_num_signal);
+            m_stream_ring = geopm::make_unique<BatchRing>(
+                (char *)m_signal_shmem->pointer() + offset,
+                m_signal_shmem->size() - offset,
+                m_num_signal);
+        }
+        send_stream(period);
+        m_is_stream = true;
+    }
+
+    void BatchClientImp::stop_stream(void)
+    {
+        if (m_is_stream) {
+            send_stream(0.0);
+            m_is_stream = false;
+        }
+    }
+
+    double BatchClientImp::read_stream(std::vector<double> &sample)
+    {
+        if (!m_is_stream) {
+            throw Exception("BatchClientImp::read_stream(): called prior to start_stream()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return m_stream_ring->latest(sample);
+    }
+
+    void BatchClientImp::send_stream(double period)
+    {
+        // The server reads the period from the ring header when the
+        // stream message is received.
+        m_stream_ring->period(period);
+        try {
+            m_batch_status->send_message(BatchStatus::M_MESSAGE_STREAM);
+            m_batch_status->receive_message(BatchStatus::M_MESSAGE_CONTINUE);
+        }
+        catch (const Exception &ex) {
+            throw Exception("BatchClient::" + std::string(__func__) + " The server is unresponsive",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
 }
@@ -16,6 +16,7 @@ namespace geopm
 {
     class SharedMemory;
     class BatchStatus;
+    class BatchRing;
 
     /// @brief Interface that will attach to a batch server.  The batch server
     ///        that it connects to is typically created through a call to the
@@ -74,6 +75,35 @@ namespace geopm
 
             /// @brief Send message to batch server asking it to quit.
             virtual void stop_batch(void) = 0;
+
+            /// @brief Ask batch server to sample all signals
+            ///        periodically.
+            ///
+            /// The batch server reads all pushed signals once per
+            /// period and publishes each timestamped sample into a
+            /// ring in the signal shared memory.  While streaming,
+            /// read_batch() and read_stream() return the most recent
+            /// published sample without sending a message to the
+            /// batch server.
+            ///
+            /// @param period [in] Sampling period in units of seconds.
+            virtual void start_stream(double period) = 0;
+
+            /// @brief Ask batch server to stop periodic sampling.
+            ///
+            /// After this call read_batch() sends a read request to
+            /// the batch server again.
+            virtual void stop_stream(void) = 0;
+
+            /// @brief Copy the most recent sample published by the
+            ///        batch server after a call to start_stream().
+            ///
+            /// @param sample [out] Values of all signals, resized to
+            ///               the number of signal requests.
+            ///
+            /// @return Time of the sample in seconds based on the
+            ///         CLOCK_MONOTONIC_RAW clock.
+            virtual double read_stream(std::vector<double> &sample) = 0;
     };
 
     class BatchClientImp : public BatchClient
@@ -85,16 +115,22 @@ namespace geopm
                            std::shared_ptr<BatchStatus> batch_status,
                            std::shared_ptr<SharedMemory> signal_shmem,
                            std::shared_ptr<SharedMemory> control_shmem);
-            virtual ~BatchClientImp() = default;
+            virtual ~BatchClientImp();
             std::vector<double> read_batch(void) override;
             void write_batch(std::vector<double> settings) override;
             void stop_batch(void) override;
+            void start_stream(double period) override;
+            void stop_stream(void) override;
+            double read_stream(std::vector<double> &sample) override;
         private:
+            void send_stream(double period);
             int m_num_signal;
             int m_num_control;
             std::shared_ptr<BatchStatus> m_batch_status;
             std::shared_ptr<SharedMemory> m_signal_shmem;
             std::shared_ptr<SharedMemory> m_control_shmem;
+            std::unique_ptr<BatchRing> m_stream_ring;
+            bool m_is_stream;
     };
 }
 
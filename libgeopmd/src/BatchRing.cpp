@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BatchRing.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    // Each slot stores the sequence counter followed by the time stamp
+    // and the signal values, all eight bytes wide.
+    static size_t batch_ring_slot_size(int num_signal)
+    {
+        return (2 + num_signal) * sizeof(double);
+    }
+
+    size_t BatchRing::buffer_size(int num_signal, int capacity)
+    {
+        return sizeof(m_header_s) + capacity * batch_ring_slot_size(num_signal);
+    }
+
+    void BatchRing::init(void *buffer, size_t buffer_size,
+                         int num_signal, int capacity)
+    {
+        if (num_signal <= 0 || capacity <= 0 ||
+            buffer_size < BatchRing::buffer_size(num_signal, capacity)) {
+            throw Exception("BatchRing::init(): invalid ring size",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_header_s *header = new (buffer) m_header_s;
+        header->num_published.store(0);
+        header->num_signal = num_signal;
+        header->capacity = capacity;
+        char *slot_begin = (char *)buffer + sizeof(m_header_s);
+        size_t slot_size = batch_ring_slot_size(num_signal);
+        for (int slot_idx = 0; slot_idx < capacity; ++slot_idx) {
+            auto seq = new (slot_begin + slot_idx * slot_size) std::atomic<uint64_t>;
+            seq->store(0);
+        }
+    }
+
+    BatchRing::BatchRing(void *buffer, size_t buffer_size, int num_signal)
+        : m_header((m_header_s *)buffer)
+        , m_slot_begin((char *)buffer + sizeof(m_header_s))
+        , m_num_signal(num_signal)
+        , m_slot_size(batch_ring_slot_size(num_signal))
+    {
+        if (buffer_size < sizeof(m_header_s) ||
+            (int)m_header->num_signal != num_signal ||
+            m_header->capacity == 0 ||
+            buffer_size < BatchRing::buffer_size(num_signal, m_header->capacity)) {
+            throw Exception("BatchRing::BatchRing(): shared memory does not contain a valid sample ring",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    int BatchRing::capacity(void) const
+    {
+        return m_header->capacity;
+    }
+
+    void BatchRing::period(double period)
+    {
+        m_header->period = period;
+    }
+
+    double BatchRing::period(void) const
+    {
+        return m_header->period;
+    }
+
+    std::atomic<uint64_t> &BatchRing::slot_seq(uint64_t slot_idx) const
+    {
+        return *(std::atomic<uint64_t> *)(m_slot_begin + slot_idx * m_slot_size);
+    }
+
+    double *BatchRing::slot_data(uint64_t slot_idx) const
+    {
+        return (double *)(m_slot_begin + slot_idx * m_slot_size) + 1;
+    }
+
+    void BatchRing::publish(double time, const std::vector<double> &sample)
+    {
+        if (sample.size() != (size_t)m_num_signal) {
+            throw Exception("BatchRing::publish(): sample size does not match ring",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        uint64_t sample_idx = m_header->num_published.load(std::memory_order_relaxed);
+        uint64_t slot_idx = sample_idx % m_header->capacity;
+        auto &seq = slot_seq(slot_idx);
+        uint64_t seq_val = seq.load(std::memory_order_relaxed);
+        seq.store(seq_val + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        double *data = slot_data(slot_idx);
+        data[0] = time;
+        std::copy(sample.begin(), sample.end(), data + 1);
+        seq.store(seq_val + 2, std::memory_order_release);
+        m_header->num_published.store(sample_idx + 1, std::memory_order_release);
+    }
+
+    uint64_t BatchRing::num_published(void) const
+    {
+        return m_header->num_published.load(std::memory_order_acquire);
+    }
+
+    bool BatchRing::read(uint64_t sample_idx, double &time,
+                         std::vector<double> &sample) const
+    {
+        uint64_t capacity = m_header->capacity;
+        uint64_t num_pub = num_published();
+        if (sample_idx >= num_pub || num_pub - sample_idx > capacity) {
+            return false;
+        }
+        uint64_t slot_idx = sample_idx % capacity;
+        // The slot counter is incremented by two for each completed
+        // write, so this is the value once sample_idx is stored.
+        uint64_t expect_seq = 2 * (sample_idx / capacity + 1);
+        const auto &seq = slot_seq(slot_idx);
+        if (seq.load(std::memory_order_acquire) != expect_seq) {
+            return false;
+        }
+        const double *data = slot_data(slot_idx);
+        sample.resize(m_num_signal);
+        time = data[0];
+        std::copy(data + 1, data + 1 + m_num_signal, sample.begin());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq.load(std::memory_order_relaxed) == expect_seq;
+    }
+
+    double BatchRing::latest(std::vector<double> &sample) const
+    {
+        double result = 0.0;
+        bool is_done = false;
+        while (!is_done) {
+            uint64_t num_pub = num_published();
+            if (num_pub == 0) {
+                throw Exception("BatchRing::latest(): no sample has been published",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            // Retry only if the writer lapped the reader during the copy
+            is_done = read(num_pub - 1, result, sample);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BATCHRING_HPP_INCLUDE
+#define BATCHRING_HPP_INCLUDE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Ring of timestamped signal samples stored in a shared
+    ///        memory buffer.
+    ///
+    /// The ring is written by a single process (the batch server)
+    /// and may be read concurrently by other processes without
+    /// locks or system calls.  Each slot in the ring is protected by
+    /// a sequence counter (seqlock): the writer makes the counter odd
+    /// while the slot is being updated, and a reader discards any
+    /// copy of the slot that was made while the counter changed.
+    class BatchRing
+    {
+        public:
+            /// @brief Attach to a ring previously initialized with
+            ///        init() in the given buffer.
+            /// @param [in] buffer Start of the ring in shared memory.
+            /// @param [in] buffer_size Number of bytes available at
+            ///        buffer.
+            /// @param [in] num_signal Number of values per sample.
+            /// @throw Exception if the ring stored in the buffer does
+            ///        not match num_signal or does not fit.
+            BatchRing(void *buffer, size_t buffer_size, int num_signal);
+            virtual ~BatchRing() = default;
+            /// @brief Number of bytes required to store a ring.
+            /// @param [in] num_signal Number of values per sample.
+            /// @param [in] capacity Number of samples retained.
+            static size_t buffer_size(int num_signal, int capacity);
+            /// @brief Initialize the ring header in a zero filled
+            ///        buffer.  Called once by the writer before any
+            ///        reader attaches.
+            static void init(void *buffer, size_t buffer_size,
+                             int num_signal, int capacity);
+            /// @brief Number of samples retained by the ring.
+            int capacity(void) const;
+            /// @brief Store the sampling period requested by the
+            ///        reader.
+            void period(double period);
+            /// @return The sampling period requested by the reader.
+            double period(void) const;
+            /// @brief Publish a new sample.  Must only be called by
+            ///        the single writer.
+            /// @param [in] time Time stamp associated with the sample.
+            /// @param [in] sample Vector of num_signal values.
+            void publish(double time, const std::vector<double> &sample);
+            /// @return Total number of samples published since the
+            ///         ring was initialized.
+            uint64_t num_published(void) const;
+            /// @brief Copy a specific sample out of the ring.
+            /// @param [in] sample_idx Index of the sample, counting
+            ///        from zero for the first one published.
+            /// @param [out] time Time stamp of the sample.
+            /// @param [out] sample Values of the sample; resized to
+            ///        num_signal.
+            /// @return False if the sample has not been published yet
+            ///         or has already been overwritten.
+            bool read(uint64_t sample_idx, double &time,
+                      std::vector<double> &sample) const;
+            /// @brief Copy the most recently published sample out of
+            ///        the ring.
+            /// @param [out] sample Values of the sample; resized to
+            ///        num_signal.
+            /// @return Time stamp of the sample.
+            /// @throw Exception if no sample has been published.
+            double latest(std::vector<double> &sample) const;
+        private:
+            struct m_header_s {
+                std::atomic<uint64_t> num_published;
+                double period;
+                uint32_t num_signal;
+                uint32_t capacity;
+            };
+            std::atomic<uint64_t> &slot_seq(uint64_t slot_idx) const;
+            double *slot_data(uint64_t slot_idx) const;
+            m_header_s *m_header;
+            char *m_slot_begin;
+            const int m_num_signal;
+            const size_t m_slot_size;
+    };
+}
+
+#endif
@@ -7,6 +7,7 @@
 
 #include <cstdlib>
 #include <cerrno>
+#include <cmath>
 #include <sstream>
 #include <unistd.h>
 #include <wait.h>
@@ -17,11 +18,15 @@
 
 #include "geopm_error.h"
 #include "geopm_sched.h"
+#include "geopm_time.h"
 #include "geopm/Exception.hpp"
+#include "geopm/IOGroup.hpp"
 #include "geopm/PlatformIO.hpp"
 #include "geopm/SharedMemory.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/PlatformIO.hpp"
+#include "BatchCache.hpp"
+#include "BatchRing.hpp"
 #include "BatchStatus.hpp"
 #include "POSIXSignal.hpp"
 #include "geopm_debug.hpp"
@@ -61,12 +66,18 @@ namespace geopm
         return M_SHMEM_PREFIX + server_key + "-control";
     }
 
+    size_t BatchServer::signal_ring_offset(int num_signal)
+    {
+        return num_signal * sizeof(double);
+    }
+
     BatchServerImp::BatchServerImp(
         int client_pid,
         const std::vector<geopm_request_s> &signal_config,
         const std::vector<geopm_request_s> &control_config)
         : BatchServerImp(client_pid, signal_config, control_config, "", "",
-                         platform_io(), nullptr, nullptr, nullptr, nullptr, 0)
+                         platform_io(), nullptr, nullptr, nullptr, nullptr,
+                         nullptr, 0)
     {
 
     }
@@ -82,6 +93,7 @@ namespace geopm
         std::shared_ptr<POSIXSignal> posix_signal,
         std::shared_ptr<SharedMemory> signal_shmem,
         std::shared_ptr<SharedMemory> control_shmem,
+        std::shared_ptr<BatchCache> batch_cache,
         int server_pid)
         : m_client_pid(client_pid)
         , m_server_key(std::to_string(m_client_pid))
@@ -107,6 +119,8 @@ namespace geopm
         , m_is_active(true)
         , m_is_client_attached(false)
         , m_is_client_waiting(false)
+        , m_stream_period(0.0)
+        , m_batch_cache(std::move(batch_cache))
     {
 
     }
@@ -214,6 +228,10 @@ namespace geopm
                     m_is_client_waiting = true;
                     update_and_write();
                     break;
+                case BatchStatus::M_MESSAGE_STREAM:
+                    m_is_client_waiting = true;
+                    start_stream();
+                    break;
                 case BatchStatus::M_MESSAGE_QUIT:
                     m_is_client_waiting = true;
                     out_message = BatchStatus::M_MESSAGE_QUIT;
@@ -230,6 +248,86 @@ namespace geopm
             if (in_message != BatchStatus::M_MESSAGE_TERMINATE) {
                 write_message(out_message);
             }
+            if (out_message == BatchStatus::M_MESSAGE_CONTINUE &&
+                m_stream_period > 0.0) {
+                stream_loop();
+            }
+        }
+    }
+
+    void BatchServerImp::start_stream(void)
+    {
+        if (m_signal_config.size() == 0) {
+            return;
+        }
+        if (m_stream_ring == nullptr) {
+            size_t offset = signal_ring_offset(m_signal_config.size());
+            m_stream_ring = geopm::make_unique<BatchRing>(
+                (char *)m_signal_shmem->pointer() + offset,
+                m_signal_shmem->size() - offset,
+                m_signal_config.size());
+            m_stream_sample.resize(m_signal_config.size());
+            init_cache();
+        }
+        // The period is written by the client into shared memory, so
+        // it is bounded before it controls the loop in the server.
+        m_stream_period = m_stream_ring->period();
+        if (!std::isfinite(m_stream_period) || m_stream_period <= 0.0) {
+            m_stream_period = 0.0;
+        }
+        else if (m_stream_period < M_STREAM_PERIOD_MIN) {
+            m_stream_period = M_STREAM_PERIOD_MIN;
+        }
+        if (m_stream_period > 0.0) {
+            read_and_update();
+        }
+    }
+
+    void BatchServerImp::stream_loop(void)
+    {
+        geopm_time_s next_time;
+        geopm_time(&next_time);
+        bool is_pending = false;
+        while (!is_pending && g_sigterm_count == 0) {
+            geopm_time_add(&next_time, m_stream_period, &next_time);
+            double timeout = -geopm_time_since(&next_time);
+            if (timeout < 0.0) {
+                // Fell behind by more than a period: restart the
+                // schedule rather than publishing a burst of samples.
+                geopm_time(&next_time);
+                timeout = 0.0;
+            }
+            is_pending = m_batch_status->poll_message(timeout);
+            if (!is_pending && g_sigterm_count == 0) {
+                read_and_update();
+            }
+        }
+    }
+
+    void BatchServerImp::init_cache(void)
+    {
+        if (m_batch_cache == nullptr) {
+            try {
+                m_batch_cache = BatchCache::make_unique();
+            }
+            catch (const Exception &ex) {
+                std::cerr << "Warning: <geopm>: Unable to share samples with other batch servers: "
+                          << ex.what() << "\n";
+                return;
+            }
+        }
+        // Values of monotone signals, e.g. accumulated energy or elapsed
+        // time, and of signals derived from the recent samples, e.g.
+        // power, depend on the state of the PlatformIO that reads them,
+        // so they are never shared between servers.
+        m_cache_entry.clear();
+        for (const auto &req : m_signal_config) {
+            int entry = -1;
+            if (m_pio.signal_behavior(req.name) != IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE &&
+                !m_pio.is_signal_derived(req.name)) {
+                entry = m_batch_cache->entry_idx(req);
+            }
+            m_cache_entry.push_back(entry);
         }
     }
 
@@ -256,12 +354,35 @@ namespace geopm
             return;
         }
 
-        m_pio.read_batch();
-        double *shmem_buffer = (double *)m_signal_shmem->pointer();
-        int buffer_idx = 0;
-        for (const auto &handle : m_signal_handle) {
-            shmem_buffer[buffer_idx] = m_pio.sample(handle);
-            ++buffer_idx;
+        geopm_time_s sample_time;
+        geopm_time(&sample_time);
+        if (m_stream_period > 0.0) {
+            double time = sample_time.t.tv_sec + sample_time.t.tv_nsec * 1E-9;
+            // Use values read by another server within half a period
+            // rather than reading the same signals again.
+            if (m_batch_cache == nullptr ||
+                !m_batch_cache->lookup(m_cache_entry, time - 0.5 * m_stream_period,
+                                       m_stream_sample)) {
+                m_pio.read_batch();
+                int sample_idx = 0;
+                for (const auto &handle : m_signal_handle) {
+                    m_stream_sample[sample_idx] = m_pio.sample(handle);
+                    ++sample_idx;
+                }
+                if (m_batch_cache != nullptr) {
+                    m_batch_cache->publish(m_cache_entry, time, m_stream_sample);
+                }
+            }
+            m_stream_ring->publish(time, m_stream_sample);
+        }
+        else {
+            m_pio.read_batch();
+            double *shmem_buffer = (double *)m_signal_shmem->pointer();
+            int buffer_idx = 0;
+            for (const auto &handle : m_signal_handle) {
+                shmem_buffer[buffer_idx] = m_pio.sample(handle);
+                ++buffer_idx;
+            }
         }
     }
 
@@ -283,13 +404,22 @@ namespace geopm
     void BatchServerImp::create_shmem(void)
     {
         // Create shared memory regions
-        size_t signal_size  = m_signal_config.size()  * sizeof(double);
+        size_t signal_size = 0;
+        if (m_signal_config.size() != 0) {
+            signal_size = signal_ring_offset(m_signal_config.size()) +
+                          BatchRing::buffer_size(m_signal_config.size(),
+                                                 M_STREAM_CAPACITY);
+        }
         size_t control_size = m_control_config.size() * sizeof(double);
         int uid = pid_to_uid(m_client_pid);
         int gid = pid_to_gid(m_client_pid);
         if (signal_size != 0) {
             m_signal_shmem = SharedMemory::make_unique_owner_secure(
                 m_signal_shmem_key, signal_size);
+            size_t offset = signal_ring_offset(m_signal_config.size());
+            BatchRing::init((char *)m_signal_shmem->pointer() + offset,
+                            signal_size - offset, m_signal_config.size(),
+                            M_STREAM_CAPACITY);
             // Requires a chown if server is different user than client
             m_signal_shmem->chown(uid, gid);
         }
@@ -20,6 +20,8 @@ namespace geopm
     class PlatformIO;
     class SharedMemory;
     class BatchStatus;
+    class BatchRing;
+    class BatchCache;
     class POSIXSignal;
 
     class BatchServer
@@ -58,6 +60,12 @@ namespace geopm
             /// SharedMemory::make_unique_user() as the shm_key
             /// parameter.
             ///
+            /// The signal region begins with one double for each
+            /// signal request, which is updated on each read request
+            /// from the client.  It is followed by a BatchRing of
+            /// timestamped samples that is written periodically by
+            /// the server after the client sends a stream request.
+            ///
             /// @param [in] client_pid The Unix process ID of the
             ///        client process that is initiating the batch
             ///        server.
@@ -90,6 +98,16 @@ namespace geopm
             virtual void run_batch(void) = 0;
             virtual void create_shmem(void) = 0;
             virtual void register_handler(void) = 0;
+            /// @return Number of bytes used at the start of the signal
+            ///         shared memory region before the sample ring.
+            static size_t signal_ring_offset(int num_signal);
+            /// @brief Number of samples retained in the ring of the
+            ///        signal shared memory region.
+            static constexpr int M_STREAM_CAPACITY = 16;
+            /// @brief Shortest sampling period in seconds used by the
+            ///        stream loop; shorter periods requested by a
+            ///        client are raised to this value.
+            static constexpr double M_STREAM_PERIOD_MIN = 0.001;
         protected:
             static constexpr const char* M_SHMEM_PREFIX =
                 "/run/geopm/batch-buffer-";
@@ -111,6 +129,7 @@ namespace geopm
                            std::shared_ptr<POSIXSignal> posix_signal,
                            std::shared_ptr<SharedMemory> signal_shmem,
                            std::shared_ptr<SharedMemory> control_shmem,
+                           std::shared_ptr<BatchCache> batch_cache,
                            int server_pid);
             BatchServerImp(const BatchServerImp &other) = delete;
             BatchServerImp &operator=(const BatchServerImp &other) = delete;
@@ -129,6 +148,18 @@ namespace geopm
             char read_message(void);
             void write_message(char message);
             void event_loop(void);
+            /// @brief Handle a stream request: the sampling period is
+            ///        read from the ring header written by the client.
+            ///        A positive period publishes the first sample and
+            ///        enables streaming, otherwise streaming stops.
+            void start_stream(void);
+            /// @brief Publish samples into the ring once per period
+            ///        until a message from the client is pending.
+            void stream_loop(void);
+            /// @brief Attach to the node wide BatchCache and find the
+            ///        entry for each pushed signal that may be shared
+            ///        with other batch servers.
+            void init_cache(void);
         private:
             const int m_client_pid;
             const std::string m_server_key;
@@ -145,6 +176,13 @@ namespace geopm
             bool m_is_active;
             bool m_is_client_attached;
             bool m_is_client_waiting;
+            double m_stream_period;
+            std::unique_ptr<BatchRing> m_stream_ring;
+            std::vector<double> m_stream_sample;
+            std::shared_ptr<BatchCache> m_batch_cache;
+            /// @brief Index into the BatchCache for each pushed
+            ///        signal, or -1 if the signal is not shared
+            std::vector<int> m_cache_entry;
             /// @brief Stores the PlatformIO batch handles for all pushed
             ///        signals
             std::vector<int> m_signal_handle;
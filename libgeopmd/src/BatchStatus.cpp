@@ -11,7 +11,9 @@
 #include "geopm/Helper.hpp"
 
 #include <cerrno>
+#include <cmath>
 #include <sstream>
+#include <poll.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -76,6 +78,25 @@ namespace geopm
         }
     }
 
+    bool BatchStatusImp::poll_message(double timeout)
+    {
+        open_fifo();
+        struct pollfd poll_fd = {};
+        poll_fd.fd = m_read_fd;
+        poll_fd.events = POLLIN;
+        struct timespec timeout_ts = {};
+        if (timeout > 0.0) {
+            timeout_ts.tv_sec = (time_t)timeout;
+            timeout_ts.tv_nsec = (long)((timeout - std::floor(timeout)) * 1E9);
+        }
+        int ret = ppoll(&poll_fd, 1, &timeout_ts, nullptr);
+        if (ret == -1 && errno == EINTR) {
+            return false;
+        }
+        check_return(ret, "ppoll(2)");
+        return ret == 1;
+    }
+
     void BatchStatusImp::check_return(int ret, const std::string &func_name)
     {
         if (ret == -1) {
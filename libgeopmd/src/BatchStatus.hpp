@@ -19,6 +19,7 @@ namespace geopm
         public:
             static constexpr char M_MESSAGE_READ = 'r';
             static constexpr char M_MESSAGE_WRITE = 'w';
+            static constexpr char M_MESSAGE_STREAM = 's';
             static constexpr char M_MESSAGE_CONTINUE = 'c';
             static constexpr char M_MESSAGE_QUIT = 'q';
             static constexpr char M_MESSAGE_TERMINATE = 't';
@@ -48,6 +49,17 @@ namespace geopm
             /// @throw Exception if a message is received, but the
             ///        message does not match the expected_message.
             virtual void receive_message(char expect) = 0;
+            /// @brief Wait until a message from the other process
+            ///        is available to be received.
+            ///
+            /// @param timeout [in] Maximum time to wait in seconds.
+            ///                     A value of zero or less checks
+            ///                     without waiting.
+            ///
+            /// @return True if a call to receive_message() will not
+            ///         block, false if the timeout expired or the
+            ///         wait was interrupted by a signal.
+            virtual bool poll_message(double timeout) = 0;
     };
 
     class BatchStatusImp : public BatchStatus
@@ -58,6 +70,7 @@ namespace geopm
             void send_message(char msg) override;
             char receive_message(void) override;
             void receive_message(char expect) override;
+            bool poll_message(double timeout) override;
 
         protected:
             virtual void open_fifo(void) = 0;
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BatchThreadPool.hpp"
+
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+
+namespace geopm
+{
+    std::unique_ptr<BatchThreadPool> BatchThreadPool::make_unique(int num_thread)
+    {
+        return geopm::make_unique<BatchThreadPoolImp>(num_thread);
+    }
+
+    BatchThreadPoolImp::BatchThreadPoolImp(int num_thread)
+        : m_task(nullptr)
+        , m_num_task(0)
+        , m_next_task(0)
+        , m_num_active(0)
+        , m_generation(0)
+        , m_is_shutdown(false)
+    {
+        if (num_thread < 0) {
+            throw Exception("BatchThreadPoolImp::BatchThreadPoolImp(): number of threads must be non-negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_thread.reserve(num_thread);
+        for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+            m_thread.emplace_back(&BatchThreadPoolImp::worker, this);
+        }
+    }
+
+    BatchThreadPoolImp::~BatchThreadPoolImp()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_is_shutdown = true;
+        }
+        m_start_cv.notify_all();
+        for (auto &thread : m_thread) {
+            thread.join();
+        }
+    }
+
+    void BatchThreadPoolImp::run(int num_task, const std::function<void(int)> &task)
+    {
+        if (m_thread.empty() || num_task < 2) {
+            for (int task_idx = 0; task_idx < num_task; ++task_idx) {
+                task(task_idx);
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_task = &task;
+            m_num_task = num_task;
+            m_next_task.store(0);
+            m_num_active = m_thread.size();
+            m_error = nullptr;
+            ++m_generation;
+        }
+        m_start_cv.notify_all();
+        execute();
+        std::exception_ptr error;
+        {
+            // Wait for every worker to leave execute() so that no
+            // worker can claim a task index from a later generation
+            // while still holding a reference to this one.
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done_cv.wait(lock, [this]{ return m_num_active == 0; });
+            m_task = nullptr;
+            error = m_error;
+            m_error = nullptr;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    int BatchThreadPoolImp::num_thread(void) const
+    {
+        return m_thread.size();
+    }
+
+    void BatchThreadPoolImp::worker(void)
+    {
+        unsigned generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start_cv.wait(lock, [this, generation]{
+                    return m_is_shutdown || m_generation != generation;
+                });
+                if (m_is_shutdown) {
+                    break;
+                }
+                generation = m_generation;
+            }
+            execute();
+            bool is_last = false;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_num_active;
+                is_last = m_num_active == 0;
+            }
+            if (is_last) {
+                m_done_cv.notify_one();
+            }
+        }
+    }
+
+    void BatchThreadPoolImp::execute(void)
+    {
+        for (int task_idx = m_next_task.fetch_add(1);
+             task_idx < m_num_task;
+             task_idx = m_next_task.fetch_add(1)) {
+            try {
+                (*m_task)(task_idx);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+            }
+        }
+    }
+}
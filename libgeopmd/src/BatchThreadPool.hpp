@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BATCHTHREADPOOL_HPP_INCLUDE
+#define BATCHTHREADPOOL_HPP_INCLUDE
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Small persistent pool of threads used to execute a
+    ///        fixed number of independent tasks concurrently, e.g.
+    ///        the read_batch() of each IOGroup registered with
+    ///        PlatformIO.
+    class BatchThreadPool
+    {
+        public:
+            BatchThreadPool() = default;
+            virtual ~BatchThreadPool() = default;
+            /// @brief Execute task(idx) for every idx in the range
+            ///        [0, num_task) and block until all tasks are
+            ///        complete.  The calling thread participates in
+            ///        the execution of the tasks.  If any task
+            ///        throws, the first exception raised is rethrown
+            ///        after all tasks have completed.
+            /// @param [in] num_task Number of tasks to execute.
+            /// @param [in] task Function called once for each task
+            ///        index.  Different indices may be executed
+            ///        concurrently.
+            virtual void run(int num_task, const std::function<void(int)> &task) = 0;
+            /// @brief Number of worker threads created by the pool in
+            ///        addition to the calling thread.
+            virtual int num_thread(void) const = 0;
+            /// @brief Create a pool with the given number of worker
+            ///        threads.
+            static std::unique_ptr<BatchThreadPool> make_unique(int num_thread);
+    };
+
+    class BatchThreadPoolImp : public BatchThreadPool
+    {
+        public:
+            BatchThreadPoolImp(int num_thread);
+            BatchThreadPoolImp(const BatchThreadPoolImp &other) = delete;
+            BatchThreadPoolImp &operator=(const BatchThreadPoolImp &other) = delete;
+            virtual ~BatchThreadPoolImp();
+            void run(int num_task, const std::function<void(int)> &task) override;
+            int num_thread(void) const override;
+        private:
+            void worker(void);
+            /// @brief Claim and execute tasks from the current
+            ///        generation until none remain.
+            void execute(void);
+            std::vector<std::thread> m_thread;
+            std::mutex m_mutex;
+            std::condition_variable m_start_cv;
+            std::condition_variable m_done_cv;
+            const std::function<void(int)> *m_task;
+            int m_num_task;
+            std::atomic<int> m_next_task;
+            int m_num_active;
+            unsigned m_generation;
+            bool m_is_shutdown;
+            std::exception_ptr m_error;
+    };
+}
+
+#endif
@@ -6,17 +6,23 @@
 #include "CNLIOGroup.hpp"
 
 #include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
-#include <fstream>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "geopm/Agg.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/PlatformTopo.hpp"
+#include "IOUring.hpp"
 
 
 namespace geopm
@@ -24,10 +30,10 @@ namespace geopm
     static const std::string FRESHNESS_FILE_NAME("freshness");
     static const std::string RAW_SCAN_HZ_FILE_NAME("raw_scan_hz");
 
-    static std::function<double()> get_formatted_file_reader(const std::string &path,
-                                                             const std::string &units)
+    // Value of a signal that is the value read from its file
+    static double file_value(double value)
     {
-        return std::bind(read_double_from_file, path, units);
+        return value;
     }
 
     CNLIOGroup::CNLIOGroup()
@@ -36,11 +42,19 @@ namespace geopm
     }
 
     CNLIOGroup::CNLIOGroup(const std::string &cpu_info_path)
-        : m_signal_available({{"CNL::BOARD_POWER", {
+        : CNLIOGroup(cpu_info_path, nullptr)
+    {
+    }
+
+    CNLIOGroup::CNLIOGroup(const std::string &cpu_info_path,
+                           std::shared_ptr<IOUring> batch_reader)
+        : m_signal_available({
+                              {"CNL::BOARD_POWER", {
                                    "Point in time power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/power", "W"),
+                                   M_FILE_POWER,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_WATTS,
@@ -49,7 +63,8 @@ namespace geopm
                                    "Accumulated energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/energy", "J"),
+                                   M_FILE_ENERGY,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_JOULES,
@@ -58,7 +73,8 @@ namespace geopm
                                    "Point in time memory power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/memory_power", "W"),
+                                   M_FILE_MEMORY_POWER,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_WATTS,
@@ -67,7 +83,8 @@ namespace geopm
                                    "Accumulated memory energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/memory_energy", "J"),
+                                   M_FILE_MEMORY_ENERGY,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_JOULES,
@@ -76,7 +93,8 @@ namespace geopm
                                    "Point in time CPU power",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/cpu_power", "W"),
+                                   M_FILE_CPU_POWER,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_WATTS,
@@ -85,7 +103,8 @@ namespace geopm
                                    "Accumulated CPU energy",
                                    Agg::sum,
                                    string_format_integer,
-                                   get_formatted_file_reader(cpu_info_path + "/cpu_energy", "J"),
+                                   M_FILE_CPU_ENERGY,
+                                   file_value,
                                    false,
                                    NAN,
                                    M_UNITS_JOULES,
@@ -94,7 +113,8 @@ namespace geopm
                                    "Sample frequency",
                                    Agg::expect_same,
                                    string_format_integer,
-                                   std::bind(&CNLIOGroup::m_sample_rate, this),
+                                   M_NUM_FILE,
+                                   [this](double) { return m_sample_rate; },
                                    false,
                                    NAN,
                                    M_UNITS_HERTZ,
@@ -103,12 +123,15 @@ namespace geopm
                                    "Time that the sample was reported, in seconds since this agent initialized",
                                    Agg::max,
                                    string_format_double,
-                                   std::bind(&CNLIOGroup::read_time, this, cpu_info_path + "/" + FRESHNESS_FILE_NAME),
+                                   M_FILE_FRESHNESS,
+                                   std::bind(&CNLIOGroup::elapsed_time, this, std::placeholders::_1),
                                    false,
                                    NAN,
                                    M_UNITS_SECONDS,
                                    IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE}},
                              })
+        , m_batch_reader(std::move(batch_reader))
+        , m_do_batch_read(false)
         , m_time_zero(geopm::time_zero())
     {
         m_sample_rate = read_double_from_file(
@@ -118,14 +141,34 @@ namespace geopm
                                 std::to_string(m_sample_rate),
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
-        m_initial_freshness =
-            read_double_from_file(cpu_info_path + "/" + FRESHNESS_FILE_NAME, "");
-
-        for (const auto &signal : m_signal_available) {
-            // Attempt to call each of the read functions so we can fail
-            // construction of this IOGroup if it isn't supported.
-            signal.second.m_read_function();
+        // File name and units of each m_file_e
+        const std::vector<std::pair<std::string, std::string> > file_names = {
+            {"power", "W"},
+            {"energy", "J"},
+            {"memory_power", "W"},
+            {"memory_energy", "J"},
+            {"cpu_power", "W"},
+            {"cpu_energy", "J"},
+            {FRESHNESS_FILE_NAME, ""},
+        };
+        m_file.reserve(M_NUM_FILE);
+        for (const auto &file_name : file_names) {
+            std::string path = cpu_info_path + "/" + file_name.first;
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd == -1) {
+                throw Exception("CNLIOGroup::CNLIOGroup(): file \"" + path +
+                                "\" could not be opened",
+                                errno ? errno : GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            m_file.push_back({path, file_name.second, fd, std::make_shared<int>(0),
+                              {}, false, NAN});
+        }
+        // Attempt to read each of the files so we can fail
+        // construction of this IOGroup if it isn't supported.
+        for (int file_idx = 0; file_idx != M_NUM_FILE; ++file_idx) {
+            m_file[file_idx].value = read_file(file_idx);
         }
+        m_initial_freshness = m_file[M_FILE_FRESHNESS].value;
 
         register_signal_alias("BOARD_POWER", "CNL::BOARD_POWER");
         register_signal_alias("BOARD_ENERGY", "CNL::BOARD_ENERGY");
@@ -179,7 +222,12 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        m_signal_available[signal_name].m_do_read = true;
+        auto &info = m_signal_available[signal_name];
+        info.m_do_read = true;
+        if (info.m_file_idx != M_NUM_FILE) {
+            m_file[info.m_file_idx].do_read = true;
+            m_do_batch_read = true;
+        }
         return std::distance(m_signal_available.begin(), m_signal_available.find(signal_name));
     }
 
@@ -192,9 +240,28 @@ namespace geopm
 
     void CNLIOGroup::read_batch(void)
     {
+        if (m_do_batch_read) {
+            if (!m_batch_reader) {
+                m_batch_reader = IOUring::make_unique(M_NUM_FILE);
+            }
+            for (auto &file : m_file) {
+                if (file.do_read) {
+                    m_batch_reader->prep_read(file.last_io_return, file.fd.get(),
+                                              file.buf.data(), file.buf.size(), 0);
+                }
+            }
+            m_batch_reader->submit();
+            for (auto &file : m_file) {
+                if (file.do_read) {
+                    file.value = parse_file(file, *file.last_io_return);
+                }
+            }
+        }
         for (auto &signal : m_signal_available) {
-            if (signal.second.m_do_read) {
-                signal.second.m_value = signal.second.m_read_function();
+            auto &info = signal.second;
+            if (info.m_do_read) {
+                info.m_value = info.m_value_function(
+                    info.m_file_idx != M_NUM_FILE ? m_file[info.m_file_idx].value : NAN);
             }
         }
     }
@@ -243,7 +310,9 @@ namespace geopm
                             "not valid for CNLIOGroup",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        return m_signal_available.find(signal_name)->second.m_read_function();
+        const auto &info = m_signal_available.find(signal_name)->second;
+        return info.m_value_function(
+            info.m_file_idx != M_NUM_FILE ? read_file(info.m_file_idx) : NAN);
     }
 
     void CNLIOGroup::write_control(const std::string &control_name,
@@ -353,12 +422,73 @@ namespace geopm
         return geopm::make_unique<CNLIOGroup>();
     }
 
-    double CNLIOGroup::read_time(const std::string &freshness_path) const
+    double CNLIOGroup::elapsed_time(double freshness) const
     {
-        auto freshness = read_double_from_file(freshness_path, "");
         return (freshness - m_initial_freshness) / m_sample_rate;
     }
 
+    double CNLIOGroup::read_file(int file_idx)
+    {
+        m_file_s &file = m_file[file_idx];
+        int read_return = pread(file.fd.get(), file.buf.data(), file.buf.size(), 0);
+        return parse_file(file, read_return < 0 ? -errno : read_return);
+    }
+
+    double CNLIOGroup::parse_file(m_file_s &file, int read_return)
+    {
+        if (read_return < 0) {
+            throw Exception("CNLIOGroup: failed to read " + file.path,
+                            -read_return, __FILE__, __LINE__);
+        }
+        size_t size = read_return;
+        if (size == 0) {
+            throw Exception("CNLIOGroup: empty file " + file.path,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (size >= file.buf.size()) {
+            throw Exception("CNLIOGroup: truncated read of " + file.path,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        char *content = file.buf.data();
+        content[size] = '\0';
+        // Parse in place with the same rules as read_double_from_file():
+        // a number followed by the expected units, if any, where the
+        // units are separated from the number by whitespace or null
+        // characters.
+        char *value_end = nullptr;
+        errno = 0;
+        double value = strtod(content, &value_end);
+        if (value_end == content) {
+            throw std::invalid_argument("CNLIOGroup: no value in " + file.path);
+        }
+        if (errno == ERANGE) {
+            throw std::out_of_range("CNLIOGroup: value out of range in " + file.path);
+        }
+        auto is_separator = [](char cc) {
+            return cc == ' ' || cc == '\t' || cc == '\n' || cc == '\0';
+        };
+        const char *units_begin = value_end;
+        const char *content_end = content + size;
+        while (units_begin != content_end && is_separator(*units_begin)) {
+            ++units_begin;
+        }
+        const char *units_end = content_end;
+        while (units_end != units_begin && is_separator(*(units_end - 1))) {
+            --units_end;
+        }
+        bool units_exist = units_begin != content_end;
+        bool units_are_expected = !file.units.empty();
+        if ((units_exist != units_are_expected) ||
+            (units_exist &&
+             (units_begin == value_end ||
+              (size_t)(units_end - units_begin) != file.units.size() ||
+              std::memcmp(units_begin, file.units.data(), file.units.size()) != 0))) {
+            throw Exception("Unexpected format in " + file.path, GEOPM_ERROR_RUNTIME,
+                            __FILE__, __LINE__);
+        }
+        return value;
+    }
+
     void CNLIOGroup::register_signal_alias(const std::string &alias_name,
                                            const std::string &signal_name)
     {
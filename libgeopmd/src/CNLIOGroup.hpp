@@ -5,14 +5,20 @@
 #ifndef CNLIOGROUP_HPP_INCLUDE
 #define CNLIOGROUP_HPP_INCLUDE
 
+#include <array>
 #include <functional>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "geopm/IOGroup.hpp"
 #include "geopm_time.h"
+#include "UniqueFd.hpp"
 
 namespace geopm
 {
+    class IOUring;
+
     /// @brief IOGroup that wraps interfaces to Compute Node Linux.
     ///
     /// @details The CNLIOGroup provides board-level energy counters from Compute Node Linux
@@ -22,6 +28,8 @@ namespace geopm
         public:
             CNLIOGroup();
             CNLIOGroup(const std::string &pm_counters_path);
+            CNLIOGroup(const std::string &pm_counters_path,
+                       std::shared_ptr<IOUring> batch_reader);
             virtual ~CNLIOGroup() = default;
             /// @return the list of signal names provided by this IOGroup.
             std::set<std::string> signal_names(void) const override;
@@ -57,7 +65,9 @@ namespace geopm
             ///        sample() will reflect the updated data.
             ///
             /// @details The intention is that read_batch() will read the all of the
-            ///          IOGroup's signals into memory once per call.
+            ///          IOGroup's signals into memory once per call.  Each
+            ///          pm_counters file that a pushed signal depends on is
+            ///          read once through a file descriptor that is kept open.
             void read_batch(void) override;
             /// @brief Does nothing; this IOGroup does not provide any controls.
             void write_batch(void) override;
@@ -140,11 +150,29 @@ namespace geopm
         private:
             void register_signal_alias(const std::string &alias_name, const std::string &signal_name);
 
+            enum m_file_e {
+                M_FILE_POWER,
+                M_FILE_ENERGY,
+                M_FILE_MEMORY_POWER,
+                M_FILE_MEMORY_ENERGY,
+                M_FILE_CPU_POWER,
+                M_FILE_CPU_ENERGY,
+                M_FILE_FRESHNESS,
+                M_NUM_FILE,
+            };
+
+            // Size of the largest sysfs attribute
+            static constexpr size_t M_MAX_FILE_SIZE = 4096;
+
             struct m_signal_info_s {
                 std::string m_description;
                 std::function<double(const std::vector<double> &)> m_agg_function;
                 std::function<std::string(double)> m_format_function;
-                std::function<double()> m_read_function;
+                // The pm_counters file the signal is read from, or
+                // M_NUM_FILE if the signal is not read from a file
+                int m_file_idx;
+                // Signal value given the value parsed from the file
+                std::function<double(double)> m_value_function;
                 bool m_do_read;
                 double m_value;
                 int m_units;
@@ -152,8 +180,28 @@ namespace geopm
             };
             std::map<std::string, m_signal_info_s> m_signal_available;
 
-            double read_time(const std::string &freshness_path) const;
+            struct m_file_s {
+                std::string path;
+                std::string units;
+                UniqueFd fd;
+                std::shared_ptr<int> last_io_return;
+                // One extra byte for the null terminator
+                std::array<char, M_MAX_FILE_SIZE + 1> buf;
+                bool do_read;
+                double value;
+            };
+            /// @brief Parse the value from the content of a file
+            ///        read into its buffer.
+            /// @param [in] file The file that was read.
+            /// @param [in] read_return Return value of the read.
+            /// @return The value that precedes the units in the file.
+            static double parse_file(m_file_s &file, int read_return);
+            double read_file(int file_idx);
+            double elapsed_time(double freshness) const;
 
+            std::vector<m_file_s> m_file;
+            std::shared_ptr<IOUring> m_batch_reader;
+            bool m_do_batch_read;
             geopm_time_s m_time_zero;
             double m_initial_freshness;
             double m_sample_rate;
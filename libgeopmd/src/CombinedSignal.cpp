@@ -22,12 +22,21 @@ namespace geopm
 
     CombinedSignal::CombinedSignal(std::function<double(const std::vector<double> &)> func)
         : m_agg_function(std::move(func))
+        , m_agg_type(-1)
     {
-
+        try {
+            m_agg_type = Agg::function_to_type(m_agg_function);
+        }
+        catch (const Exception &) {
+            // Not a built in function, call through m_agg_function
+        }
     }
 
     double CombinedSignal::sample(const std::vector<double> &values)
     {
+        if (m_agg_type != -1) {
+            return Agg::aggregate(m_agg_type, values.data(), values.size());
+        }
         return m_agg_function(values);
     }
 }
@@ -26,6 +26,10 @@ namespace geopm
             ///        values to produce the combined signal.
             virtual double sample(const std::vector<double> &values);
             std::function<double(const std::vector<double> &)> m_agg_function;
+        private:
+            /// Agg::m_type_e value of m_agg_function if it is a built
+            /// in Agg function, otherwise -1.
+            int m_agg_type;
     };
 }
 
@@ -162,7 +162,7 @@ namespace geopm
         return oss.str();
     }
 
-    std::function<double(const std::string &)> DrmSysfsDriver::signal_parse(const std::string &signal_name) const
+    std::function<double(const char *)> DrmSysfsDriver::signal_parse(const std::string &signal_name) const
     {
         auto prop_it = M_PROPERTIES.find(signal_name);
         if (prop_it == M_PROPERTIES.end()) {
@@ -170,16 +170,8 @@ namespace geopm
                             GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
         double scaling_factor = prop_it->second.scaling_factor;
-        return [scaling_factor](const std::string &content) {
-            double result = static_cast<double>(NAN);
-            try {
-                result = static_cast<double>(std::stol(content) * scaling_factor);
-            }
-            catch (const std::invalid_argument &ex) {
-            }
-            catch (const std::out_of_range &ex) {
-            }
-            return result;
+        return [scaling_factor](const char *content) {
+            return SysfsDriver::parse_integer(content, scaling_factor);
         };
     }
 
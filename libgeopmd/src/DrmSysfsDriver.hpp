@@ -30,7 +30,7 @@ namespace geopm
             int domain_type(const std::string &name) const override;
             std::string attribute_path(const std::string &name,
                                        int domain_idx) override;
-            std::function<double(const std::string&)> signal_parse(const std::string &signal_name) const override;
+            std::function<double(const char *)> signal_parse(const std::string &signal_name) const override;
             std::function<std::string(double)> control_gen(const std::string &control_name) const override;
             std::string driver(void) const override;
             std::map<std::string, SysfsDriver::properties_s> properties(void) const override;
@@ -209,6 +209,11 @@ namespace geopm
         return result;
     }
 
+    bool IOGroup::is_signal_derived(const std::string &signal_name) const
+    {
+        return false;
+    }
+
     IOGroup::m_units_e IOGroup::string_to_units(const std::string &str)
     {
         auto it = M_UNITS_STRING.find(str);
@@ -26,17 +26,18 @@ namespace geopm
     {
         errno = 0;
         for (const auto &operation : m_operations) {
-            int ret = operation.second();
+            int ret = operation.is_write ?
+                      pwrite(operation.fd, operation.buf, operation.nbytes, operation.offset) :
+                      pread(operation.fd, operation.buf, operation.nbytes, operation.offset);
             if (ret < 0) {
                 ret = -errno;
             }
             errno = 0;
 
-            auto result_destination = operation.first;
-            if (result_destination) {
+            if (operation.ret) {
                 // The caller of prep_...() for this operation wants to
                 // know the return value of the operation, so write it back.
-                *result_destination = ret;
+                *operation.ret = ret;
             }
         }
 
@@ -46,13 +47,13 @@ namespace geopm
     void IOUringFallback::prep_read(std::shared_ptr<int> ret, int fd, void *buf,
                                     unsigned nbytes, off_t offset)
     {
-        m_operations.emplace_back(ret, std::bind(pread, fd, buf, nbytes, offset));
+        m_operations.push_back({std::move(ret), false, fd, buf, nbytes, offset});
     }
 
     void IOUringFallback::prep_write(std::shared_ptr<int> ret, int fd, const void *buf,
                                      unsigned nbytes, off_t offset)
     {
-        m_operations.emplace_back(ret, std::bind(pwrite, fd, buf, nbytes, offset));
+        m_operations.push_back({std::move(ret), true, fd, const_cast<void *>(buf), nbytes, offset});
     }
 
     std::unique_ptr<IOUring> IOUringFallback::make_unique(unsigned entries)
@@ -8,7 +8,6 @@
 
 #include "IOUring.hpp"
 
-#include <functional>
 #include <vector>
 
 namespace geopm
@@ -35,10 +34,18 @@ namespace geopm
             /// @param entries The expected maximum number of batched operations.
             static std::unique_ptr<IOUring> make_unique(unsigned entries);
         private:
-            // Pairs of pointers where operation results are desired, and functions
-            // that perform the operation and forward its return value.
-            using FutureOperation = std::pair<std::shared_ptr<int>, std::function<int()> >;
-            std::vector<FutureOperation> m_operations;
+            // Queued pread() or pwrite() arguments, and the pointer
+            // where the operation result is desired.  Stored by value
+            // so that queuing an operation does not allocate memory.
+            struct m_operation_s {
+                std::shared_ptr<int> ret;
+                bool is_write;
+                int fd;
+                void *buf;
+                unsigned nbytes;
+                off_t offset;
+            };
+            std::vector<m_operation_s> m_operations;
     };
 }
 #endif // IOURINGFALLBACK_HPP_INCLUDE
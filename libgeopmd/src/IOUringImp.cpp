@@ -56,26 +56,48 @@ namespace geopm
 
     void IOUringImp::submit()
     {
-        int submitted_operations = 0;
-        while (io_uring_sq_ready(&m_ring) > 0) {
-            submitted_operations += io_uring_submit(&m_ring);
+        unsigned num_prepared = io_uring_sq_ready(&m_ring);
+        unsigned num_submitted = 0;
+        while (num_submitted < num_prepared) {
+            // Submit every prepared operation and wait for all of their
+            // completions with one system call.  The kernel does not
+            // wait if only part of the queue was submitted, in which
+            // case the rest is submitted on the next iteration.
+            int ret = io_uring_submit_and_wait(&m_ring, num_prepared);
+            if (ret < 0) {
+                throw Exception("Failed to submit a batch of operations to IO uring",
+                                -ret, __FILE__, __LINE__);
+            }
+            if (ret == 0) {
+                throw Exception("IO uring did not accept any of the prepared operations",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            num_submitted += ret;
         }
-        struct io_uring_cqe *cqe;
 
-        for (int operation = 0; operation < submitted_operations; ++operation) {
+        struct io_uring_cqe *cqe = nullptr;
+        unsigned num_complete = 0;
+        while (num_complete < num_submitted) {
             int ret = io_uring_wait_cqe(&m_ring, &cqe);
             if (ret < 0) {
                 throw Exception("Failed to get a completion event from IO uring",
                                 -ret, __FILE__, __LINE__);
             }
-
-            int *result_destination = static_cast<int *>(io_uring_cqe_get_data(cqe));
-            if (result_destination) {
-                // The caller of prep_...() for this operation wants to
-                // know the return value of the operation, so write it back.
-                *result_destination = cqe->res;
+            // Consume all completion events that are already available
+            // without another system call.
+            unsigned head;
+            unsigned num_seen = 0;
+            io_uring_for_each_cqe(&m_ring, head, cqe) {
+                int *result_destination = static_cast<int *>(io_uring_cqe_get_data(cqe));
+                if (result_destination) {
+                    // The caller of prep_...() for this operation wants to
+                    // know the return value of the operation, so write it back.
+                    *result_destination = cqe->res;
+                }
+                ++num_seen;
             }
-            io_uring_cqe_seen(&m_ring, cqe);
+            io_uring_cq_advance(&m_ring, num_seen);
+            num_complete += num_seen;
         }
 
         // We're done writing batch operation results, so we don't need to
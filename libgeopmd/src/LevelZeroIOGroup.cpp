@@ -1578,6 +1578,17 @@ namespace geopm
         return m_signal_available.at(signal_name).behavior;
     }
 
+    bool LevelZeroIOGroup::is_signal_derived(const std::string &signal_name) const
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("LevelZeroIOGroup::" + std::string(__func__) +
+                            ": signal_name " + signal_name +
+                            " not valid for LevelZeroIOGroup.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_derivative_signal_map.find(signal_name) != m_derivative_signal_map.end();
+    }
+
     // Function used by the factory to create objects of this type
     std::unique_ptr<IOGroup> LevelZeroIOGroup::make_plugin(void)
     {
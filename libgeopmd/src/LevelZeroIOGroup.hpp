@@ -59,6 +59,7 @@ namespace geopm
             std::string control_description(const std::string
                                             &control_name) const override;
             int signal_behavior(const std::string &signal_name) const override;
+            bool is_signal_derived(const std::string &signal_name) const override;
             void save_control(const std::string &save_path) override;
             void restore_control(const std::string &save_path) override;
             std::string name(void) const override;
@@ -48,6 +48,8 @@ namespace geopm
         , m_path(std::move(path))
         , m_batch_reader(std::move(batch_reader))
         , m_batch_writer(std::move(batch_writer))
+        , m_num_write_issued(0)
+        , m_num_write_skipped(0)
     {
         create_batch_context();
         open_all();
@@ -301,29 +303,19 @@ namespace geopm
         if (ctx.m_write_batch.numops == 0) {
             return;
         }
-        GEOPM_DEBUG_ASSERT(ctx.m_write_batch.numops == ctx.m_write_batch_op.size() &&
-                           ctx.m_write_batch.ops == ctx.m_write_batch_op.data(),
+        GEOPM_DEBUG_ASSERT(ctx.m_write_batch.numops == ctx.m_write_issue_op.size() &&
+                           ctx.m_write_batch.ops == ctx.m_write_issue_op.data(),
                            "MSRIOImp::msr_ioctl_write(): Batch operations not updated prior to calling");
-        if (ctx.m_write_val.size() != ctx.m_write_batch.numops ||
-            ctx.m_write_mask.size() != ctx.m_write_batch.numops ||
-            ctx.m_write_batch_op.size() != ctx.m_write_batch.numops) {
+        if (ctx.m_write_val.size() != ctx.m_write_batch_op.size() ||
+            ctx.m_write_mask.size() != ctx.m_write_batch_op.size() ||
+            ctx.m_write_issue_idx.size() != ctx.m_write_batch.numops) {
             throw Exception("MSRIOImp::msr_ioctl_write(): Invalid operations stored in object, incorrectly sized",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         msr_ioctl(ctx.m_write_batch);
-        // Modify with write mask
-        int op_idx = 0;
-        for (auto &op_it : ctx.m_write_batch_op) {
-            op_it.isrdmsr = 0;
-            op_it.msrdata &= ~ctx.m_write_mask[op_idx];
-            op_it.msrdata |= ctx.m_write_val[op_idx];
-            GEOPM_DEBUG_ASSERT((~op_it.wmask & ctx.m_write_mask[op_idx]) == 0ULL,
-                               "MSRIOImp::msr_ioctl_write(): Write mask violation at write time");
-            ++op_idx;
-        }
-        msr_ioctl(ctx.m_write_batch);
-        for (auto &op_it : ctx.m_write_batch_op) {
-            op_it.isrdmsr = 1;
+        write_batch_modify(ctx);
+        if (ctx.m_write_batch.numops != 0) {
+            msr_ioctl(ctx.m_write_batch);
         }
     }
 
@@ -338,28 +330,55 @@ namespace geopm
                            "Batch operations not updated prior to calling "
                            "MSRIOImp::msr_read_files()");
 
-        if (!m_batch_reader) {
-            m_batch_reader = IOUring::make_unique(read_batch.numops);
+        auto &ctx = m_batch_context.at(batch_ctx);
+        IOUring &batcher = batch_io(ctx.m_read_io, ctx.m_read_io_ret,
+                                    m_batch_reader, read_batch.numops);
+        msr_batch_io(batcher, read_batch, ctx.m_read_io_ret);
+    }
+
+    IOUring &MSRIOImp::batch_io(std::shared_ptr<IOUring> &batcher,
+                                std::vector<std::shared_ptr<int> > &return_values,
+                                const std::shared_ptr<IOUring> &override_batcher,
+                                uint32_t numops)
+    {
+        if (return_values.size() != numops) {
+            // Operations were added to the context since the queue
+            // was created: size a new queue to hold all of them.  The
+            // return values share one allocation that is reused by
+            // every batch.
+            auto storage = std::make_shared<std::vector<int> >(numops, 0);
+            return_values.clear();
+            return_values.reserve(numops);
+            for (auto &value : *storage) {
+                return_values.emplace_back(storage, &value);
+            }
+            batcher.reset();
+        }
+        if (override_batcher) {
+            return *override_batcher;
+        }
+        if (!batcher) {
+            batcher = IOUring::make_unique(numops);
         }
-        msr_batch_io(*m_batch_reader, read_batch);
+        return *batcher;
     }
 
     void MSRIOImp::msr_batch_io(IOUring &batcher,
-                                struct m_msr_batch_array_s &batch)
+                                struct m_msr_batch_array_s &batch,
+                                const std::vector<std::shared_ptr<int> > &return_values)
     {
-        std::vector<std::shared_ptr<int> > return_values;
-        return_values.reserve(batch.numops);
-
+        GEOPM_DEBUG_ASSERT(return_values.size() >= batch.numops,
+                           "MSRIOImp::msr_batch_io(): return values not sized for the batch");
         for (uint32_t batch_idx = 0; batch_idx != batch.numops; ++batch_idx) {
-            return_values.emplace_back(new int(0));
+            *return_values[batch_idx] = 0;
             auto& batch_op = batch.ops[batch_idx];
             if (batch_op.isrdmsr) {
-                batcher.prep_read(return_values.back(), msr_desc(batch_op.cpu),
+                batcher.prep_read(return_values[batch_idx], msr_desc(batch_op.cpu),
                                   &batch_op.msrdata, sizeof(batch_op.msrdata),
                                   batch_op.msr);
             }
             else {
-                batcher.prep_write(return_values.back(), msr_desc(batch_op.cpu),
+                batcher.prep_write(return_values[batch_idx], msr_desc(batch_op.cpu),
                                    &batch_op.msrdata, sizeof(batch_op.msrdata),
                                    batch_op.msr);
             }
@@ -385,44 +404,80 @@ namespace geopm
 
     void MSRIOImp::msr_rmw_files(int batch_ctx)
     {
-        auto &write_batch = m_batch_context.at(batch_ctx).m_write_batch;
-        auto &write_batch_op = m_batch_context.at(batch_ctx).m_write_batch_op;
-        auto &write_mask = m_batch_context.at(batch_ctx).m_write_mask;
-        auto &write_val = m_batch_context.at(batch_ctx).m_write_val;
+        auto &ctx = m_batch_context.at(batch_ctx);
+        auto &write_batch = ctx.m_write_batch;
         if (write_batch.numops == 0) {
             return;
         }
-        GEOPM_DEBUG_ASSERT(write_batch.numops == write_batch_op.size() &&
-                           write_batch.ops == write_batch_op.data(),
+        GEOPM_DEBUG_ASSERT(write_batch.numops == ctx.m_write_issue_op.size() &&
+                           write_batch.ops == ctx.m_write_issue_op.data(),
                            "Batch operations not updated prior to calling "
                            "MSRIOImp::msr_rmw_files()");
 
-        if (!m_batch_writer) {
-            m_batch_writer = IOUring::make_unique(write_batch.numops);
-        }
+        // Size the queue for every operation in the context so that
+        // it is not recreated when the number issued changes.
+        IOUring &batcher = batch_io(ctx.m_write_io, ctx.m_write_io_ret,
+                                    m_batch_writer, ctx.m_write_batch_op.size());
 
         // Read existing MSR values
-        msr_batch_io(*m_batch_writer, write_batch);
+        msr_batch_io(batcher, write_batch, ctx.m_write_io_ret);
 
-        // Modify with write mask
-        int op_idx = 0;
-        for (auto &op_it : write_batch_op) {
-            op_it.isrdmsr = 0;
-            op_it.msrdata &= ~write_mask[op_idx];
-            op_it.msrdata |= write_val[op_idx];
-            GEOPM_DEBUG_ASSERT((~op_it.wmask & write_mask[op_idx]) == 0ULL,
-                               "MSRIOImp::msr_rmw_files(): Write mask "
-                               "violation at write time");
-            ++op_idx;
-        }
+        write_batch_modify(ctx);
 
         // Write back the modified MSRs
-        msr_batch_io(*m_batch_writer, write_batch);
-        for (auto &op_it : write_batch_op) {
-            op_it.isrdmsr = 1;
+        if (write_batch.numops != 0) {
+            msr_batch_io(batcher, write_batch, ctx.m_write_io_ret);
         }
     }
 
+    void MSRIOImp::write_batch_select(struct m_batch_context_s &ctx)
+    {
+        ctx.m_write_issue_op.clear();
+        ctx.m_write_issue_idx.clear();
+        for (size_t op_idx = 0; op_idx != ctx.m_write_batch_op.size(); ++op_idx) {
+            uint64_t mask = ctx.m_write_mask[op_idx];
+            // Controls that target the same MSR share one operation
+            // so each MSR is written at most once.  An operation is
+            // not read or written if none of its fields were adjusted.
+            if (mask == 0ULL) {
+                continue;
+            }
+            ctx.m_write_issue_op.push_back(ctx.m_write_batch_op[op_idx]);
+            ctx.m_write_issue_op.back().isrdmsr = 1;
+            ctx.m_write_issue_idx.push_back(op_idx);
+        }
+        ctx.m_write_batch.numops = ctx.m_write_issue_op.size();
+        ctx.m_write_batch.ops = ctx.m_write_issue_op.data();
+    }
+
+    void MSRIOImp::write_batch_modify(struct m_batch_context_s &ctx)
+    {
+        // Operations whose adjusted fields already hold the requested
+        // value in the MSR just read are dropped from the write.
+        size_t num_write = 0;
+        for (size_t issue_idx = 0; issue_idx != ctx.m_write_issue_op.size(); ++issue_idx) {
+            auto &op_it = ctx.m_write_issue_op[issue_idx];
+            int op_idx = ctx.m_write_issue_idx[issue_idx];
+            GEOPM_DEBUG_ASSERT((~op_it.wmask & ctx.m_write_mask[op_idx]) == 0ULL,
+                               "MSRIOImp::write_batch_modify(): Write mask "
+                               "violation at write time");
+            if ((op_it.msrdata & ctx.m_write_mask[op_idx]) == ctx.m_write_val[op_idx]) {
+                continue;
+            }
+            op_it.isrdmsr = 0;
+            op_it.msrdata &= ~ctx.m_write_mask[op_idx];
+            op_it.msrdata |= ctx.m_write_val[op_idx];
+            ctx.m_write_issue_op[num_write] = op_it;
+            ctx.m_write_issue_idx[num_write] = op_idx;
+            ++num_write;
+        }
+        m_num_write_skipped += ctx.m_write_issue_op.size() - num_write;
+        m_num_write_issued += num_write;
+        ctx.m_write_issue_op.resize(num_write);
+        ctx.m_write_issue_idx.resize(num_write);
+        ctx.m_write_batch.numops = num_write;
+    }
+
     void MSRIOImp::read_batch(void)
     {
         read_batch(0);
@@ -453,8 +508,7 @@ namespace geopm
     void MSRIOImp::write_batch(int batch_ctx)
     {
         m_batch_context_s &ctx = m_batch_context.at(batch_ctx);
-        ctx.m_write_batch.numops = ctx.m_write_batch_op.size();
-        ctx.m_write_batch.ops = ctx.m_write_batch_op.data();
+        write_batch_select(ctx);
 
         // Use the batch-oriented MSR-safe ioctl twice (batch-read, modify,
         // batch-write) if possible. Otherwise, operate over individual
@@ -470,6 +524,16 @@ namespace geopm
         ctx.m_is_batch_read = true;
     }
 
+    uint64_t MSRIOImp::num_write_issued(void) const
+    {
+        return m_num_write_issued;
+    }
+
+    uint64_t MSRIOImp::num_write_skipped(void) const
+    {
+        return m_num_write_skipped;
+    }
+
     int MSRIOImp::msr_desc(int cpu_idx)
     {
         if (cpu_idx < 0 || cpu_idx > m_num_cpu) {
@@ -131,6 +131,13 @@ namespace geopm
             /// @brief Write all adjusted values.
             /// @param [in] batch_ctx index for batch context to use for the write.
             virtual void write_batch(int batch_ctx) = 0;
+            /// @brief Number of MSR writes issued by write_batch()
+            ///        over all contexts.
+            virtual uint64_t num_write_issued(void) const = 0;
+            /// @brief Number of adjusted MSR writes that
+            ///        write_batch() did not issue because the value
+            ///        read already held the requested fields.
+            virtual uint64_t num_write_skipped(void) const = 0;
             /// @brief Returns a unique_ptr to a concrete object
             ///        constructed using the underlying implementation
             static std::unique_ptr<MSRIO> make_unique(int driver_type);
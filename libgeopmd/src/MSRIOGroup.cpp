@@ -31,6 +31,7 @@
 #include "DerivativeSignal.hpp"
 #include "RatioSignal.hpp"
 #include "MultiplicationSignal.hpp"
+#include "MSRWriteCountSignal.hpp"
 #include "Control.hpp"
 #include "MSRFieldControl.hpp"
 #include "DomainControl.hpp"
@@ -281,6 +282,7 @@ namespace geopm
         register_power_signals();
         register_pcnt_scalability_signals();
         register_rdt_signals();
+        register_write_count_signals();
 
         register_control_alias("CPU_POWER_LIMIT_CONTROL", "MSR::PKG_POWER_LIMIT:PL1_POWER_LIMIT");
         register_control_alias("CPU_POWER_TIME_WINDOW_CONTROL", "MSR::PKG_POWER_LIMIT:PL1_TIME_WINDOW");
@@ -417,6 +419,7 @@ namespace geopm
                     auto sub = readings[domain_idx];
                     result[domain_idx] = std::make_shared<DifferenceSignal>(max, sub);
                 }
+                m_derived_signal.insert(signal_name);
                 m_signal_available[signal_name] = {std::move(result),
                                                    read_domain,
                                                    IOGroup::M_UNITS_CELSIUS,
@@ -435,6 +438,7 @@ namespace geopm
         // register time signal; domain board
         std::string time_name = "MSR::TIME";
         std::shared_ptr<Signal> time_sig = std::make_shared<TimeSignal>(m_time_zero, m_time_batch);
+        m_derived_signal.insert(time_name);
         m_signal_available[time_name] = {std::vector<std::shared_ptr<Signal> >({time_sig}),
                                          GEOPM_DOMAIN_BOARD,
                                          IOGroup::M_UNITS_SECONDS,
@@ -482,6 +486,7 @@ namespace geopm
                                                            m_derivative_window,
                                                            m_sleep_time);
                 }
+                m_derived_signal.insert(signal_name);
                 m_signal_available[signal_name] = {std::move(result),
                                                    energy_domain,
                                                    IOGroup::M_UNITS_WATTS,
@@ -603,6 +608,7 @@ namespace geopm
                 }
             }
 
+            m_derived_signal.insert(signal_name);
             m_signal_available[signal_name] = {std::move(result),
                                                cnt_domain,
                                                IOGroup::M_UNITS_NONE,
@@ -646,6 +652,7 @@ namespace geopm
                 result[domain_idx] =
                     std::make_shared<MultiplicationSignal>(ctr, (double)m_rdt_info.mbm_scalar);
             }
+            m_derived_signal.insert(signal_name);
             m_signal_available[signal_name] = {std::move(result),
                                                ctr_domain,
                                                IOGroup::M_UNITS_NONE,
@@ -684,6 +691,7 @@ namespace geopm
                                                        m_derivative_window,
                                                        m_sleep_time);
             }
+            m_derived_signal.insert(signal_name);
             m_signal_available[signal_name] = {std::move(result),
                                                ctr_domain,
                                                IOGroup::M_UNITS_NONE,
@@ -694,6 +702,34 @@ namespace geopm
         }
     }
 
+    void MSRIOGroup::register_write_count_signals(void)
+    {
+        struct count_data {
+            std::string name;
+            std::string description;
+            int count_type;
+        };
+        std::vector<count_data> count_signals {
+            {"MSR::WRITE_ISSUED_COUNT",
+                    "Number of MSR writes issued by batch writes",
+                    MSRWriteCountSignal::M_COUNT_ISSUED},
+            {"MSR::WRITE_SKIPPED_COUNT",
+                    "Number of adjusted MSR writes skipped by batch writes "
+                    "because the MSR already held the requested value",
+                    MSRWriteCountSignal::M_COUNT_SKIPPED},
+        };
+        for (const auto &cs : count_signals) {
+            std::shared_ptr<Signal> count_sig =
+                std::make_shared<MSRWriteCountSignal>(m_msrio, cs.count_type);
+            m_signal_available[cs.name] = {std::vector<std::shared_ptr<Signal> >({count_sig}),
+                                           GEOPM_DOMAIN_BOARD,
+                                           IOGroup::M_UNITS_NONE,
+                                           Agg::sum,
+                                           cs.description,
+                                           IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+                                           string_format_integer};
+        }
+    }
 
     std::set<std::string> MSRIOGroup::signal_names(void) const
     {
@@ -1003,6 +1039,9 @@ namespace geopm
             // skip adding an alias if underlying signal is not found
             return;
         }
+        if (m_derived_signal.count(msr_name_field) != 0) {
+            m_derived_signal.insert(signal_name);
+        }
         // copy signal info but append to description
         m_signal_available[signal_name] = it->second;
         m_signal_available[signal_name].description =
@@ -1165,6 +1204,16 @@ namespace geopm
         return result;
     }
 
+    bool MSRIOGroup::is_signal_derived(const std::string &signal_name) const
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("MSRIOGroup::is_signal_derived(): signal_name " + signal_name +
+                            " not valid for MSRIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_derived_signal.count(signal_name) != 0;
+    }
+
     void MSRIOGroup::save_control(const std::string &save_path)
     {
         std::shared_ptr<SaveControl> save_ctl = m_mock_save_ctl;
@@ -1503,11 +1552,11 @@ namespace geopm
         }
 #endif
         std::vector<std::shared_ptr<Signal> > result;
+        const PlatformTopo::nested_table_s &cpu_table =
+            m_platform_topo.domain_nested_table(GEOPM_DOMAIN_CPU, domain_type);
         for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
             // get index of a single representative CPU for this domain
-            std::set<int> cpus = m_platform_topo.domain_nested(GEOPM_DOMAIN_CPU,
-                                                               domain_type, domain_idx);
-            int cpu_idx = *(cpus.begin());
+            int cpu_idx = cpu_table.inner_idx[cpu_table.offset[domain_idx]];
             std::shared_ptr<Signal> raw_msr =
                 std::make_shared<RawMSRSignal>(m_msrio, cpu_idx, msr_offset);
             result.push_back(std::move(raw_msr));
@@ -1564,11 +1613,13 @@ namespace geopm
         int num_domain = m_platform_topo.num_domain(domain_type);
         std::vector<std::shared_ptr<Control> > result_field_control;
         try {
+            const PlatformTopo::nested_table_s &cpu_table =
+                m_platform_topo.domain_nested_table(GEOPM_DOMAIN_CPU, domain_type);
             for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
                 std::vector<std::shared_ptr<Control> > cpu_controls;
-                std::set<int> cpus = m_platform_topo.domain_nested(GEOPM_DOMAIN_CPU,
-                                                                   domain_type, domain_idx);
-                for (auto cpu_idx : cpus) {
+                for (int cpu_pos = cpu_table.offset[domain_idx];
+                     cpu_pos != cpu_table.offset[domain_idx + 1]; ++cpu_pos) {
+                    int cpu_idx = cpu_table.inner_idx[cpu_pos];
                     cpu_controls.push_back(std::make_shared<MSRFieldControl>(
                         m_msrio, cpu_idx, msr_offset, begin_bit, end_bit, function,
                         scalar));
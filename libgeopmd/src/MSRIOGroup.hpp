@@ -83,6 +83,7 @@ namespace geopm
             std::string signal_description(const std::string &signal_name) const override;
             std::string control_description(const std::string &control_name) const override;
             int signal_behavior(const std::string &signal_name) const override;
+            bool is_signal_derived(const std::string &signal_name) const override;
             void save_control(const std::string &save_path) override;
             void restore_control(const std::string &save_path) override;
             std::string name(void) const override;
@@ -164,6 +165,9 @@ namespace geopm
             /// @brief Add support for frequency control aliases if underlying
             ///        controls are available.
             void register_frequency_controls(void);
+            /// @brief Add support for the counts of MSR writes issued
+            ///        and skipped by write_batch().
+            void register_write_count_signals(void);
             /// @brief Check system configuration and warn if it ma
             ///        interfere with the given control.
             void check_control(const std::string &control_name);
@@ -240,6 +244,9 @@ namespace geopm
                 std::function<std::string(double)> format_function;
             };
             std::map<std::string, signal_info> m_signal_available;
+            // Signals computed from other signals, e.g. the rate of
+            // change of an energy counter.
+            std::set<std::string> m_derived_signal;
 
             struct control_info
             {
@@ -6,8 +6,10 @@
 #ifndef MSRIOIMP_HPP_INCLUDE
 #define MSRIOIMP_HPP_INCLUDE
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "IOUring.hpp"
 #include "MSRIO.hpp"
@@ -42,6 +44,8 @@ namespace geopm
             uint64_t sample(int batch_idx, int batch_ctx) const override;
             void write_batch() override;
             void write_batch(int batch_ctx) override;
+            uint64_t num_write_issued(void) const override;
+            uint64_t num_write_skipped(void) const override;
             int add_write(int cpu_idx, uint64_t offset) override;
             int add_write(int cpu_idx, uint64_t offset, int batch_ctx) override;
             void adjust(int batch_idx, uint64_t value, uint64_t write_mask) override;
@@ -82,6 +86,19 @@ namespace geopm
                 std::vector<std::map<uint64_t, int> > m_write_batch_idx_map;
                 std::vector<uint64_t> m_write_val;
                 std::vector<uint64_t> m_write_mask;
+                /// Operations issued by the current write_batch(),
+                /// a subset of m_write_batch_op, and the index of
+                /// each in m_write_batch_op
+                std::vector<struct m_msr_batch_op_s> m_write_issue_op;
+                std::vector<int> m_write_issue_idx;
+                /// Queues used when the msr-safe batch ioctl is not
+                /// available, sized for the operations in this context
+                std::shared_ptr<IOUring> m_read_io;
+                std::shared_ptr<IOUring> m_write_io;
+                /// Return value of each queued operation, allocated
+                /// once when the queue is created
+                std::vector<std::shared_ptr<int> > m_read_io_ret;
+                std::vector<std::shared_ptr<int> > m_write_io_ret;
             };
 
             void open_all(void);
@@ -95,9 +112,22 @@ namespace geopm
             void msr_ioctl(struct m_msr_batch_array_s &batch);
             void msr_ioctl_read(struct m_batch_context_s &ctx);
             void msr_ioctl_write(struct m_batch_context_s &ctx);
-            void msr_batch_io(IOUring &batcher, struct m_msr_batch_array_s &batch);
+            IOUring &batch_io(std::shared_ptr<IOUring> &batcher,
+                              std::vector<std::shared_ptr<int> > &return_values,
+                              const std::shared_ptr<IOUring> &override_batcher,
+                              uint32_t numops);
+            void msr_batch_io(IOUring &batcher,
+                              struct m_msr_batch_array_s &batch,
+                              const std::vector<std::shared_ptr<int> > &return_values);
             void msr_read_files(int batch_ctx);
             void msr_rmw_files(int batch_ctx);
+            /// @brief Select the operations with adjusted fields to
+            ///        be read.
+            void write_batch_select(struct m_batch_context_s &ctx);
+            /// @brief Apply the adjusted values to the MSR values
+            ///        read, keeping only the operations that change
+            ///        the value of the MSR.
+            void write_batch_modify(struct m_batch_context_s &ctx);
 
             const int m_num_cpu;
             std::vector<int> m_file_desc;
@@ -108,6 +138,8 @@ namespace geopm
             std::shared_ptr<MSRPath> m_path;
             std::shared_ptr<IOUring> m_batch_reader;
             std::shared_ptr<IOUring> m_batch_writer;
+            uint64_t m_num_write_issued;
+            uint64_t m_num_write_skipped;
     };
 }
 
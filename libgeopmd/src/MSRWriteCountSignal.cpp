@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+
+#include "MSRWriteCountSignal.hpp"
+
+#include "geopm_debug.hpp"
+#include "MSRIO.hpp"
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    MSRWriteCountSignal::MSRWriteCountSignal(std::shared_ptr<MSRIO> msrio,
+                                             int count_type)
+        : m_msrio(std::move(msrio))
+        , m_count_type(count_type)
+        , m_is_batch_ready(false)
+    {
+        GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "no valid MSRIO object.");
+        if (m_count_type != M_COUNT_ISSUED &&
+            m_count_type != M_COUNT_SKIPPED) {
+            throw Exception("MSRWriteCountSignal: invalid count type: " +
+                            std::to_string(m_count_type),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    void MSRWriteCountSignal::setup_batch(void)
+    {
+        if (!m_is_batch_ready) {
+            m_is_batch_ready = true;
+        }
+    }
+
+    double MSRWriteCountSignal::sample(void)
+    {
+        if (!m_is_batch_ready) {
+            throw Exception("setup_batch() must be called before sample().",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return read();
+    }
+
+    double MSRWriteCountSignal::read(void) const
+    {
+        uint64_t result = m_count_type == M_COUNT_ISSUED ?
+                          m_msrio->num_write_issued() :
+                          m_msrio->num_write_skipped();
+        return result;
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MSRWRITECOUNTSIGNAL_HPP_INCLUDE
+#define MSRWRITECOUNTSIGNAL_HPP_INCLUDE
+
+#include <memory>
+
+#include "Signal.hpp"
+
+namespace geopm
+{
+    class MSRIO;
+
+    /// A signal used by the MSRIOGroup to report the number of MSR
+    /// writes issued or skipped by the MSRIO.
+    class MSRWriteCountSignal : public Signal
+    {
+        public:
+            enum m_count_e {
+                M_COUNT_ISSUED,
+                M_COUNT_SKIPPED,
+            };
+            MSRWriteCountSignal(std::shared_ptr<MSRIO> msrio,
+                                int count_type);
+            MSRWriteCountSignal(const MSRWriteCountSignal &other) = delete;
+            MSRWriteCountSignal &operator=(const MSRWriteCountSignal &other) = delete;
+            virtual ~MSRWriteCountSignal() = default;
+            void setup_batch(void) override;
+            double sample(void) override;
+            double read(void) const override;
+        private:
+            std::shared_ptr<MSRIO> m_msrio;
+            int m_count_type;
+            bool m_is_batch_ready;
+    };
+}
+
+#endif
@@ -8,6 +8,7 @@
 
 #include <string.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include <algorithm>
 #include <cmath>
 #include <iostream>
@@ -21,7 +22,9 @@
 #include "geopm/PlatformTopo.hpp"
 
 #include "geopm_pio.h"
+#include "geopm_time.h"
 #include "BatchServer.hpp"
+#include "BatchThreadPool.hpp"
 #include "CombinedControl.hpp"
 #include "CombinedSignal.hpp"
 #include "ServiceIOGroup.hpp"
@@ -58,11 +61,22 @@ namespace geopm
 
     PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                                  const PlatformTopo &topo)
+        : PlatformIOImp(std::move(iogroup_list), topo, num_batch_thread_env())
+    {
+
+    }
+
+    PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                                 const PlatformTopo &topo,
+                                 int num_batch_thread)
         : m_is_signal_active(false)
         , m_is_control_active(false)
         , m_platform_topo(topo)
         , m_iogroup_list(std::move(iogroup_list))
+        , m_read_batch_count(0)
         , m_do_restore(false)
+        , m_num_batch_thread(num_batch_thread)
+        , m_batch_pool_pid(-1)
     {
         if (m_iogroup_list.empty()) {
             for (const auto &it : IOGroup::iogroup_names()) {
@@ -83,6 +97,35 @@ namespace geopm
         }
     }
 
+    PlatformIOImp::~PlatformIOImp()
+    {
+        if (m_batch_pool && m_batch_pool_pid != getpid()) {
+            // The worker threads do not exist in a forked child
+            // process and cannot be joined.
+            (void)m_batch_pool.release();
+        }
+    }
+
+    int PlatformIOImp::num_batch_thread_env(void)
+    {
+        int result = 0;
+        std::string env_str = geopm::get_env("GEOPM_PIO_BATCH_THREADS");
+        if (!env_str.empty()) {
+            try {
+                result = std::stoi(env_str);
+            }
+            catch (const std::exception &ex) {
+                result = -1;
+            }
+            if (result < 0) {
+                std::cerr << "Warning: <geopm> Invalid value for GEOPM_PIO_BATCH_THREADS: \""
+                          << env_str << "\", IOGroups will be updated serially." << std::endl;
+                result = 0;
+            }
+        }
+        return result;
+    }
+
     void PlatformIOImp::register_iogroup(std::shared_ptr<IOGroup> iogroup)
     {
         if (m_do_restore) {
@@ -328,8 +371,8 @@ namespace geopm
     {
         int result = m_active_signal.size();
         std::unique_ptr<CombinedSignal> combiner = geopm::make_unique<CombinedSignal>(agg_function(signal_name));
-        register_combined_signal(result, sub_signal_idx, std::move(combiner));
-        m_active_signal.emplace_back(nullptr, result);
+        int combined_idx = register_combined_signal(sub_signal_idx, std::move(combiner));
+        m_active_signal.emplace_back(nullptr, combined_idx);
         return result;
     }
 
@@ -350,12 +393,17 @@ namespace geopm
         return result;
     }
 
-    void PlatformIOImp::register_combined_signal(int signal_idx,
-                                                 std::vector<int> operands,
-                                                 std::unique_ptr<CombinedSignal> signal)
+    int PlatformIOImp::register_combined_signal(const std::vector<int> &operands,
+                                                std::unique_ptr<CombinedSignal> signal)
     {
-        auto tmp = std::make_pair(operands, std::move(signal));
-        m_combined_signal[signal_idx] = std::move(tmp);
+        int result = m_combined_signal.size();
+        m_combined_signal.push_back({(int)m_combined_operand.size(),
+                                     std::move(signal),
+                                     std::vector<double>(operands.size(), NAN),
+                                     NAN,
+                                     0});
+        m_combined_operand.insert(m_combined_operand.end(), operands.begin(), operands.end());
+        return result;
     }
 
     void PlatformIOImp::register_combined_control(int control_idx,
@@ -478,6 +526,11 @@ namespace geopm
         return m_active_control.size();
     }
 
+    int PlatformIOImp::num_batch_thread(void) const
+    {
+        return m_batch_pool ? m_batch_pool->num_thread() : 0;
+    }
+
     double PlatformIOImp::sample(int signal_idx)
     {
         double result = NAN;
@@ -499,18 +552,18 @@ namespace geopm
         return result;
     }
 
-    double PlatformIOImp::sample_combined(int signal_idx)
+    double PlatformIOImp::sample_combined(int combined_idx)
     {
-        double result = NAN;
-        auto &op_obj_pair = m_combined_signal.at(signal_idx);
-        std::vector<int> &operand_idx = op_obj_pair.first;
-        auto &signal = op_obj_pair.second;
-        std::vector<double> operands(operand_idx.size());
-        for (size_t ii = 0; ii < operands.size(); ++ii) {
-            operands[ii] = sample(operand_idx[ii]);
+        auto &combined = m_combined_signal[combined_idx];
+        if (combined.read_batch_count != m_read_batch_count) {
+            const int *operand_idx = m_combined_operand.data() + combined.operand_begin;
+            for (size_t ii = 0; ii < combined.operand_value.size(); ++ii) {
+                combined.operand_value[ii] = sample(operand_idx[ii]);
+            }
+            combined.value = combined.signal->sample(combined.operand_value);
+            combined.read_batch_count = m_read_batch_count;
         }
-        result = signal->sample(operands);
-        return result;
+        return combined.value;
     }
 
     void PlatformIOImp::adjust(int control_idx,
@@ -547,19 +600,75 @@ namespace geopm
 
     void PlatformIOImp::read_batch(void)
     {
-        for (auto &it : m_iogroup_list) {
-            it->read_batch();
-        }
+        ++m_read_batch_count;
+        batch_iogroup(true, m_read_batch_duration);
         m_is_signal_active = true;
     }
 
     void PlatformIOImp::write_batch(void)
     {
-        for (auto &it : m_iogroup_list) {
-            it->write_batch();
+        batch_iogroup(false, m_write_batch_duration);
+    }
+
+    void PlatformIOImp::batch_iogroup(bool is_read, std::vector<double> &duration)
+    {
+        if (m_batch_iogroup.size() != m_iogroup_list.size()) {
+            m_batch_iogroup.assign(m_iogroup_list.begin(), m_iogroup_list.end());
+        }
+        duration.resize(m_batch_iogroup.size(), 0.0);
+        auto task = [this, is_read, &duration](int iogroup_idx)
+        {
+            geopm_time_s begin;
+            geopm_time(&begin);
+            if (is_read) {
+                m_batch_iogroup[iogroup_idx]->read_batch();
+            }
+            else {
+                m_batch_iogroup[iogroup_idx]->write_batch();
+            }
+            duration[iogroup_idx] = geopm_time_since(&begin);
+        };
+        if (m_num_batch_thread > 0 && m_batch_iogroup.size() > 1) {
+            // Create the pool on first use, again in a forked child
+            // process where the worker threads do not exist, and
+            // again when more IOGroups are registered.
+            int pid = getpid();
+            if (m_batch_pool_pid != pid) {
+                (void)m_batch_pool.release();
+            }
+            int num_thread = std::min<int>(m_num_batch_thread,
+                                           m_batch_iogroup.size() - 1);
+            if (!m_batch_pool || m_batch_pool->num_thread() != num_thread) {
+                m_batch_pool = BatchThreadPool::make_unique(num_thread);
+                m_batch_pool_pid = pid;
+            }
+            m_batch_pool->run(m_batch_iogroup.size(), task);
+        }
+        else {
+            for (size_t iogroup_idx = 0; iogroup_idx < m_batch_iogroup.size(); ++iogroup_idx) {
+                task(iogroup_idx);
+            }
         }
     }
 
+    std::map<std::string, double> PlatformIOImp::read_batch_duration(void) const
+    {
+        std::map<std::string, double> result;
+        for (size_t iogroup_idx = 0; iogroup_idx < m_read_batch_duration.size(); ++iogroup_idx) {
+            result[m_batch_iogroup[iogroup_idx]->name()] += m_read_batch_duration[iogroup_idx];
+        }
+        return result;
+    }
+
+    std::map<std::string, double> PlatformIOImp::write_batch_duration(void) const
+    {
+        std::map<std::string, double> result;
+        for (size_t iogroup_idx = 0; iogroup_idx < m_write_batch_duration.size(); ++iogroup_idx) {
+            result[m_batch_iogroup[iogroup_idx]->name()] += m_write_batch_duration[iogroup_idx];
+        }
+        return result;
+    }
+
     double PlatformIOImp::read_signal(const std::string &signal_name,
                                       int domain_type,
                                       int domain_idx)
@@ -802,6 +911,16 @@ namespace geopm
         return iogroups.at(0)->signal_behavior(signal_name);
     }
 
+    bool PlatformIOImp::is_signal_derived(const std::string &signal_name) const
+    {
+        auto iogroups = find_signal_iogroup(signal_name);
+        if (iogroups.empty()) {
+            throw Exception("PlatformIOImp::is_signal_derived(): unknown signal \"" + signal_name + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return iogroups.at(0)->is_signal_derived(signal_name);
+    }
+
     void PlatformIOImp::start_batch_server(int client_pid,
                                            const std::vector<geopm_request_s> &signal_config,
                                            const std::vector<geopm_request_s> &control_config,
@@ -6,6 +6,7 @@
 #ifndef PLATFORMIOIMP_HPP_INCLUDE
 #define PLATFORMIOIMP_HPP_INCLUDE
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <set>
@@ -20,6 +21,7 @@ namespace geopm
     class CombinedControl;
     class PlatformTopo;
     class BatchServer;
+    class BatchThreadPool;
 
     class PlatformIOImp : public PlatformIO
     {
@@ -27,9 +29,17 @@ namespace geopm
             PlatformIOImp();
             PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                           const PlatformTopo &topo);
+            /// @param [in] num_batch_thread Number of worker threads
+            ///        used to call read_batch() and write_batch() on
+            ///        the registered IOGroups concurrently.  If zero,
+            ///        the IOGroups are updated serially by the
+            ///        calling thread.
+            PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                          const PlatformTopo &topo,
+                          int num_batch_thread);
             PlatformIOImp(const PlatformIOImp &other) = delete;
             PlatformIOImp &operator=(const PlatformIOImp &other) = delete;
-            virtual ~PlatformIOImp() = default;
+            virtual ~PlatformIOImp();
             void register_iogroup(std::shared_ptr<IOGroup> iogroup) override;
             std::set<std::string> signal_names(void) const override;
             std::set<std::string> control_names(void) const override;
@@ -59,6 +69,7 @@ namespace geopm
             std::string signal_description(const std::string &signal_name) const override;
             std::string control_description(const std::string &control_name) const override;
             int signal_behavior(const std::string &signal_name) const override;
+            bool is_signal_derived(const std::string &signal_name) const override;
             void save_control(const std::string &save_dir) override;
             void restore_control(const std::string &save_dir) override;
             void start_batch_server(int client_pid,
@@ -67,10 +78,21 @@ namespace geopm
                                     int &server_pid,
                                     std::string &server_key) override;
             void stop_batch_server(int server_pid) override;
+            std::map<std::string, double> read_batch_duration(void) const override;
+            std::map<std::string, double> write_batch_duration(void) const override;
 
             int num_signal_pushed(void) const;  // Used for testing only
             int num_control_pushed(void) const; // Used for testing only
+            int num_batch_thread(void) const;   // Used for testing only
         private:
+            /// @brief Parse the GEOPM_PIO_BATCH_THREADS environment
+            ///        variable.  Returns zero if unset or invalid.
+            static int num_batch_thread_env(void);
+            /// @brief Call read_batch() or write_batch() on every
+            ///        registered IOGroup, concurrently if a thread
+            ///        pool was requested, and record the time spent
+            ///        in each.
+            void batch_iogroup(bool is_read, std::vector<double> &duration);
             /// @brief Push a signal that aggregates values sampled
             ///        from other signals.  The aggregation function
             ///        used is determined by a call to agg_function()
@@ -96,14 +118,14 @@ namespace geopm
                                       int domain_idx,
                                       const std::vector<int> &sub_control_idx);
             /// @brief Save a high-level signal as a combination of other signals.
-            /// @param [in] signal_idx Index a caller can use to refer to this signal.
             /// @param [in] operands Input signal indices to be combined.  These must
             ///             be valid pushed signals registered with PlatformIO.
-            /// @param [in] func The function that will combine the signals into
+            /// @param [in] signal The object that will combine the signals into
             ///             a single result.
-            void register_combined_signal(int signal_idx,
-                                          std::vector<int> operands,
-                                          std::unique_ptr<CombinedSignal> signal);
+            /// @return Index of the combined signal passed to
+            ///         sample_combined().
+            int register_combined_signal(const std::vector<int> &operands,
+                                         std::unique_ptr<CombinedSignal> signal);
             void register_combined_control(int control_idx,
                                            std::vector<int> operands,
                                            std::unique_ptr<CombinedControl> control);
@@ -121,7 +143,9 @@ namespace geopm
                                               int domain_idx,
                                               double setting);
             /// @brief Sample a combined signal using the saved function and operands.
-            double sample_combined(int signal_idx);
+            ///        The value is computed on the first call after each
+            ///        read_batch() and reused until the next one.
+            double sample_combined(int combined_idx);
             void adjust_combined(int control_idx, double setting);
             /// @brief Look up the IOGroup that provides the given signal.
             std::vector<std::shared_ptr<IOGroup> > find_signal_iogroup(const std::string &signal_name) const;
@@ -140,13 +164,32 @@ namespace geopm
             std::vector<std::pair<std::shared_ptr<IOGroup>, int> > m_active_control;
             std::map<std::tuple<std::string, int, int>, int> m_existing_signal;
             std::map<std::tuple<std::string, int, int>, int> m_existing_control;
-            std::map<int, std::pair<std::vector<int>,
-                                    std::unique_ptr<CombinedSignal> > > m_combined_signal;
+            struct m_combined_signal_s {
+                /// Offset of the first operand in m_combined_operand
+                int operand_begin;
+                std::unique_ptr<CombinedSignal> signal;
+                /// Operand values, sized when the signal is pushed
+                std::vector<double> operand_value;
+                double value;
+                /// Value of m_read_batch_count when value was computed
+                uint64_t read_batch_count;
+            };
+            std::vector<m_combined_signal_s> m_combined_signal;
+            /// Pushed signal indices of the operands of all combined
+            /// signals, each stored contiguously.
+            std::vector<int> m_combined_operand;
+            uint64_t m_read_batch_count;
             std::map<int, std::pair<std::vector<int>,
                                     std::unique_ptr<CombinedControl> > > m_combined_control;
             bool m_do_restore;
             std::map<int, std::shared_ptr<BatchServer> > m_batch_server;
             std::set<std::string> m_pushed_signal_names;
+            const int m_num_batch_thread;
+            std::unique_ptr<BatchThreadPool> m_batch_pool;
+            int m_batch_pool_pid;
+            std::vector<std::shared_ptr<IOGroup> > m_batch_iogroup;
+            std::vector<double> m_read_batch_duration;
+            std::vector<double> m_write_batch_duration;
             static const std::map<const std::string, const std::string> m_signal_descriptions;
             static const std::map<const std::string, const std::string> m_control_descriptions;
     };
@@ -6,18 +6,23 @@
 
 #include "PlatformTopoImp.hpp"
 
+#include <fcntl.h>
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/sysinfo.h>
 #include <sys/time.h>
+#include <sys/utsname.h>
 #include <unistd.h>
 #include <string.h>
 #include <errno.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <climits>
 #include <map>
+#include <mutex>
+#include <numeric>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -31,6 +36,7 @@
 #include "GPUTopoNull.hpp"
 #include "geopm/ServiceProxy.hpp"
 #include "geopm/Cpuid.hpp"
+#include "UniqueFd.hpp"
 
 
 int geopm_read_cpuid(void)
@@ -77,6 +83,7 @@ namespace geopm
 {
     const std::string PlatformTopoImp::M_CACHE_FILE_NAME = "/tmp/geopm-topo-cache-" + std::to_string(getuid());
     const std::string PlatformTopoImp::M_SERVICE_CACHE_FILE_NAME = "/run/geopm/geopm-topo-cache";
+    const std::string PlatformTopoImp::M_SYSFS_PATH = "/sys/devices/system";
 
     const PlatformTopo &platform_topo(void)
     {
@@ -114,13 +121,28 @@ namespace geopm
                                      std::shared_ptr<ServiceProxy> service_proxy)
         : M_TEST_CACHE_FILE_NAME(test_cache_file_name)
         , m_service_proxy(std::move(service_proxy))
+        , m_num_cpu(0)
     {
-        std::map<std::string, std::string> lscpu_map;
-        lscpu(lscpu_map);
-        parse_lscpu(lscpu_map, m_num_package, m_core_per_package, m_thread_per_core);
-        m_numa_map = parse_lscpu_numa(lscpu_map);
-        m_gpu_info[GEOPM_DOMAIN_GPU] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU);
-        m_gpu_info[GEOPM_DOMAIN_GPU_CHIP] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU_CHIP);
+        // Avoid parsing the cache file if the binary form is current
+        std::string cache_file_name = local_cache_file_name();
+        bool is_binary_loaded = false;
+        if (!cache_file_name.empty()) {
+            create_local_cache(cache_file_name);
+            is_binary_loaded = read_binary_cache(cache_file_name);
+        }
+        if (!is_binary_loaded) {
+            std::map<std::string, std::string> lscpu_map;
+            lscpu(lscpu_map);
+            parse_lscpu(lscpu_map, m_num_package, m_core_per_package, m_thread_per_core);
+            m_num_cpu = m_num_package * m_core_per_package * m_thread_per_core;
+            m_numa_map = parse_lscpu_numa(lscpu_map);
+            m_gpu_info[GEOPM_DOMAIN_GPU] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU);
+            m_gpu_info[GEOPM_DOMAIN_GPU_CHIP] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU_CHIP);
+            m_domain_idx = domain_idx_table();
+            if (!cache_file_name.empty()) {
+                write_binary_cache(cache_file_name);
+            }
+        }
     }
 
     int PlatformTopoImp::num_domain(int domain_type) const
@@ -177,118 +199,18 @@ namespace geopm
         return result;
     }
 
-    std::set<int> PlatformTopoImp::domain_cpus(int domain_type,
-                                               int domain_idx) const
-    {
-        if (domain_type < 0 || domain_type >= GEOPM_NUM_DOMAIN) {
-            throw Exception("PlatformTopoImp::domain_cpus(): domain_type out of range",
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-        int num_dom = num_domain(domain_type);
-        if (domain_idx < 0 || domain_idx >= num_dom) {
-            throw Exception("PlatformTopoImp::domain_cpus(): domain_idx out of range",
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-
-        std::set<int> cpu_idx;
-        switch (domain_type) {
-            case GEOPM_DOMAIN_BOARD:
-                for (auto &numa_cpus : m_numa_map) {
-                    cpu_idx.insert(numa_cpus.begin(), numa_cpus.end());
-                }
-                break;
-            case GEOPM_DOMAIN_GPU:
-            case GEOPM_DOMAIN_GPU_CHIP:
-                cpu_idx = m_gpu_info.at(domain_type).at(domain_idx);
-                break;
-            case GEOPM_DOMAIN_PACKAGE:
-                for (int thread_idx = 0;
-                     thread_idx != m_thread_per_core;
-                     ++thread_idx) {
-                    for (int core_idx = domain_idx * m_core_per_package;
-                         core_idx != (domain_idx + 1) * m_core_per_package;
-                         ++core_idx) {
-                        cpu_idx.insert(core_idx + thread_idx * m_core_per_package * m_num_package);
-                    }
-                }
-                break;
-            case GEOPM_DOMAIN_CORE:
-                for (int thread_idx = 0;
-                     thread_idx != m_thread_per_core;
-                     ++thread_idx) {
-                    cpu_idx.insert(domain_idx + thread_idx * m_core_per_package * m_num_package);
-                }
-                break;
-            case GEOPM_DOMAIN_CPU:
-                cpu_idx.insert(domain_idx);
-                break;
-            case GEOPM_DOMAIN_MEMORY:
-                cpu_idx = m_numa_map[domain_idx];
-                break;
-            default:
-                throw Exception("PlatformTopoImp::domain_cpus(domain_type=" +
-                                std::to_string(domain_type) +
-                                ") support not yet implemented",
-                                GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
-                break;
-        }
-        return cpu_idx;
-    }
-
     int PlatformTopoImp::domain_idx(int domain_type,
                                     int cpu_idx) const
     {
-        int result = -1;
-        int num_cpu = num_domain(GEOPM_DOMAIN_CPU);
-
         if (domain_type < 0 || domain_type >= GEOPM_NUM_DOMAIN) {
             throw Exception("PlatformTopoImp::domain_idx(): domain_type out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        if (cpu_idx < 0 || cpu_idx >= num_cpu) {
+        if (cpu_idx < 0 || cpu_idx >= m_num_cpu) {
             throw Exception("PlatformTopoImp::domain_idx(): cpu_idx out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-
-        int core_idx = 0;
-        int numa_idx = 0;
         switch (domain_type) {
-            case GEOPM_DOMAIN_BOARD:
-                result = 0;
-                break;
-            case GEOPM_DOMAIN_PACKAGE:
-                core_idx = cpu_idx % (m_num_package * m_core_per_package);
-                result = core_idx / m_core_per_package;
-                break;
-            case GEOPM_DOMAIN_CORE:
-                result = cpu_idx % (m_num_package * m_core_per_package);
-                break;
-            case GEOPM_DOMAIN_CPU:
-                result = cpu_idx;
-                break;
-            case GEOPM_DOMAIN_MEMORY:
-            case GEOPM_DOMAIN_GPU:
-            case GEOPM_DOMAIN_GPU_CHIP:
-                {
-                const auto &domain_map = (domain_type == GEOPM_DOMAIN_MEMORY) ?
-                                         m_numa_map :
-                                         m_gpu_info.at(domain_type);
-                for (const auto &set_it : domain_map) {
-                    for (const auto &cpu_it : set_it) {
-                        if (cpu_it == cpu_idx) {
-                            result = numa_idx;
-                            // Find the lowest index numa node that contains the CPU.
-                            break;
-                        }
-                    }
-                    if (result != -1) {
-                        // Find the lowest index numa node that contains the CPU.
-                        break;
-                    }
-                    ++numa_idx;
-                }
-                }
-                break;
             case GEOPM_DOMAIN_PACKAGE_INTEGRATED_GPU:
             case GEOPM_DOMAIN_PACKAGE_INTEGRATED_MEMORY:
             case GEOPM_DOMAIN_NIC:
@@ -297,12 +219,38 @@ namespace geopm
                 throw Exception("PlatformTopoImp::domain_idx() no support yet for PACKAGE_INTEGRATED_MEMORY, NIC, or GPU",
                                 GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
                 break;
-            case GEOPM_DOMAIN_INVALID:
             default:
-                throw Exception("PlatformTopoImp::domain_idx() invalid domain specified",
-                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
                 break;
         }
+        return m_domain_idx[domain_type * m_num_cpu + cpu_idx];
+    }
+
+    std::vector<int32_t> PlatformTopoImp::domain_idx_table(void) const
+    {
+        // Domains without domain_idx() support are marked with -1
+        std::vector<int32_t> result(GEOPM_NUM_DOMAIN * m_num_cpu, -1);
+        int num_core = m_num_package * m_core_per_package;
+        for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+            int core_idx = cpu_idx % num_core;
+            result[GEOPM_DOMAIN_BOARD * m_num_cpu + cpu_idx] = 0;
+            result[GEOPM_DOMAIN_PACKAGE * m_num_cpu + cpu_idx] = core_idx / m_core_per_package;
+            result[GEOPM_DOMAIN_CORE * m_num_cpu + cpu_idx] = core_idx;
+            result[GEOPM_DOMAIN_CPU * m_num_cpu + cpu_idx] = cpu_idx;
+        }
+        for (int domain_type : M_CPU_SET_DOMAIN) {
+            const auto &domain_map = (domain_type == GEOPM_DOMAIN_MEMORY) ?
+                                     m_numa_map :
+                                     m_gpu_info.at(domain_type);
+            // Assign each CPU to the lowest index domain that
+            // contains it, or -1 if there is none.
+            for (int set_idx = (int)domain_map.size() - 1; set_idx >= 0; --set_idx) {
+                for (int cpu_idx : domain_map[set_idx]) {
+                    if (cpu_idx >= 0 && cpu_idx < m_num_cpu) {
+                        result[domain_type * m_num_cpu + cpu_idx] = set_idx;
+                    }
+                }
+            }
+        }
         return result;
     }
 
@@ -363,12 +311,158 @@ namespace geopm
                             " is not contained within domain type " + std::to_string(outer_domain),
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        std::set<int> inner_domain_idx;
-        std::set<int> cpus = domain_cpus(outer_domain, outer_idx);
-        for (auto cc : cpus) {
-            inner_domain_idx.insert(domain_idx(inner_domain, cc));
+        const nested_table_s &table = domain_nested_table(inner_domain, outer_domain);
+        if (outer_idx < 0 || outer_idx >= (int)table.offset.size() - 1) {
+            throw Exception("PlatformTopoImp::domain_nested(): outer_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
-        return inner_domain_idx;
+        return std::set<int>(table.inner_idx.begin() + table.offset[outer_idx],
+                             table.inner_idx.begin() + table.offset[outer_idx + 1]);
+    }
+
+    const PlatformTopo::nested_table_s &PlatformTopoImp::domain_nested_table(int inner_domain, int outer_domain) const
+    {
+        if (inner_domain < 0 || inner_domain >= GEOPM_NUM_DOMAIN ||
+            outer_domain < 0 || outer_domain >= GEOPM_NUM_DOMAIN) {
+            throw Exception("PlatformTopoImp::domain_nested_table(): domain_type out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!is_nested_domain(inner_domain, outer_domain)) {
+            throw Exception("PlatformTopoImp::domain_nested_table(): domain type " + std::to_string(inner_domain) +
+                            " is not contained within domain type " + std::to_string(outer_domain),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        const nested_table_s &result = nested_table(inner_domain, outer_domain);
+        if (result.offset.empty()) {
+            throw Exception("PlatformTopoImp::domain_nested_table(): no support yet for nesting of domain type " +
+                            std::to_string(inner_domain) + " within domain type " + std::to_string(outer_domain),
+                            GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    bool PlatformTopoImp::is_nested_table_domain(int domain_type)
+    {
+        return std::find(M_NESTED_TABLE_DOMAIN, M_NESTED_TABLE_DOMAIN + M_NUM_NESTED_TABLE_DOMAIN,
+                         domain_type) != M_NESTED_TABLE_DOMAIN + M_NUM_NESTED_TABLE_DOMAIN;
+    }
+
+    const PlatformTopo::nested_table_s &PlatformTopoImp::nested_table(int inner_domain, int outer_domain) const
+    {
+        int pair_idx = inner_domain * GEOPM_NUM_DOMAIN + outer_domain;
+        // Each table is created on first use so that constructing
+        // the topology does not pay for tables that are not needed.
+        // The table is copied from the binary cache if that was read.
+        std::call_once(m_nested_table_once[pair_idx], [this, inner_domain, outer_domain, pair_idx]() {
+            if (!is_nested_table_domain(inner_domain) ||
+                !is_nested_table_domain(outer_domain) ||
+                !is_nested_domain(inner_domain, outer_domain)) {
+                return;
+            }
+            nested_table_s &table = m_nested_table[pair_idx];
+            if (m_binary_cache.empty()) {
+                table = create_nested_table(inner_domain, outer_domain);
+            }
+            else {
+                const int32_t *data = m_binary_cache.data() + m_binary_nested_pos[pair_idx];
+                int num_outer = num_domain(outer_domain);
+                table.offset.assign(data, data + num_outer + 1);
+                data += num_outer + 1;
+                table.inner_idx.assign(data, data + table.offset.back());
+                data += table.offset.back();
+                table.outer_idx.assign(data, data + num_domain(inner_domain));
+            }
+        });
+        return m_nested_table[pair_idx];
+    }
+
+    PlatformTopo::nested_table_s PlatformTopoImp::create_nested_table(int inner_domain, int outer_domain) const
+    {
+        nested_table_s table;
+        // CPUs within each outer domain in the same form as
+        // the table
+        int num_outer = num_domain(outer_domain);
+        std::vector<int> cpu_offset(num_outer + 1, 0);
+        std::vector<int> outer_cpu;
+        outer_cpu.reserve(m_num_cpu);
+        if (outer_domain == GEOPM_DOMAIN_BOARD) {
+            std::vector<bool> is_board_cpu(m_num_cpu, false);
+            for (const auto &numa_cpus : m_numa_map) {
+                for (int cpu_idx : numa_cpus) {
+                    if (cpu_idx >= 0 && cpu_idx < m_num_cpu) {
+                        is_board_cpu[cpu_idx] = true;
+                    }
+                }
+            }
+            for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+                if (is_board_cpu[cpu_idx]) {
+                    outer_cpu.push_back(cpu_idx);
+                }
+            }
+            cpu_offset[1] = outer_cpu.size();
+        }
+        else if (outer_domain == GEOPM_DOMAIN_PACKAGE ||
+                 outer_domain == GEOPM_DOMAIN_CORE ||
+                 outer_domain == GEOPM_DOMAIN_CPU) {
+            // Each CPU is in exactly one of these domains
+            const int32_t *outer_row = m_domain_idx.data() + outer_domain * m_num_cpu;
+            for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+                ++cpu_offset[outer_row[cpu_idx] + 1];
+            }
+            std::partial_sum(cpu_offset.begin(), cpu_offset.end(), cpu_offset.begin());
+            outer_cpu.resize(m_num_cpu);
+            std::vector<int> cpu_pos(cpu_offset.begin(), cpu_offset.end() - 1);
+            for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+                outer_cpu[cpu_pos[outer_row[cpu_idx]]++] = cpu_idx;
+            }
+        }
+        else {
+            const auto &cpu_sets = (outer_domain == GEOPM_DOMAIN_MEMORY) ?
+                                   m_numa_map :
+                                   m_gpu_info.at(outer_domain);
+            for (int outer_idx = 0; outer_idx != num_outer; ++outer_idx) {
+                for (int cpu_idx : cpu_sets[outer_idx]) {
+                    if (cpu_idx >= 0 && cpu_idx < m_num_cpu) {
+                        outer_cpu.push_back(cpu_idx);
+                    }
+                }
+                cpu_offset[outer_idx + 1] = outer_cpu.size();
+            }
+        }
+        const int32_t *inner_row = m_domain_idx.data() + inner_domain * m_num_cpu;
+        int num_inner = num_domain(inner_domain);
+        // Last outer domain that each inner domain was found
+        // in, used to skip repeats.
+        int max_inner_idx = m_num_cpu == 0 ? -1 :
+                            *std::max_element(inner_row, inner_row + m_num_cpu);
+        std::vector<int> last_outer(max_inner_idx + 1, -1);
+        table.offset.reserve(num_outer + 1);
+        table.inner_idx.reserve(outer_cpu.size());
+        table.outer_idx.assign(num_inner, -1);
+        for (int outer_idx = 0; outer_idx != num_outer; ++outer_idx) {
+            size_t row_begin = table.inner_idx.size();
+            table.offset.push_back(row_begin);
+            // Inner domains of the CPUs in the outer domain,
+            // CPUs without an inner domain are skipped.
+            for (int cpu_pos = cpu_offset[outer_idx];
+                 cpu_pos != cpu_offset[outer_idx + 1]; ++cpu_pos) {
+                int inner_idx = inner_row[outer_cpu[cpu_pos]];
+                if (inner_idx != -1 && last_outer[inner_idx] != outer_idx) {
+                    last_outer[inner_idx] = outer_idx;
+                    table.inner_idx.push_back(inner_idx);
+                    if (inner_idx < num_inner &&
+                        table.outer_idx[inner_idx] == -1) {
+                        table.outer_idx[inner_idx] = outer_idx;
+                    }
+                }
+            }
+            auto row_it = table.inner_idx.begin() + row_begin;
+            if (!std::is_sorted(row_it, table.inner_idx.end())) {
+                std::sort(row_it, table.inner_idx.end());
+            }
+        }
+        table.offset.push_back(table.inner_idx.size());
+        return table;
     }
 
     std::vector<std::string> PlatformTopo::domain_names(void)
@@ -434,13 +528,21 @@ namespace geopm
 
     void PlatformTopoImp::create_cache(const std::string &cache_file_name)
     {
-        const GPUTopo &gtopo = geopm::gpu_topo();
-        create_cache(cache_file_name, gtopo);
+        // Discovering the GPUs is slow, only do so if the cache
+        // file will be written.
+        if (!check_cache(cache_file_name)) {
+            const GPUTopo &gtopo = geopm::gpu_topo();
+            create_cache(cache_file_name, gtopo);
+        }
     }
 
     void PlatformTopoImp::create_cache(const std::string &cache_file_name, const GPUTopo &gtopo)
     {
-        // If cache file is not present, or is too old, create it
+        create_cache(cache_file_name, gtopo, M_SYSFS_PATH);
+    }
+
+    bool PlatformTopoImp::check_cache(const std::string &cache_file_name)
+    {
         bool is_file_ok = false;
         try {
             is_file_ok = check_file(cache_file_name);
@@ -451,8 +553,14 @@ namespace geopm
                 throw; // Permission was denied; Cannot create files at the desired path
             }
         }
+        return is_file_ok;
+    }
 
-        if (is_file_ok == false) {
+    void PlatformTopoImp::create_cache(const std::string &cache_file_name, const GPUTopo &gtopo,
+                                       const std::string &sysfs_path)
+    {
+        // If cache file is not present, or is too old, create it
+        if (!check_cache(cache_file_name)) {
             std::string tmp_string = cache_file_name + "XXXXXX";
             char tmp_path[PATH_MAX];
             tmp_path[PATH_MAX - 1] = '\0';
@@ -466,20 +574,43 @@ namespace geopm
             }
             close(tmp_fd);
 
-            std::ostringstream cmd;
-            cmd << "unset LD_PRELOAD; LC_ALL=C lscpu -x >> " << tmp_path << ";";
-
-            FILE *pid;
-            int err = geopm_topo_popen(cmd.str().c_str(), &pid);
-            if (err) {
-                unlink(tmp_path);
-                throw Exception("PlatformTopo::create_cache(): Could not popen lscpu command: ",
-                                err, __FILE__, __LINE__);
+            // Prefer reading sysfs over spawning lscpu
+            std::string sysfs_topo;
+            if (!sysfs_path.empty()) {
+                try {
+                    sysfs_topo = read_sysfs_topo(sysfs_path);
+                }
+                catch (const std::exception &ex) {
+                    sysfs_topo.clear();
+                }
             }
-            if (pclose(pid)) {
-                unlink(tmp_path);
-                throw Exception("PlatformTopo::create_cache(): Could not pclose lscpu command: ",
-                                errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            int err = 0;
+            if (!sysfs_topo.empty()) {
+                std::ofstream cache_stream(tmp_path);
+                cache_stream << sysfs_topo;
+                cache_stream.close();
+                if (!cache_stream) {
+                    unlink(tmp_path);
+                    throw Exception("PlatformTopo::create_cache(): Could not write temp file: ",
+                                    errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+            }
+            else {
+                std::ostringstream cmd;
+                cmd << "unset LD_PRELOAD; LC_ALL=C lscpu -x >> " << tmp_path << ";";
+
+                FILE *pid;
+                err = geopm_topo_popen(cmd.str().c_str(), &pid);
+                if (err) {
+                    unlink(tmp_path);
+                    throw Exception("PlatformTopo::create_cache(): Could not popen lscpu command: ",
+                                    err, __FILE__, __LINE__);
+                }
+                if (pclose(pid)) {
+                    unlink(tmp_path);
+                    throw Exception("PlatformTopo::create_cache(): Could not pclose lscpu command: ",
+                                    errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
             }
             if (gtopo.num_gpu() != 0) {
                 std::ofstream cache_stream;
@@ -574,6 +705,113 @@ namespace geopm
         }
     }
 
+    std::string PlatformTopoImp::read_sysfs_topo(const std::string &sysfs_path)
+    {
+        std::string cpu_path = sysfs_path + "/cpu";
+        std::set<int> present_cpus = parse_cpu_list(geopm::read_file(cpu_path + "/present"));
+        std::set<int> online_cpus = parse_cpu_list(geopm::read_file(cpu_path + "/online"));
+        if (present_cpus.empty() || online_cpus.empty()) {
+            throw Exception("PlatformTopoImp::read_sysfs_topo(): no CPUs listed in " + cpu_path,
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        // Count the packages and cores of the online CPUs in the
+        // same way that lscpu does.
+        std::set<std::string> package_ids;
+        std::set<std::set<int> > core_cpus;
+        size_t thread_per_core = 0;
+        for (int cpu_idx : online_cpus) {
+            std::string topo_path = cpu_path + "/cpu" + std::to_string(cpu_idx) + "/topology/";
+            std::string package_id = geopm::read_file(topo_path + "physical_package_id");
+            package_ids.insert(package_id.substr(0, package_id.find_first_of(" \n")));
+            std::set<int> siblings = parse_cpu_list(geopm::read_file(topo_path + "thread_siblings_list"));
+            thread_per_core = std::max(thread_per_core, siblings.size());
+            core_cpus.insert(siblings);
+        }
+        std::map<int, std::set<int> > node_cpus;
+        std::string node_path = sysfs_path + "/node";
+        std::vector<std::string> node_files;
+        try {
+            node_files = geopm::list_directory_files(node_path);
+        }
+        catch (const geopm::Exception &ex) {
+            // Kernel without NUMA support, lscpu does not list nodes
+        }
+        for (const auto &node_name : node_files) {
+            if (geopm::string_begins_with(node_name, "node") &&
+                node_name.size() > 4 &&
+                node_name.find_first_not_of("0123456789", 4) == std::string::npos) {
+                node_cpus[std::stoi(node_name.substr(4))] =
+                    parse_cpu_list(geopm::read_file(node_path + "/" + node_name + "/cpulist"));
+            }
+        }
+        struct utsname uname_buf;
+        std::string architecture = uname(&uname_buf) ? "unknown" : uname_buf.machine;
+        std::ostringstream result;
+        result << "Architecture:        " << architecture << "\n"
+               << "CPU(s):              " << present_cpus.size() << "\n"
+               << "On-line CPU(s) mask: " << format_cpu_mask(online_cpus) << "\n"
+               << "Thread(s) per core:  " << thread_per_core << "\n"
+               << "Core(s) per socket:  " << core_cpus.size() / package_ids.size() << "\n"
+               << "Socket(s):           " << package_ids.size() << "\n";
+        if (!node_cpus.empty()) {
+            result << "NUMA node(s):        " << node_cpus.size() << "\n";
+        }
+        for (const auto &node_it : node_cpus) {
+            result << "NUMA node" << node_it.first << " CPU(s):   " << format_cpu_mask(node_it.second) << "\n";
+        }
+        return result.str();
+    }
+
+    std::set<int> PlatformTopoImp::parse_cpu_list(const std::string &cpu_list)
+    {
+        // Format is a comma separated list of CPUs and CPU ranges, e.g. "0-3,8,10-11"
+        std::set<int> result;
+        std::string list = cpu_list;
+        list.erase(std::remove_if(list.begin(), list.end(), ::isspace), list.end());
+        if (list.empty()) {
+            return result;
+        }
+        for (const auto &range : geopm::string_split(list, ",")) {
+            auto bounds = geopm::string_split(range, "-");
+            try {
+                if (bounds.size() == 1) {
+                    result.insert(std::stoi(bounds[0]));
+                }
+                else if (bounds.size() == 2) {
+                    int end = std::stoi(bounds[1]);
+                    for (int cpu_idx = std::stoi(bounds[0]); cpu_idx <= end; ++cpu_idx) {
+                        result.insert(cpu_idx);
+                    }
+                }
+                else {
+                    throw std::invalid_argument(range);
+                }
+            }
+            catch (const std::logic_error &ex) {
+                throw Exception("PlatformTopoImp::parse_cpu_list(): invalid CPU list: " + cpu_list,
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        return result;
+    }
+
+    std::string PlatformTopoImp::format_cpu_mask(const std::set<int> &cpu_set)
+    {
+        // Hexadecimal mask as printed by "lscpu -x", e.g. "0x5" for CPUs 0 and 2
+        std::string result;
+        int num_digit = cpu_set.empty() ? 1 : *cpu_set.rbegin() / 4 + 1;
+        for (int digit_idx = num_digit - 1; digit_idx >= 0; --digit_idx) {
+            int digit = 0;
+            for (int bit_idx = 0; bit_idx != 4; ++bit_idx) {
+                if (cpu_set.count(digit_idx * 4 + bit_idx)) {
+                    digit |= 1 << bit_idx;
+                }
+            }
+            result.push_back("0123456789abcdef"[digit]);
+        }
+        return "0x" + result;
+    }
+
     std::vector<std::set<int> > PlatformTopoImp::parse_lscpu_numa(const std::map<std::string, std::string> &lscpu_map)
     {
         std::vector<std::set<int> > numa_map;
@@ -675,14 +913,9 @@ namespace geopm
 
     std::string PlatformTopoImp::read_lscpu(void)
     {
-        std::string result;
-        // Early return for root user
-        if (geopm::has_cap_sys_admin()) {
-            create_cache(M_SERVICE_CACHE_FILE_NAME);
-            return geopm::read_file(M_SERVICE_CACHE_FILE_NAME);
-        }
+        std::string cache_file_name = local_cache_file_name();
         // Early return for getting cache from service
-        if (m_service_proxy != nullptr) {
+        if (cache_file_name.empty()) {
             try {
                 return m_service_proxy->topo_get_cache();
             }
@@ -694,16 +927,264 @@ namespace geopm
                 }
                 m_service_proxy.reset();
             }
+            cache_file_name = local_cache_file_name();
+        }
+        create_local_cache(cache_file_name);
+        return geopm::read_file(cache_file_name);
+    }
+
+    std::string PlatformTopoImp::local_cache_file_name(void) const
+    {
+        std::string result;
+        if (geopm::has_cap_sys_admin()) {
+            result = M_SERVICE_CACHE_FILE_NAME;
+        }
+        else if (m_service_proxy != nullptr) {
+            // Cache is provided by the service
+        }
+        else if (M_TEST_CACHE_FILE_NAME.size()) {
+            result = M_TEST_CACHE_FILE_NAME;
+        }
+        else {
+            // In all other cases create a cache in /tmp
+            result = M_CACHE_FILE_NAME;
+        }
+        return result;
+    }
+
+    void PlatformTopoImp::create_local_cache(const std::string &cache_file_name) const
+    {
+        if (cache_file_name == M_TEST_CACHE_FILE_NAME) {
+            // Mocked file in test case, generated by lscpu so that
+            // the command may be spoofed.
+            GPUTopoNull mock_topo;
+            create_cache(M_TEST_CACHE_FILE_NAME, mock_topo, "");
+        }
+        else {
+            create_cache(cache_file_name);
+        }
+    }
+
+    std::string PlatformTopoImp::binary_cache_file_name(const std::string &cache_file_name)
+    {
+        return cache_file_name + ".bin";
+    }
+
+    bool PlatformTopoImp::read_binary_cache(const std::string &cache_file_name)
+    {
+        struct stat cache_stat;
+        if (stat(cache_file_name.c_str(), &cache_stat)) {
+            return false;
+        }
+        std::string binary_file_name = binary_cache_file_name(cache_file_name);
+        UniqueFd binary_fd(open(binary_file_name.c_str(), O_RDONLY | O_CLOEXEC));
+        if (binary_fd.get() == -1) {
+            return false;
+        }
+        // The binary cache must be owned by the user, have the same
+        // permissions as the cache file, and have been written after
+        // the cache file.
+        struct stat binary_stat;
+        if (fstat(binary_fd.get(), &binary_stat) ||
+            binary_stat.st_uid != geteuid() ||
+            (binary_stat.st_mode & ~S_IFMT) != (S_IRUSR | S_IWUSR) ||
+            binary_stat.st_mtim.tv_sec < cache_stat.st_mtim.tv_sec ||
+            (binary_stat.st_mtim.tv_sec == cache_stat.st_mtim.tv_sec &&
+             binary_stat.st_mtim.tv_nsec <= cache_stat.st_mtim.tv_nsec) ||
+            (size_t)binary_stat.st_size < sizeof(m_binary_cache_header_s)) {
+            return false;
+        }
+        // The file is small and read once, so it is read into a
+        // buffer that backs the nesting tables rather than mapped.
+        size_t binary_size = binary_stat.st_size - sizeof(m_binary_cache_header_s);
+        if (binary_size % sizeof(int32_t) != 0) {
+            return false;
+        }
+        m_binary_cache_header_s header;
+        std::vector<int32_t> binary_cache(binary_size / sizeof(int32_t));
+        if (read(binary_fd.get(), &header, sizeof(header)) != (ssize_t)sizeof(header) ||
+            read(binary_fd.get(), binary_cache.data(), binary_size) != (ssize_t)binary_size) {
+            return false;
+        }
+        const int32_t *data = binary_cache.data();
+        const int32_t *data_end = data + binary_cache.size();
+        // Limit sizes to avoid overflow
+        const int32_t max_count = 1 << 24;
+        if (memcmp(header.magic, "GEOPMTOP", sizeof(header.magic)) != 0 ||
+            header.version != M_BINARY_CACHE_VERSION ||
+            header.num_package <= 0 || header.num_package > max_count ||
+            header.core_per_package <= 0 || header.core_per_package > max_count ||
+            header.thread_per_core <= 0 || header.thread_per_core > max_count ||
+            (int64_t)header.num_package * header.core_per_package *
+                header.thread_per_core > max_count) {
+            return false;
+        }
+        int num_cpu = header.num_package * header.core_per_package * header.thread_per_core;
+        size_t expect_size = (size_t)GEOPM_NUM_DOMAIN * num_cpu;
+        for (int set_idx = 0; set_idx != M_NUM_CPU_SET_DOMAIN; ++set_idx) {
+            if (header.num_set[set_idx] < 0 || header.num_set[set_idx] > max_count ||
+                header.num_set_cpu[set_idx] < 0 || header.num_set_cpu[set_idx] > max_count) {
+                return false;
+            }
+            expect_size += header.num_set[set_idx] + 1 + header.num_set_cpu[set_idx];
+        }
+        if ((size_t)(data_end - data) < expect_size) {
+            return false;
+        }
+        std::vector<int32_t> domain_idx(data, data + GEOPM_NUM_DOMAIN * num_cpu);
+        data += GEOPM_NUM_DOMAIN * num_cpu;
+        std::map<int, std::vector<std::set<int> > > cpu_set_map;
+        for (int set_idx = 0; set_idx != M_NUM_CPU_SET_DOMAIN; ++set_idx) {
+            const int32_t *offset = data;
+            const int32_t *cpu = data + header.num_set[set_idx] + 1;
+            data = cpu + header.num_set_cpu[set_idx];
+            if (offset[0] != 0 || offset[header.num_set[set_idx]] != header.num_set_cpu[set_idx]) {
+                return false;
+            }
+            auto &cpu_sets = cpu_set_map[M_CPU_SET_DOMAIN[set_idx]];
+            for (int domain_idx = 0; domain_idx != header.num_set[set_idx]; ++domain_idx) {
+                if (offset[domain_idx] > offset[domain_idx + 1]) {
+                    return false;
+                }
+                cpu_sets.emplace_back(cpu + offset[domain_idx], cpu + offset[domain_idx + 1]);
+            }
+        }
+        std::array<int, GEOPM_NUM_DOMAIN> domain_count {};
+        for (int domain_type = 0; domain_type != GEOPM_NUM_DOMAIN; ++domain_type) {
+            int num_domain = 0;
+            switch (domain_type) {
+                case GEOPM_DOMAIN_BOARD:
+                    num_domain = 1;
+                    break;
+                case GEOPM_DOMAIN_PACKAGE:
+                    num_domain = header.num_package;
+                    break;
+                case GEOPM_DOMAIN_CORE:
+                    num_domain = header.num_package * header.core_per_package;
+                    break;
+                case GEOPM_DOMAIN_CPU:
+                    num_domain = num_cpu;
+                    break;
+                case GEOPM_DOMAIN_MEMORY:
+                case GEOPM_DOMAIN_GPU:
+                case GEOPM_DOMAIN_GPU_CHIP:
+                    num_domain = cpu_set_map.at(domain_type).size();
+                    break;
+                default:
+                    break;
+            }
+            auto row_begin = domain_idx.begin() + domain_type * num_cpu;
+            if (std::any_of(row_begin, row_begin + num_cpu, [num_domain](int32_t idx) {
+                    return idx < -1 || idx >= num_domain;
+                })) {
+                return false;
+            }
+            domain_count[domain_type] = num_domain;
+        }
+        std::array<size_t, GEOPM_NUM_DOMAIN * GEOPM_NUM_DOMAIN> nested_pos {};
+        for (int outer_domain : M_NESTED_TABLE_DOMAIN) {
+            for (int inner_domain : M_NESTED_TABLE_DOMAIN) {
+                if (!is_nested_domain(inner_domain, outer_domain)) {
+                    continue;
+                }
+                int num_outer = domain_count[outer_domain];
+                int num_inner = domain_count[inner_domain];
+                const int32_t *offset = data;
+                if (data_end - offset < num_outer + 1 || offset[0] != 0) {
+                    return false;
+                }
+                for (int outer_idx = 0; outer_idx != num_outer; ++outer_idx) {
+                    if (offset[outer_idx] > offset[outer_idx + 1]) {
+                        return false;
+                    }
+                }
+                const int32_t *inner_idx = offset + num_outer + 1;
+                if (data_end - inner_idx < (ptrdiff_t)offset[num_outer] + num_inner) {
+                    return false;
+                }
+                const int32_t *outer_idx = inner_idx + offset[num_outer];
+                data = outer_idx + num_inner;
+                if (std::any_of(inner_idx, outer_idx, [num_inner](int32_t idx) {
+                        return idx < 0 || idx >= num_inner;
+                    }) ||
+                    std::any_of(outer_idx, data, [num_outer](int32_t idx) {
+                        return idx < -1 || idx >= num_outer;
+                    })) {
+                    return false;
+                }
+                nested_pos[inner_domain * GEOPM_NUM_DOMAIN + outer_domain] = offset - binary_cache.data();
+            }
+        }
+        if (data != data_end) {
+            return false;
+        }
+        m_num_package = header.num_package;
+        m_core_per_package = header.core_per_package;
+        m_thread_per_core = header.thread_per_core;
+        m_num_cpu = num_cpu;
+        m_numa_map = std::move(cpu_set_map.at(GEOPM_DOMAIN_MEMORY));
+        m_gpu_info[GEOPM_DOMAIN_GPU] = std::move(cpu_set_map.at(GEOPM_DOMAIN_GPU));
+        m_gpu_info[GEOPM_DOMAIN_GPU_CHIP] = std::move(cpu_set_map.at(GEOPM_DOMAIN_GPU_CHIP));
+        m_domain_idx = std::move(domain_idx);
+        m_binary_cache = std::move(binary_cache);
+        m_binary_nested_pos = nested_pos;
+        return true;
+    }
+
+    void PlatformTopoImp::write_binary_cache(const std::string &cache_file_name) const
+    {
+        m_binary_cache_header_s header {};
+        memcpy(header.magic, "GEOPMTOP", sizeof(header.magic));
+        header.version = M_BINARY_CACHE_VERSION;
+        header.num_package = m_num_package;
+        header.core_per_package = m_core_per_package;
+        header.thread_per_core = m_thread_per_core;
+        std::vector<int32_t> data(m_domain_idx);
+        for (int set_idx = 0; set_idx != M_NUM_CPU_SET_DOMAIN; ++set_idx) {
+            int domain_type = M_CPU_SET_DOMAIN[set_idx];
+            const auto &domain_map = (domain_type == GEOPM_DOMAIN_MEMORY) ?
+                                     m_numa_map :
+                                     m_gpu_info.at(domain_type);
+            header.num_set[set_idx] = domain_map.size();
+            int32_t offset = 0;
+            data.push_back(offset);
+            for (const auto &cpu_set : domain_map) {
+                offset += cpu_set.size();
+                data.push_back(offset);
+            }
+            header.num_set_cpu[set_idx] = offset;
+            for (const auto &cpu_set : domain_map) {
+                data.insert(data.end(), cpu_set.begin(), cpu_set.end());
+            }
+        }
+        for (int outer_domain : M_NESTED_TABLE_DOMAIN) {
+            for (int inner_domain : M_NESTED_TABLE_DOMAIN) {
+                if (is_nested_domain(inner_domain, outer_domain)) {
+                    const nested_table_s &table = nested_table(inner_domain, outer_domain);
+                    data.insert(data.end(), table.offset.begin(), table.offset.end());
+                    data.insert(data.end(), table.inner_idx.begin(), table.inner_idx.end());
+                    data.insert(data.end(), table.outer_idx.begin(), table.outer_idx.end());
+                }
+            }
+        }
+        // The binary cache is an optimization: give up on any error
+        std::string tmp_string = binary_cache_file_name(cache_file_name) + "XXXXXX";
+        std::vector<char> tmp_path(tmp_string.begin(), tmp_string.end());
+        tmp_path.push_back('\0');
+        mode_t orig_mask = umask(S_IRGRP | S_IWGRP | S_IXGRP | S_IROTH | S_IWOTH | S_IXOTH);
+        int tmp_fd = mkstemp(tmp_path.data());
+        umask(orig_mask);
+        if (tmp_fd == -1) {
+            return;
         }
-        // Early return for mocked file in test case
-        if (M_TEST_CACHE_FILE_NAME.size()) {
-            auto mock_topo = std::make_unique<GPUTopoNull>();
-            create_cache(M_TEST_CACHE_FILE_NAME, *mock_topo);
-            return geopm::read_file(M_TEST_CACHE_FILE_NAME);
+        size_t data_size = data.size() * sizeof(int32_t);
+        bool is_written = write(tmp_fd, &header, sizeof(header)) == (ssize_t)sizeof(header) &&
+                          write(tmp_fd, data.data(), data_size) == (ssize_t)data_size;
+        is_written = close(tmp_fd) == 0 && is_written;
+        if (!is_written ||
+            rename(tmp_path.data(), binary_cache_file_name(cache_file_name).c_str())) {
+            unlink(tmp_path.data());
         }
-        // In all other cases create a cache in /tmp
-        create_cache(M_CACHE_FILE_NAME);
-        return geopm::read_file(M_CACHE_FILE_NAME);
     }
 
     void PlatformTopoImp::lscpu(std::map<std::string, std::string> &lscpu_map)
@@ -8,9 +8,12 @@
 #define PLATFORMTOPOIMP_HPP_INCLUDE
 
 #include "geopm/PlatformTopo.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace geopm
 {
@@ -29,17 +32,68 @@ namespace geopm
                            int cpu_idx) const override;
             bool is_nested_domain(int inner_domain, int outer_domain) const override;
             std::set<int> domain_nested(int inner_domain, int outer_domain, int outer_idx) const override;
+            const nested_table_s &domain_nested_table(int inner_domain, int outer_domain) const override;
             static void create_cache();
             static void create_cache(const std::string &cache_file_name);
             static void create_cache(const std::string &cache_file_name, const GPUTopo &gtopo);
+            /// @brief Create the cache file if it is missing or out
+            ///        of date.
+            /// @param [in] cache_file_name Path to the cache file.
+            /// @param [in] gtopo GPU topology appended to the cache.
+            /// @param [in] sysfs_path Path to the sysfs system
+            ///        devices directory that describes the CPUs, or
+            ///        empty to run lscpu instead.  The lscpu command
+            ///        is also run if the sysfs files cannot be read.
+            static void create_cache(const std::string &cache_file_name, const GPUTopo &gtopo,
+                                     const std::string &sysfs_path);
+            /// @brief Describe the CPUs in the format printed by
+            ///        "lscpu -x" based on the files in sysfs.
+            /// @param [in] sysfs_path Path to the sysfs system
+            ///        devices directory, e.g. "/sys/devices/system".
+            /// @return Contents for the cache file.
+            static std::string read_sysfs_topo(const std::string &sysfs_path);
+            /// @brief Path of the binary form of a cache file.
+            static std::string binary_cache_file_name(const std::string &cache_file_name);
         private:
             static const std::string M_CACHE_FILE_NAME;
             static const std::string M_SERVICE_CACHE_FILE_NAME;
-            /// @brief Get the set of Linux logical CPUs associated
-            ///        with the indexed domain.
-            std::set<int> domain_cpus(int domain_type,
-                                      int domain_idx) const;
-
+            static const std::string M_SYSFS_PATH;
+            static constexpr uint32_t M_BINARY_CACHE_VERSION = 2;
+            static constexpr int M_NUM_CPU_SET_DOMAIN = 3;
+            /// Domains that are described by a list of CPU sets
+            static constexpr int M_CPU_SET_DOMAIN[M_NUM_CPU_SET_DOMAIN] = {
+                GEOPM_DOMAIN_MEMORY,
+                GEOPM_DOMAIN_GPU,
+                GEOPM_DOMAIN_GPU_CHIP,
+            };
+            static constexpr int M_NUM_NESTED_TABLE_DOMAIN = 7;
+            /// Domains that support domain_nested_table()
+            static constexpr int M_NESTED_TABLE_DOMAIN[M_NUM_NESTED_TABLE_DOMAIN] = {
+                GEOPM_DOMAIN_BOARD,
+                GEOPM_DOMAIN_PACKAGE,
+                GEOPM_DOMAIN_CORE,
+                GEOPM_DOMAIN_CPU,
+                GEOPM_DOMAIN_MEMORY,
+                GEOPM_DOMAIN_GPU,
+                GEOPM_DOMAIN_GPU_CHIP,
+            };
+            /// Header of the binary cache file.  It is followed by
+            /// the domain_idx() table and then, for each domain in
+            /// M_CPU_SET_DOMAIN, the offsets of each CPU set into the
+            /// CPU list, and the CPU list.  Last are the offset,
+            /// inner_idx and outer_idx vectors of the nesting table
+            /// for each nested pair of domains in
+            /// M_NESTED_TABLE_DOMAIN, ordered by outer domain and
+            /// then by inner domain.
+            struct m_binary_cache_header_s {
+                char magic[8];
+                uint32_t version;
+                int32_t num_package;
+                int32_t core_per_package;
+                int32_t thread_per_core;
+                int32_t num_set[M_NUM_CPU_SET_DOMAIN];
+                int32_t num_set_cpu[M_NUM_CPU_SET_DOMAIN];
+            };
             void lscpu(std::map<std::string, std::string> &lscpu_map);
             void parse_lscpu(const std::map<std::string, std::string> &lscpu_map,
                              int &num_package,
@@ -48,7 +102,33 @@ namespace geopm
             std::vector<std::set<int> > parse_lscpu_numa(const std::map<std::string, std::string> &lscpu_map);
             std::vector<std::set<int> > parse_lscpu_gpu(const std::map<std::string, std::string> &lscpu_map, int domain_type);
             std::string read_lscpu(void);
+            /// @brief Path of the cache file that is read, or empty
+            ///        if the cache is provided by the service.
+            std::string local_cache_file_name(void) const;
+            void create_local_cache(const std::string &cache_file_name) const;
+            /// @brief Load the topology from the binary form of a
+            ///        cache file if it is valid and newer than the
+            ///        cache file.
+            /// @return True if the topology was loaded.
+            bool read_binary_cache(const std::string &cache_file_name);
+            /// @brief Write the binary form of a cache file, errors
+            ///        are ignored.
+            void write_binary_cache(const std::string &cache_file_name) const;
+            /// @brief Index of the domain of each type that contains
+            ///        each CPU, indexed by domain_type * num_cpu + cpu_idx.
+            std::vector<int32_t> domain_idx_table(void) const;
+            /// @brief Nesting table for a pair of domains, created on
+            ///        first use.  The offset vector is empty if the
+            ///        pair is not supported.
+            const nested_table_s &nested_table(int inner_domain, int outer_domain) const;
+            /// @brief Compute the nesting table for a pair of domains
+            ///        that are both in M_NESTED_TABLE_DOMAIN.
+            nested_table_s create_nested_table(int inner_domain, int outer_domain) const;
+            static bool is_nested_table_domain(int domain_type);
             static bool check_file(const std::string &file_name);
+            static bool check_cache(const std::string &cache_file_name);
+            static std::set<int> parse_cpu_list(const std::string &cpu_list);
+            static std::string format_cpu_mask(const std::set<int> &cpu_set);
             static std::string gpu_short_name(int domain_type);
             static std::unique_ptr<ServiceProxy> try_service_proxy(void);
             const std::string M_TEST_CACHE_FILE_NAME;
@@ -58,6 +138,17 @@ namespace geopm
             std::vector<std::set<int> > m_numa_map;
             std::map<int, std::vector<std::set<int> > > m_gpu_info;
             std::shared_ptr<ServiceProxy> m_service_proxy;
+            int m_num_cpu;
+            std::vector<int32_t> m_domain_idx;
+            /// Nesting tables indexed by
+            /// inner_domain * GEOPM_NUM_DOMAIN + outer_domain
+            mutable std::array<nested_table_s, GEOPM_NUM_DOMAIN * GEOPM_NUM_DOMAIN> m_nested_table;
+            mutable std::array<std::once_flag, GEOPM_NUM_DOMAIN * GEOPM_NUM_DOMAIN> m_nested_table_once;
+            /// Contents of the binary cache after the header if it
+            /// was read, otherwise empty
+            std::vector<int32_t> m_binary_cache;
+            /// Position in m_binary_cache of each nesting table
+            std::array<size_t, GEOPM_NUM_DOMAIN * GEOPM_NUM_DOMAIN> m_binary_nested_pos;
     };
 }
 #endif
@@ -0,0 +1,570 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "PrometheusExporter.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/PlatformIO.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "geopm_time.h"
+#include "geopm_version.h"
+#include "StatsCollector.hpp"
+#include "UniqueFd.hpp"
+
+namespace geopm
+{
+    static const std::vector<std::string> M_SAMPLE_STAT_NAME = {
+        "sample-time-total",
+        "sample-count",
+        "sample-period-mean",
+        "sample-period-std",
+    };
+
+    static const std::vector<std::string> M_METRIC_STAT_NAME = {
+        "count",
+        "first",
+        "last",
+        "min",
+        "max",
+        "mean",
+        "std",
+    };
+
+    std::unique_ptr<PrometheusExporter> PrometheusExporter::make_unique(const std::vector<geopm_request_s> &requests)
+    {
+        return geopm::make_unique<PrometheusExporterImp>(requests, std::vector<double> {});
+    }
+
+    std::unique_ptr<PrometheusExporter> PrometheusExporter::make_unique(const std::vector<geopm_request_s> &requests,
+                                                                        const std::vector<double> &quantiles)
+    {
+        return geopm::make_unique<PrometheusExporterImp>(requests, quantiles);
+    }
+
+    std::vector<geopm_request_s> PrometheusExporter::parse_requests(std::istream &input)
+    {
+        std::vector<geopm_request_s> result;
+        std::string line;
+        while (std::getline(input, line)) {
+            size_t comment_pos = line.find('#');
+            if (comment_pos != std::string::npos) {
+                line.erase(comment_pos);
+            }
+            std::istringstream line_stream(line);
+            std::vector<std::string> words;
+            std::string word;
+            while (line_stream >> word) {
+                words.push_back(word);
+            }
+            if (words.empty()) {
+                continue;
+            }
+            if (words.size() != 3) {
+                throw Exception("PrometheusExporter::parse_requests(): Read request must be three words: \"" + line + "\"",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            geopm_request_s request = {};
+            if (words[0].size() >= sizeof(request.name)) {
+                throw Exception("PrometheusExporter::parse_requests(): Signal name is too long: " + words[0],
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::strncpy(request.name, words[0].c_str(), sizeof(request.name) - 1);
+            request.domain_type = PlatformTopo::domain_name_to_type(words[1]);
+            if (words[2] == "*") {
+                int num_domain = platform_topo().num_domain(request.domain_type);
+                for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
+                    request.domain_idx = domain_idx;
+                    result.push_back(request);
+                }
+            }
+            else {
+                try {
+                    request.domain_idx = std::stoi(words[2]);
+                }
+                catch (const std::exception &ex) {
+                    throw Exception("PrometheusExporter::parse_requests(): Invalid domain index: " + words[2],
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                result.push_back(request);
+            }
+        }
+        return result;
+    }
+
+    std::vector<geopm_request_s> PrometheusExporter::default_requests(void)
+    {
+        static const std::vector<std::string> include_strings = {
+            "POWER", "ENERGY", "FREQ", "TEMPERATURE"
+        };
+        static const std::vector<std::string> exclude_strings = {
+            "::", "CONTROL", "MAX", "MIN", "STEP", "LIMIT", "STICKER"
+        };
+        auto is_in = [](const std::string &name, const std::vector<std::string> &keys) {
+            return std::any_of(keys.begin(), keys.end(), [&name](const std::string &key) {
+                return name.find(key) != std::string::npos;
+            });
+        };
+        std::vector<geopm_request_s> result;
+        for (const auto &name : platform_io().signal_names()) {
+            if (!is_in(name, exclude_strings) && is_in(name, include_strings) &&
+                name.size() < sizeof(geopm_request_s::name)) {
+                geopm_request_s request = {GEOPM_DOMAIN_BOARD, 0, {}};
+                std::strncpy(request.name, name.c_str(), sizeof(request.name) - 1);
+                result.push_back(request);
+            }
+        }
+        if (result.empty()) {
+            throw Exception("PrometheusExporter::default_requests(): Failed to find any signals to report",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::string PrometheusExporter::metric_name(const std::string &stat_name)
+    {
+        std::string canonical_name = stat_name;
+        for (auto &cc : canonical_name) {
+            cc = std::isalnum((unsigned char)cc) ? std::tolower((unsigned char)cc) : '_';
+        }
+        std::string units;
+        if (canonical_name.find("temperature") != std::string::npos) {
+            units = "_celcius";
+        }
+        else if (canonical_name.find("power") != std::string::npos) {
+            units = "_watts";
+        }
+        else if (canonical_name.find("energy") != std::string::npos) {
+            units = "_joules";
+        }
+        else if (canonical_name.find("freq") != std::string::npos) {
+            units = "_hertz";
+        }
+        return "geopm_" + canonical_name + units;
+    }
+
+    PrometheusExporterImp::PrometheusExporterImp(const std::vector<geopm_request_s> &requests,
+                                                 const std::vector<double> &quantiles)
+        : PrometheusExporterImp(StatsCollector::make_unique(requests, quantiles))
+    {
+
+    }
+
+    PrometheusExporterImp::PrometheusExporterImp(std::shared_ptr<StatsCollector> collector)
+        : m_collector(std::move(collector))
+    {
+        for (const auto &stat_name : M_SAMPLE_STAT_NAME) {
+            append_gauge(stat_name);
+        }
+        StatsCollector::report_s report = m_collector->report_struct();
+        for (const auto &name : report.metric_names) {
+            for (const auto &stat_name : M_METRIC_STAT_NAME) {
+                append_gauge(name + "-" + stat_name);
+            }
+            for (double quantile : report.quantiles) {
+                append_gauge(name + "-" + StatsCollector::quantile_name(quantile));
+            }
+        }
+        for (size_t value_idx = 0; value_idx < m_value_offset.size(); ++value_idx) {
+            format_value(value_idx, NAN);
+        }
+    }
+
+    void PrometheusExporterImp::append_gauge(const std::string &stat_name)
+    {
+        std::string name = metric_name(stat_name);
+        m_text += "# HELP " + name + " " + stat_name + "\n";
+        m_text += "# TYPE " + name + " gauge\n";
+        m_text += name + " ";
+        m_value_offset.push_back(m_text.size());
+        m_text.append(M_VALUE_WIDTH, ' ');
+        m_text += "\n";
+    }
+
+    void PrometheusExporterImp::format_value(size_t value_idx, double value)
+    {
+        char field[M_VALUE_WIDTH + 1];
+        if (std::isnan(value)) {
+            snprintf(field, sizeof(field), "%*s", M_VALUE_WIDTH, "NaN");
+        }
+        else if (std::isinf(value)) {
+            snprintf(field, sizeof(field), "%*s", M_VALUE_WIDTH, value > 0 ? "+Inf" : "-Inf");
+        }
+        else {
+            snprintf(field, sizeof(field), "%*.17g", M_VALUE_WIDTH, value);
+        }
+        // The leading blanks are separators in the text format
+        std::copy(field, field + M_VALUE_WIDTH, m_text.begin() + m_value_offset[value_idx]);
+    }
+
+    void PrometheusExporterImp::update(void)
+    {
+        m_collector->update();
+    }
+
+    const std::string &PrometheusExporterImp::scrape(void)
+    {
+        StatsCollector::report_s report = m_collector->report_struct();
+        m_collector->reset();
+        size_t value_idx = 0;
+        for (double value : report.sample_stats) {
+            format_value(value_idx, value);
+            ++value_idx;
+        }
+        std::vector<double> values;
+        for (size_t metric_idx = 0; metric_idx < report.metric_stats.size(); ++metric_idx) {
+            values.assign(report.metric_stats[metric_idx].begin(),
+                          report.metric_stats[metric_idx].end());
+            if (metric_idx < report.metric_quantiles.size()) {
+                values.insert(values.end(), report.metric_quantiles[metric_idx].begin(),
+                              report.metric_quantiles[metric_idx].end());
+            }
+            for (double value : values) {
+                if (value_idx == m_value_offset.size()) {
+                    throw Exception("PrometheusExporterImp::scrape(): Report has more metrics than at construction",
+                                    GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+                }
+                format_value(value_idx, value);
+                ++value_idx;
+            }
+        }
+        return m_text;
+    }
+
+    static volatile sig_atomic_t g_stop_signal = 0;
+
+    static void stop_handler(int signum)
+    {
+        g_stop_signal = signum;
+    }
+
+    /// Wait until the client socket is ready for the requested events
+    /// or the deadline passes.
+    static bool wait_client(int fd, short events, const geopm_time_s &deadline)
+    {
+        struct pollfd client_poll = {fd, events, 0};
+        int num_ready = 0;
+        do {
+            double wait = -geopm_time_since(&deadline);
+            if (wait <= 0.0) {
+                return false;
+            }
+            num_ready = poll(&client_poll, 1, (int)std::ceil(wait * 1e3));
+        } while (num_ready == -1 && errno == EINTR);
+        return num_ready > 0;
+    }
+
+    /// Write the whole buffer unless the client goes away or the
+    /// deadline passes.
+    static bool send_all(int fd, const char *buf, size_t size, const geopm_time_s &deadline)
+    {
+        while (size != 0) {
+            ssize_t num_sent = send(fd, buf, size, MSG_NOSIGNAL);
+            if (num_sent == -1 && errno == EINTR) {
+                continue;
+            }
+            if (num_sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                if (!wait_client(fd, POLLOUT, deadline)) {
+                    return false;
+                }
+                continue;
+            }
+            if (num_sent <= 0) {
+                return false;
+            }
+            buf += num_sent;
+            size -= num_sent;
+        }
+        return true;
+    }
+
+    void PrometheusExporterImp::respond(int client_fd, const geopm_time_s &deadline)
+    {
+        // The client socket is non-blocking and every wait ends at the
+        // deadline so that a stalled client cannot hold up sampling.
+        char request[4096];
+        size_t request_size = 0;
+        bool is_complete = false;
+        while (!is_complete && request_size < sizeof(request) - 1) {
+            ssize_t num_read = recv(client_fd, request + request_size,
+                                    sizeof(request) - 1 - request_size, 0);
+            if (num_read == -1 && errno == EINTR) {
+                continue;
+            }
+            if (num_read == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                if (!wait_client(client_fd, POLLIN, deadline)) {
+                    return;
+                }
+                continue;
+            }
+            if (num_read <= 0) {
+                break;
+            }
+            request_size += num_read;
+            request[request_size] = '\0';
+            is_complete = std::strstr(request, "\r\n\r\n") != nullptr;
+        }
+        request[request_size] = '\0';
+        char header[256];
+        if (std::strncmp(request, "GET ", 4) == 0) {
+            const std::string &body = scrape();
+            int header_size = snprintf(header, sizeof(header),
+                                       "HTTP/1.1 200 OK\r\n"
+                                       "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                       "Content-Length: %zu\r\n"
+                                       "Connection: close\r\n\r\n", body.size());
+            if (send_all(client_fd, header, header_size, deadline)) {
+                send_all(client_fd, body.data(), body.size(), deadline);
+            }
+        }
+        else {
+            int header_size = snprintf(header, sizeof(header),
+                                       "HTTP/1.1 405 Method Not Allowed\r\n"
+                                       "Allow: GET\r\n"
+                                       "Content-Length: 0\r\n"
+                                       "Connection: close\r\n\r\n");
+            send_all(client_fd, header, header_size, deadline);
+        }
+    }
+
+    void PrometheusExporterImp::run(int listen_fd, double period)
+    {
+        PlatformIO &pio = platform_io();
+        int flags = fcntl(listen_fd, F_GETFL);
+        if (flags == -1 || fcntl(listen_fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+            throw Exception("PrometheusExporterImp::run(): Unable to make the listening socket non-blocking",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        struct pollfd listen_poll = {listen_fd, POLLIN, 0};
+        geopm_time_s next_sample;
+        geopm_time(&next_sample);
+        while (g_stop_signal == 0) {
+            double wait = -geopm_time_since(&next_sample);
+            int timeout_ms = wait > 0.0 ? (int)std::ceil(wait * 1e3) : 0;
+            int num_ready = poll(&listen_poll, 1, timeout_ms);
+            if (num_ready == -1 && errno != EINTR) {
+                throw Exception("PrometheusExporterImp::run(): poll() failed",
+                                errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            if (num_ready > 0 && (listen_poll.revents & POLLIN)) {
+                // Clients may use the time until the next sample, but
+                // no less than M_CLIENT_WAIT_MIN and no more than
+                // M_CLIENT_WAIT_MAX seconds in total.
+                double client_wait = std::min(std::max(-geopm_time_since(&next_sample),
+                                                       M_CLIENT_WAIT_MIN),
+                                              M_CLIENT_WAIT_MAX);
+                geopm_time_s deadline;
+                geopm_time(&deadline);
+                geopm_time_add(&deadline, client_wait, &deadline);
+                int client_fd = -1;
+                while (geopm_time_since(&deadline) < 0.0 &&
+                       (client_fd = accept4(listen_fd, nullptr, nullptr,
+                                            SOCK_CLOEXEC | SOCK_NONBLOCK)) != -1) {
+                    UniqueFd client(client_fd);
+                    respond(client.get(), deadline);
+                }
+            }
+            if (geopm_time_since(&next_sample) >= 0.0) {
+                pio.read_batch();
+                update();
+                geopm_time_add(&next_sample, period, &next_sample);
+                // Do not try to catch up on missed samples
+                if (geopm_time_since(&next_sample) > 0.0) {
+                    geopm_time(&next_sample);
+                }
+            }
+        }
+    }
+
+    static int listen_socket(int port, const std::string &socket_path)
+    {
+        int domain = socket_path.empty() ? AF_INET : AF_UNIX;
+        int listen_fd = socket(domain, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (listen_fd == -1) {
+            throw Exception("PrometheusExporter: socket() failed",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        int err = 0;
+        if (socket_path.empty()) {
+            int enable = 1;
+            setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+            struct sockaddr_in addr = {};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            addr.sin_port = htons(port);
+            err = bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr));
+        }
+        else {
+            struct sockaddr_un addr = {};
+            addr.sun_family = AF_UNIX;
+            if (socket_path.size() >= sizeof(addr.sun_path)) {
+                close(listen_fd);
+                throw Exception("PrometheusExporter: Unix socket path is too long: " + socket_path,
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+            // Remove a socket left behind by a previous instance
+            if (unlink(socket_path.c_str()) != 0 && errno != ENOENT) {
+                err = errno;
+                close(listen_fd);
+                throw Exception("PrometheusExporter: Unable to remove existing Unix socket: " + socket_path,
+                                err, __FILE__, __LINE__);
+            }
+            err = bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr));
+        }
+        if (err == 0) {
+            err = listen(listen_fd, SOMAXCONN);
+        }
+        if (err != 0) {
+            err = errno ? errno : GEOPM_ERROR_RUNTIME;
+            close(listen_fd);
+            throw Exception("PrometheusExporter: Unable to listen on " +
+                            (socket_path.empty() ? "port " + std::to_string(port) : socket_path),
+                            err, __FILE__, __LINE__);
+        }
+        return listen_fd;
+    }
+
+    int PrometheusExporter::main(int argc, char **argv)
+    {
+        const char *usage = "Usage: geopmprometheus [-t PERIOD] [-p PORT | -u SOCKET_PATH]\n"
+                            "                       [-i SIGNAL_CONFIG] [-q QUANTILES]\n"
+                            "\n"
+                            "Prometheus exporter for GEOPM metrics\n"
+                            "\n"
+                            "  -t, --period         Sample period for fast loop in seconds. Default: 0.1\n"
+                            "  -p, --port           Port to publish Prometheus metrics. Default: 8000\n"
+                            "  -u, --unix-socket    Publish on a Unix domain socket instead of a port\n"
+                            "  -i, --signal-config  Input file containing GEOPM signal requests, specify\n"
+                            "                       \"-\" to use standard input. Default: All power,\n"
+                            "                       energy, frequency and temperature signals at the\n"
+                            "                       board domain\n"
+                            "  -q, --quantiles      Comma separated quantiles to publish for each\n"
+                            "                       signal, e.g. 0.5,0.95,0.99. Default: none\n"
+                            "  -v, --version        Print version and exit\n"
+                            "  -h, --help           Print this message and exit\n";
+        static const struct option long_options[] = {
+            {"period", required_argument, nullptr, 't'},
+            {"port", required_argument, nullptr, 'p'},
+            {"unix-socket", required_argument, nullptr, 'u'},
+            {"signal-config", required_argument, nullptr, 'i'},
+            {"quantiles", required_argument, nullptr, 'q'},
+            {"version", no_argument, nullptr, 'v'},
+            {"help", no_argument, nullptr, 'h'},
+            {nullptr, 0, nullptr, 0},
+        };
+        double period = 0.1;
+        int port = 8000;
+        std::string socket_path;
+        std::string config_path;
+        std::string quantiles_str;
+        int opt;
+        while ((opt = getopt_long(argc, argv, "t:p:u:i:q:vh", long_options, nullptr)) != -1) {
+            switch (opt) {
+                case 't':
+                    period = std::atof(optarg);
+                    break;
+                case 'p':
+                    port = std::atoi(optarg);
+                    break;
+                case 'u':
+                    socket_path = optarg;
+                    break;
+                case 'i':
+                    config_path = optarg;
+                    break;
+                case 'q':
+                    quantiles_str = optarg;
+                    break;
+                case 'v':
+                    std::cout << geopm_version() << std::endl;
+                    return 0;
+                case 'h':
+                    std::cout << usage;
+                    return 0;
+                default:
+                    std::cerr << usage;
+                    return -1;
+            }
+        }
+        if (optind != argc || !(period > 0.0) || port <= 0 || port > 65535) {
+            std::cerr << usage;
+            return -1;
+        }
+        try {
+            std::vector<geopm_request_s> requests;
+            if (config_path.empty()) {
+                requests = default_requests();
+            }
+            else if (config_path == "-") {
+                requests = parse_requests(std::cin);
+            }
+            else {
+                std::ifstream config_stream(config_path);
+                if (!config_stream.good()) {
+                    throw Exception("PrometheusExporter::main(): Unable to open signal config: " + config_path,
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                requests = parse_requests(config_stream);
+            }
+            std::vector<double> quantiles;
+            if (!quantiles_str.empty()) {
+                for (const auto &quantile : string_split(quantiles_str, ",")) {
+                    try {
+                        quantiles.push_back(std::stod(quantile));
+                    }
+                    catch (const std::exception &ex) {
+                        throw Exception("PrometheusExporter::main(): Invalid quantile: " + quantile,
+                                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                    }
+                }
+            }
+            auto exporter = make_unique(requests, quantiles);
+            struct sigaction action = {};
+            action.sa_handler = stop_handler;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGINT, &action, nullptr);
+            sigaction(SIGTERM, &action, nullptr);
+            UniqueFd listen_fd(listen_socket(port, socket_path));
+            try {
+                exporter->run(listen_fd.get(), period);
+            }
+            catch (...) {
+                if (!socket_path.empty()) {
+                    unlink(socket_path.c_str());
+                }
+                throw;
+            }
+            if (!socket_path.empty()) {
+                unlink(socket_path.c_str());
+            }
+        }
+        catch (const std::exception &ex) {
+            std::cerr << "Error: <geopmprometheus>: " << ex.what() << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+}
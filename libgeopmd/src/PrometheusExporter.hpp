@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PROMETHEUSEXPORTER_HPP_INCLUDE
+#define PROMETHEUSEXPORTER_HPP_INCLUDE
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm_pio.h"
+#include "geopm_time.h"
+
+namespace geopm
+{
+    class StatsCollector;
+
+    /// @brief Publishes the statistics gathered by a StatsCollector
+    ///        in the Prometheus text exposition format.
+    ///
+    /// Native replacement for the geopmdpy.exporter.PrometheusExporter
+    /// that exposes the same gauges with the same names.  The text
+    /// served to clients is formatted once at construction, and each
+    /// scrape only rewrites the fixed width value fields in place.
+    /// As with the Python exporter, each scrape reports the
+    /// statistics gathered since the previous scrape.
+    class PrometheusExporter
+    {
+        public:
+            PrometheusExporter() = default;
+            virtual ~PrometheusExporter() = default;
+            /// @brief Sample all requested signals and update the
+            ///        statistics.  The caller is expected to have
+            ///        called platform_io().read_batch().
+            virtual void update(void) = 0;
+            /// @brief Update the text with the statistics gathered
+            ///        since the last call and reset them.
+            /// @return Reference to the text, valid until the next
+            ///         call.
+            virtual const std::string &scrape(void) = 0;
+            /// @brief Serve scrapes over a listening socket while
+            ///        sampling with a fixed period.  Returns after
+            ///        geopmprometheus receives SIGINT or SIGTERM, and
+            ///        otherwise only if an error occurs.
+            /// @param [in] listen_fd Bound and listening stream socket.
+            /// @param [in] period Sample period in seconds.
+            virtual void run(int listen_fd, double period) = 0;
+            /// @brief Create an exporter for a set of signal requests.
+            static std::unique_ptr<PrometheusExporter> make_unique(const std::vector<geopm_request_s> &requests);
+            /// @brief Create an exporter that also publishes quantile
+            ///        estimates for each signal, e.g. 0.95 is
+            ///        published as a gauge with the "p95" suffix.
+            static std::unique_ptr<PrometheusExporter> make_unique(const std::vector<geopm_request_s> &requests,
+                                                                   const std::vector<double> &quantiles);
+            /// @brief Parse signal requests in the format accepted by
+            ///        geopmexporter: one "NAME DOMAIN INDEX" per line
+            ///        where INDEX may be "*" to request every domain.
+            static std::vector<geopm_request_s> parse_requests(std::istream &input);
+            /// @brief The board power, energy, frequency and
+            ///        temperature signals that geopmexporter selects
+            ///        by default.
+            static std::vector<geopm_request_s> default_requests(void);
+            /// @brief Name of the gauge for a statistic, matches the
+            ///        name used by geopmexporter.
+            static std::string metric_name(const std::string &stat_name);
+            /// @brief Entry point for the geopmprometheus command.
+            static int main(int argc, char **argv);
+    };
+
+    class PrometheusExporterImp : public PrometheusExporter
+    {
+        public:
+            PrometheusExporterImp(const std::vector<geopm_request_s> &requests,
+                                  const std::vector<double> &quantiles);
+            PrometheusExporterImp(std::shared_ptr<StatsCollector> collector);
+            virtual ~PrometheusExporterImp() = default;
+            void update(void) override;
+            const std::string &scrape(void) override;
+            void run(int listen_fd, double period) override;
+            /// @brief Number of characters reserved for each value.
+            static constexpr int M_VALUE_WIDTH = 24;
+            /// @brief Least time in seconds that clients are given
+            ///        to complete a scrape when a sample is due.
+            static constexpr double M_CLIENT_WAIT_MIN = 0.01;
+            /// @brief Most time in seconds that clients are given
+            ///        to complete a scrape.
+            static constexpr double M_CLIENT_WAIT_MAX = 1.0;
+        private:
+            void append_gauge(const std::string &stat_name);
+            void format_value(size_t value_idx, double value);
+            void respond(int client_fd, const geopm_time_s &deadline);
+            std::shared_ptr<StatsCollector> m_collector;
+            std::string m_text;
+            /// Offset into m_text of each value field
+            std::vector<size_t> m_value_offset;
+    };
+}
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "QuantileSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    QuantileSketch::QuantileSketch()
+        : QuantileSketch(0.01, 2048)
+    {
+
+    }
+
+    QuantileSketch::QuantileSketch(double relative_accuracy, int max_num_bucket)
+        : m_relative_accuracy(relative_accuracy)
+        , m_max_num_bucket(max_num_bucket)
+        , m_gamma((1.0 + relative_accuracy) / (1.0 - relative_accuracy))
+        , m_log_gamma(std::log(m_gamma))
+        , m_positive {0, {}}
+        , m_negative {0, {}}
+        , m_zero_count(0)
+        , m_count(0)
+    {
+        if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+            throw Exception("QuantileSketch::QuantileSketch(): relative_accuracy must be between zero and one: " +
+                            std::to_string(relative_accuracy),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (max_num_bucket <= 0) {
+            throw Exception("QuantileSketch::QuantileSketch(): max_num_bucket must be positive: " +
+                            std::to_string(max_num_bucket),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    int QuantileSketch::bucket_idx(double magnitude) const
+    {
+        return (int)std::ceil(std::log(magnitude) / m_log_gamma);
+    }
+
+    double QuantileSketch::bucket_value(int bucket_idx) const
+    {
+        // Bucket holds values in (gamma^(idx - 1), gamma^idx], the
+        // estimate has the same relative error to both bounds.
+        return 2.0 * std::exp(bucket_idx * m_log_gamma) / (m_gamma + 1.0);
+    }
+
+    void QuantileSketch::add_bucket(m_store_s &store, int bucket_idx, uint64_t num)
+    {
+        if (store.count.empty()) {
+            store.offset = bucket_idx;
+            store.count.push_back(num);
+            return;
+        }
+        int top = store.offset + (int)store.count.size() - 1;
+        int new_top = std::max(top, bucket_idx);
+        int new_bottom = std::max(std::min(store.offset, bucket_idx),
+                                  new_top - m_max_num_bucket + 1);
+        if (new_bottom != store.offset || new_top != top) {
+            // Values below the new range are counted in its lowest
+            // bucket.
+            std::vector<uint64_t> count(new_top - new_bottom + 1, 0);
+            for (size_t ii = 0; ii < store.count.size(); ++ii) {
+                int old_idx = std::max(store.offset + (int)ii, new_bottom);
+                count[old_idx - new_bottom] += store.count[ii];
+            }
+            store.offset = new_bottom;
+            store.count.swap(count);
+        }
+        bucket_idx = std::max(bucket_idx, new_bottom);
+        store.count[bucket_idx - new_bottom] += num;
+    }
+
+    void QuantileSketch::add(double value)
+    {
+        // Infinite values have no bucket
+        if (!std::isfinite(value)) {
+            return;
+        }
+        ++m_count;
+        double magnitude = std::fabs(value);
+        if (magnitude < M_MIN_VALUE) {
+            ++m_zero_count;
+        }
+        else if (value > 0.0) {
+            add_bucket(m_positive, bucket_idx(magnitude), 1);
+        }
+        else {
+            add_bucket(m_negative, bucket_idx(magnitude), 1);
+        }
+    }
+
+    void QuantileSketch::merge(const QuantileSketch &other)
+    {
+        if (other.m_relative_accuracy != m_relative_accuracy ||
+            other.m_max_num_bucket != m_max_num_bucket) {
+            throw Exception("QuantileSketch::merge(): sketches were created with different parameters",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t ii = 0; ii < other.m_positive.count.size(); ++ii) {
+            if (other.m_positive.count[ii] != 0) {
+                add_bucket(m_positive, other.m_positive.offset + (int)ii,
+                           other.m_positive.count[ii]);
+            }
+        }
+        for (size_t ii = 0; ii < other.m_negative.count.size(); ++ii) {
+            if (other.m_negative.count[ii] != 0) {
+                add_bucket(m_negative, other.m_negative.offset + (int)ii,
+                           other.m_negative.count[ii]);
+            }
+        }
+        m_zero_count += other.m_zero_count;
+        m_count += other.m_count;
+    }
+
+    double QuantileSketch::quantile(double quantile) const
+    {
+        if (!(quantile >= 0.0 && quantile <= 1.0)) {
+            throw Exception("QuantileSketch::quantile(): quantile must be between zero and one: " +
+                            std::to_string(quantile),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_count == 0) {
+            return NAN;
+        }
+        double rank = quantile * (m_count - 1);
+        double total = 0.0;
+        // Walk the buckets in order of increasing value
+        for (size_t ii = m_negative.count.size(); ii != 0; --ii) {
+            total += m_negative.count[ii - 1];
+            if (total > rank) {
+                return -bucket_value(m_negative.offset + (int)ii - 1);
+            }
+        }
+        total += m_zero_count;
+        if (total > rank) {
+            return 0.0;
+        }
+        for (size_t ii = 0; ii < m_positive.count.size(); ++ii) {
+            total += m_positive.count[ii];
+            if (total > rank) {
+                return bucket_value(m_positive.offset + (int)ii);
+            }
+        }
+        // Not reached: the total is m_count which is larger than rank
+        return NAN;
+    }
+
+    uint64_t QuantileSketch::count(void) const
+    {
+        return m_count;
+    }
+
+    void QuantileSketch::reset(void)
+    {
+        m_positive.count.clear();
+        m_negative.count.clear();
+        m_zero_count = 0;
+        m_count = 0;
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef QUANTILESKETCH_HPP_INCLUDE
+#define QUANTILESKETCH_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Streaming estimate of the quantiles of a series of
+    ///        values with bounded memory.
+    ///
+    /// Values are counted in buckets whose bounds grow geometrically
+    /// (the DDSketch method), so any quantile is estimated within a
+    /// fixed relative error of a value in the series.  Positive and
+    /// negative values are counted separately and values smaller in
+    /// magnitude than M_MIN_VALUE are counted as zero.  When the
+    /// range of values needs more buckets than the maximum, the
+    /// buckets holding the values smallest in magnitude are combined
+    /// so that accuracy is kept for the largest values.  Two sketches
+    /// with the same parameters can be merged.
+    class QuantileSketch
+    {
+        public:
+            /// @brief Constructor.
+            /// @param [in] relative_accuracy Bound on the relative
+            ///        error of quantile estimates, between zero and
+            ///        one.
+            /// @param [in] max_num_bucket Maximum number of buckets
+            ///        for each of the positive and negative values.
+            QuantileSketch(double relative_accuracy, int max_num_bucket);
+            /// @brief Constructor with one percent relative accuracy
+            ///        and 2048 buckets, enough to span 17 orders of
+            ///        magnitude.
+            QuantileSketch();
+            virtual ~QuantileSketch() = default;
+            /// @brief Count a value, NAN and infinite values are
+            ///        ignored.
+            void add(double value);
+            /// @brief Count all of the values counted by another
+            ///        sketch with the same parameters.
+            void merge(const QuantileSketch &other);
+            /// @brief Estimate a quantile.
+            /// @param [in] quantile Value between zero and one, 0.5
+            ///        estimates the median.
+            /// @return Estimate, or NAN if no values were counted.
+            double quantile(double quantile) const;
+            /// @brief Number of values counted.
+            uint64_t count(void) const;
+            /// @brief Forget all values counted.
+            void reset(void);
+            /// @brief Values with a smaller magnitude are counted as
+            ///        zero.
+            static constexpr double M_MIN_VALUE = 1e-9;
+        private:
+            /// Counts for a contiguous range of bucket indices
+            struct m_store_s {
+                int offset;
+                std::vector<uint64_t> count;
+            };
+            int bucket_idx(double magnitude) const;
+            double bucket_value(int bucket_idx) const;
+            void add_bucket(m_store_s &store, int bucket_idx, uint64_t num);
+            double m_relative_accuracy;
+            int m_max_num_bucket;
+            double m_gamma;
+            double m_log_gamma;
+            m_store_s m_positive;
+            m_store_s m_negative;
+            uint64_t m_zero_count;
+            uint64_t m_count;
+    };
+}
+
+#endif
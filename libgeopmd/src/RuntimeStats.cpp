@@ -5,6 +5,7 @@
 
 #include "RuntimeStats.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 #include "geopm/Exception.hpp"
@@ -13,9 +14,24 @@ namespace geopm
 {
 
     RuntimeStats::RuntimeStats(const std::vector<std::string> &metric_names)
+        : RuntimeStats(metric_names, {})
+    {
+
+    }
+
+    RuntimeStats::RuntimeStats(const std::vector<std::string> &metric_names,
+                               const std::vector<double> &quantiles)
         : m_metric_names(metric_names)
         , m_metric_stats(m_metric_names.size())
+        , m_quantiles(quantiles)
+        , m_sketch(m_quantiles.empty() ? 0 : m_metric_names.size())
     {
+        for (double qq : m_quantiles) {
+            if (!(qq >= 0.0 && qq <= 1.0)) {
+                throw Exception("RuntimeStats::RuntimeStats(): quantile must be between zero and one: " + std::to_string(qq),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
         reset();
     }
 
@@ -114,6 +130,26 @@ namespace geopm
         return result;
     }
 
+    std::vector<double> RuntimeStats::quantiles(void) const
+    {
+        return m_quantiles;
+    }
+
+    double RuntimeStats::quantile(int metric_idx, double quantile) const
+    {
+        check_index(metric_idx, __func__, __LINE__);
+        if (m_sketch.empty()) {
+            throw Exception("RuntimeStats::quantile(): quantiles were not requested at construction",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        double result = m_sketch[metric_idx].quantile(quantile);
+        if (m_metric_stats[metric_idx].count != 0) {
+            result = std::max(result, m_metric_stats[metric_idx].min);
+            result = std::min(result, m_metric_stats[metric_idx].max);
+        }
+        return result;
+    }
+
     void RuntimeStats::reset(void)
     {
         for (auto &it : m_metric_stats) {
@@ -121,6 +157,9 @@ namespace geopm
             it.m_1 = 0.0;
             it.m_2 = 0.0;
         }
+        for (auto &it : m_sketch) {
+            it.reset();
+        }
     }
 
     void RuntimeStats::update(const std::vector<double> &sample)
@@ -152,5 +191,12 @@ namespace geopm
             }
             ++moments_it;
         }
+        if (!m_sketch.empty()) {
+            auto sketch_it = m_sketch.begin();
+            for (const auto &ss : sample) {
+                sketch_it->add(ss);
+                ++sketch_it;
+            }
+        }
     }
 }
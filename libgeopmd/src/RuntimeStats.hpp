@@ -10,6 +10,8 @@
 #include <string>
 #include <cstdint>
 
+#include "QuantileSketch.hpp"
+
 namespace geopm
 {
     /// @brief Class that aggregates statistics without buffered data
@@ -19,6 +21,18 @@ namespace geopm
             RuntimeStats() = delete;
             /// @brief Constructor that records the names of all metrics
             RuntimeStats(const std::vector<std::string> &metric_names);
+            /// @brief Constructor that also estimates quantiles of
+            ///        each metric
+            ///
+            /// A QuantileSketch is kept for each metric, so memory use
+            /// does not grow with the number of samples.
+            ///
+            /// @param [in] metric_names Name of each metric
+            ///
+            /// @param [in] quantiles Values between zero and one that
+            ///             are reported for each metric, e.g. 0.95
+            RuntimeStats(const std::vector<std::string> &metric_names,
+                         const std::vector<double> &quantiles);
             /// @brief Default virtual destructor
             virtual ~RuntimeStats() = default;
             /// @brief Number of metrics aggregated
@@ -81,6 +95,25 @@ namespace geopm
             ///
             /// @return Standard deviation estimate of metric
             double std(int metric_idx) const;
+            /// @brief Quantiles specified at construction
+            ///
+            /// @return Values between zero and one, empty if
+            ///         quantiles are not estimated
+            std::vector<double> quantiles(void) const;
+            /// @brief Estimate of a quantile
+            ///
+            /// The estimate is within one percent of a sampled value
+            /// and bounded by the minimum and maximum.
+            ///
+            /// @param [in] metric_idx Index of the metric as specified at
+            ///             construction
+            ///
+            /// @param [in] quantile Value between zero and one, need
+            ///             not be one of the quantiles specified at
+            ///             construction
+            ///
+            /// @return Estimate of the quantile of metric
+            double quantile(int metric_idx, double quantile) const;
             /// @brief Reset all aggregated statistics
             void reset(void);
             /// @brief Update statistics with new sample
@@ -104,6 +137,9 @@ namespace geopm
             };
             const std::vector<std::string> m_metric_names;
             std::vector<stats_s> m_metric_stats;
+            const std::vector<double> m_quantiles;
+            /// One for each metric if quantiles are estimated
+            std::vector<QuantileSketch> m_sketch;
     };
 }
 
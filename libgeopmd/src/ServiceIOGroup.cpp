@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <iostream>
 #include <unistd.h>
 #include "geopm/Agg.hpp"
 #include "geopm/ServiceProxy.hpp"
@@ -25,7 +26,8 @@ namespace geopm
     ServiceIOGroup::ServiceIOGroup()
         : ServiceIOGroup(platform_topo(),
                          ServiceProxy::make_unique(),
-                         nullptr)
+                         nullptr,
+                         stream_period_env())
     {
 
     }
@@ -33,6 +35,16 @@ namespace geopm
     ServiceIOGroup::ServiceIOGroup(const PlatformTopo &platform_topo,
                                    std::shared_ptr<ServiceProxy> service_proxy,
                                    std::shared_ptr<BatchClient> batch_client_mock)
+        : ServiceIOGroup(platform_topo, std::move(service_proxy),
+                         std::move(batch_client_mock), 0.0)
+    {
+
+    }
+
+    ServiceIOGroup::ServiceIOGroup(const PlatformTopo &platform_topo,
+                                   std::shared_ptr<ServiceProxy> service_proxy,
+                                   std::shared_ptr<BatchClient> batch_client_mock,
+                                   double stream_period)
         : m_platform_topo(platform_topo)
         , m_service_proxy(std::move(service_proxy))
         , m_signal_info(service_signal_info(m_service_proxy))
@@ -40,6 +52,7 @@ namespace geopm
         , m_batch_client(std::move(batch_client_mock))
         , m_session_pid(-1)
         , m_is_batch_active(false)
+        , m_stream_period(stream_period)
     {
         m_session_pid = getpid();
         m_service_proxy->platform_open_session();
@@ -205,7 +218,12 @@ namespace geopm
         init_batch_server();
         if (m_is_batch_active &&
             m_signal_requests.size() != 0) {
-            m_batch_samples = m_batch_client->read_batch();
+            if (m_stream_period > 0.0) {
+                m_batch_client->read_stream(m_batch_samples);
+            }
+            else {
+                m_batch_samples = m_batch_client->read_batch();
+            }
         }
     }
 
@@ -388,9 +406,33 @@ namespace geopm
             }
             m_is_batch_active = true;
             m_batch_settings.resize(m_control_requests.size(), NAN);
+            if (m_stream_period > 0.0 &&
+                m_signal_requests.size() != 0) {
+                m_batch_client->start_stream(m_stream_period);
+            }
         }
     }
 
+    double ServiceIOGroup::stream_period_env(void)
+    {
+        double result = 0.0;
+        std::string env_str = geopm::get_env("GEOPM_BATCH_STREAM_PERIOD");
+        if (!env_str.empty()) {
+            try {
+                result = std::stod(env_str);
+            }
+            catch (const std::exception &ex) {
+                result = -1.0;
+            }
+            if (!(result >= 0.0)) {
+                std::cerr << "Warning: <geopm> Invalid value for GEOPM_BATCH_STREAM_PERIOD: \""
+                          << env_str << "\", batch server will not stream samples." << std::endl;
+                result = 0.0;
+            }
+        }
+        return result;
+    }
+
     std::string ServiceIOGroup::strip_plugin_name(const std::string &name)
     {
         static const std::string key = M_PLUGIN_NAME + "::";
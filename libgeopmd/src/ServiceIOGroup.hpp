@@ -30,6 +30,15 @@ namespace geopm
             ServiceIOGroup(const PlatformTopo &platform_topo,
                            std::shared_ptr<ServiceProxy> service_proxy,
                            std::shared_ptr<BatchClient> batch_client_mock);
+            /// @param [in] stream_period If positive, the batch server
+            ///        samples all pushed signals with this period in
+            ///        seconds and read_batch() returns the latest
+            ///        published sample without a round trip to the
+            ///        batch server.
+            ServiceIOGroup(const PlatformTopo &platform_topo,
+                           std::shared_ptr<ServiceProxy> service_proxy,
+                           std::shared_ptr<BatchClient> batch_client_mock,
+                           double stream_period);
             ServiceIOGroup(const ServiceIOGroup &other) = delete;
             ServiceIOGroup &operator=(const ServiceIOGroup &other) = delete;
             virtual ~ServiceIOGroup();
@@ -80,6 +89,9 @@ namespace geopm
             static std::map<std::string, signal_info_s> service_signal_info(std::shared_ptr<ServiceProxy> service_proxy);
             static std::map<std::string, control_info_s> service_control_info(std::shared_ptr<ServiceProxy> service_proxy);
             static std::string strip_plugin_name(const std::string &name);
+            /// @brief Parse the GEOPM_BATCH_STREAM_PERIOD environment
+            ///        variable.  Returns zero if unset or invalid.
+            static double stream_period_env(void);
             const PlatformTopo &m_platform_topo;
             std::shared_ptr<ServiceProxy> m_service_proxy;
             std::map<std::string, signal_info_s> m_signal_info;
@@ -91,6 +103,7 @@ namespace geopm
             std::vector<double> m_batch_settings;
             int m_session_pid;
             bool m_is_batch_active;
+            const double m_stream_period;
     };
 }
 
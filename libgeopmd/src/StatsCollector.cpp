@@ -7,6 +7,7 @@
 
 #include "geopm_stats_collector.h"
 
+#include <algorithm>
 #include <sstream>
 #include <cmath>
 #include <cstring>
@@ -26,6 +27,19 @@ namespace geopm
         return std::make_unique<StatsCollectorImp>(requests);
     }
 
+    std::unique_ptr<StatsCollector> StatsCollector::make_unique(const std::vector<geopm_request_s> &requests,
+                                                                const std::vector<double> &quantiles)
+    {
+        return std::make_unique<StatsCollectorImp>(requests, quantiles);
+    }
+
+    std::string StatsCollector::quantile_name(double quantile)
+    {
+        std::ostringstream result;
+        result << "p" << quantile * 100;
+        return result.str();
+    }
+
     StatsCollectorImp::StatsCollectorImp()
         : StatsCollectorImp(std::vector<geopm_request_s> {})
     {
@@ -38,9 +52,23 @@ namespace geopm
 
     }
 
+    StatsCollectorImp::StatsCollectorImp(const std::vector<geopm_request_s> &requests,
+                                         const std::vector<double> &quantiles)
+        : StatsCollectorImp(requests, platform_io(), quantiles)
+    {
+
+    }
+
     StatsCollectorImp::StatsCollectorImp(const std::vector<geopm_request_s> &requests, PlatformIO &pio)
+        : StatsCollectorImp(requests, pio, {})
+    {
+
+    }
+
+    StatsCollectorImp::StatsCollectorImp(const std::vector<geopm_request_s> &requests, PlatformIO &pio,
+                                         const std::vector<double> &quantiles)
         : m_pio(pio)
-        , m_stats(std::make_shared<RuntimeStats>(register_requests(requests)))
+        , m_stats(std::make_shared<RuntimeStats>(register_requests(requests), quantiles))
         , m_time_pio_idx(m_pio.push_signal("TIME", GEOPM_DOMAIN_BOARD, 0))
         , m_update_count(0)
         , m_time_sample(0.0)
@@ -49,7 +77,7 @@ namespace geopm
         , m_time_begin(0.0)
         , m_is_cached(false)
     {
-
+        m_sample.resize(m_pio_idx.size(), 0.0);
     }
 
     std::vector<std::string> StatsCollectorImp::register_requests(const std::vector<geopm_request_s> &requests)
@@ -95,13 +123,12 @@ namespace geopm
             m_time_delta_m_1 += time_delta;
             m_time_delta_m_2 += time_delta * time_delta;
         }
-        std::vector<double> sample(m_pio_idx.size(), 0.0);
-        auto sample_it = sample.begin();
+        auto sample_it = m_sample.begin();
         for (auto pio_idx : m_pio_idx) {
             *sample_it = m_pio.sample(pio_idx);
             ++sample_it;
         }
-        m_stats->update(sample);
+        m_stats->update(m_sample);
     }
 
     std::string StatsCollectorImp::report_yaml(void) const
@@ -147,6 +174,8 @@ namespace geopm
             },
             m_metric_names,
             std::vector<std::array<double, GEOPM_NUM_METRIC_STATS> > {},
+            m_stats->quantiles(),
+            std::vector<std::vector<double> > {},
         };
         result.metric_stats.reserve(m_metric_names.size());
         size_t num_metric = m_metric_names.size();
@@ -161,6 +190,17 @@ namespace geopm
                 m_stats->std(metric_idx),
             });
         }
+        if (!result.quantiles.empty()) {
+            result.metric_quantiles.reserve(num_metric);
+            for (size_t metric_idx = 0; metric_idx < num_metric; ++metric_idx) {
+                std::vector<double> metric_quantile;
+                metric_quantile.reserve(result.quantiles.size());
+                for (double quantile : result.quantiles) {
+                    metric_quantile.push_back(m_stats->quantile(metric_idx, quantile));
+                }
+                result.metric_quantiles.push_back(std::move(metric_quantile));
+            }
+        }
         return result;
     }
 
@@ -185,6 +225,10 @@ namespace geopm
             result << "    " << "max: " << m_stats->max(metric_idx) << "\n";
             result << "    " << "mean: " << m_stats->mean(metric_idx) << "\n";
             result << "    " << "std: " << m_stats->std(metric_idx) << "\n";
+            for (double quantile : report.quantiles) {
+                result << "    " << quantile_name(quantile) << ": "
+                       << m_stats->quantile(metric_idx, quantile) << "\n";
+            }
             ++metric_idx;
         }
         return result.str();
@@ -223,6 +267,23 @@ int geopm_stats_collector_create(size_t num_requests, const struct geopm_request
     return err;
 }
 
+int geopm_stats_collector_create_quantile(size_t num_requests, const struct geopm_request_s *requests,
+                                          size_t num_quantile, const double *quantiles,
+                                          struct geopm_stats_collector_s **collector)
+{
+    int err = 0;
+    try {
+        std::vector<geopm_request_s> request_vec(requests, requests + num_requests);
+        std::vector<double> quantile_vec(quantiles, quantiles + num_quantile);
+        auto result = geopm::StatsCollector::make_unique(request_vec, quantile_vec);
+        *collector = reinterpret_cast<geopm_stats_collector_s *>(result.release());
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception());
+    }
+    return err;
+}
+
 int geopm_stats_collector_update(struct geopm_stats_collector_s *collector)
 {
     int err = 0;
@@ -323,6 +384,35 @@ int geopm_stats_collector_report(const struct geopm_stats_collector_s *collector
     return err;
 }
 
+int geopm_stats_collector_report_quantile(const struct geopm_stats_collector_s *collector,
+                                          size_t num_requests, size_t num_quantile,
+                                          double *quantile_values)
+{
+    int err = 0;
+    try {
+        const geopm::StatsCollector *collector_cpp = reinterpret_cast<const geopm::StatsCollector *>(collector);
+        geopm::StatsCollector::report_s report_cpp = collector_cpp->report_struct();
+        if (report_cpp.metric_names.size() > num_requests) {
+            throw geopm::Exception("geopm_stats_collector_report_quantile(): Report memory allocation is insufficient, num_request provided: " +
+                                   std::to_string(num_requests) + " required: " + std::to_string(report_cpp.metric_names.size()),
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (report_cpp.quantiles.size() != num_quantile) {
+            throw geopm::Exception("geopm_stats_collector_report_quantile(): num_quantile provided: " +
+                                   std::to_string(num_quantile) + " does not match the number requested at creation: " +
+                                   std::to_string(report_cpp.quantiles.size()),
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (const auto &metric_quantile : report_cpp.metric_quantiles) {
+            std::copy(metric_quantile.begin(), metric_quantile.end(), quantile_values);
+            quantile_values += num_quantile;
+        }
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception());
+    }
+    return err;
+}
 
 int geopm_stats_collector_reset(struct geopm_stats_collector_s *collector)
 {
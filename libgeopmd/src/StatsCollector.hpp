@@ -28,6 +28,10 @@ namespace geopm
                 std::array<double, GEOPM_NUM_SAMPLE_STATS> sample_stats;
                 std::vector<std::string> metric_names;
                 std::vector<std::array<double, GEOPM_NUM_METRIC_STATS> > metric_stats;
+                /// Quantiles estimated for each metric, may be empty
+                std::vector<double> quantiles;
+                /// Estimate of each quantile for each metric
+                std::vector<std::vector<double> > metric_quantiles;
             };
 
             /// @brief Factory access method
@@ -40,6 +44,24 @@ namespace geopm
             ///
             /// @return Unique pointer to StatCollector object
             static std::unique_ptr<StatsCollector> make_unique(const std::vector<geopm_request_s> &requests);
+            /// @brief Factory access method that also estimates
+            ///        quantiles of each signal
+            ///
+            /// @param [in] requests All signals for monitoring and reporting
+            ///
+            /// @param [in] quantiles Values between zero and one,
+            ///        e.g. 0.95, reported for each signal
+            ///
+            /// @return Unique pointer to StatCollector object
+            static std::unique_ptr<StatsCollector> make_unique(const std::vector<geopm_request_s> &requests,
+                                                               const std::vector<double> &quantiles);
+            /// @brief Name of a quantile in reports
+            ///
+            /// @param [in] quantile Value between zero and one
+            ///
+            /// @return The percentile prefixed with "p", e.g. "p95"
+            ///         for 0.95
+            static std::string quantile_name(double quantile);
             /// @brief Default null constructor without requests
             StatsCollector() = default;
             /// @brief Default destructor
@@ -92,8 +114,19 @@ namespace geopm
             ///
             /// @param [in] requests All signals for monitoring and reporting
             StatsCollectorImp(const std::vector<geopm_request_s> &requests);
+            /// @brief Constructor that also estimates quantiles
+            ///
+            /// @param [in] requests All signals for monitoring and reporting
+            ///
+            /// @param [in] quantiles Values between zero and one
+            ///        reported for each signal
+            StatsCollectorImp(const std::vector<geopm_request_s> &requests,
+                              const std::vector<double> &quantiles);
             /// @brief Test constructor used to mock PlatformIO
             StatsCollectorImp(const std::vector<geopm_request_s> &requests, PlatformIO &pio);
+            /// @brief Test constructor used to mock PlatformIO
+            StatsCollectorImp(const std::vector<geopm_request_s> &requests, PlatformIO &pio,
+                              const std::vector<double> &quantiles);
             /// @brief Default destructor
             ~StatsCollectorImp() = default;
             void update(void) override;
@@ -107,6 +140,7 @@ namespace geopm
             PlatformIO &m_pio;
             std::vector<std::string> m_metric_names;
             std::vector<int> m_pio_idx;
+            std::vector<double> m_sample; // Reused by update() to avoid allocation
             std::shared_ptr<RuntimeStats> m_stats;
             int m_time_pio_idx;
             size_t m_update_count; // Number of times update() has been called
@@ -6,6 +6,10 @@
 
 #include "SysfsDriver.hpp"
 
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
 #include "geopm/json11.hpp"
 
 #include "geopm/Agg.hpp"
@@ -111,4 +115,16 @@ namespace geopm
         }
         return result;
     }
+
+    double SysfsDriver::parse_integer(const char *content, double scaling_factor)
+    {
+        double result = NAN;
+        char *end = nullptr;
+        errno = 0;
+        long long value = std::strtoll(content, &end, 10);
+        if (end != content && errno != ERANGE) {
+            result = value * scaling_factor;
+        }
+        return result;
+    }
 }
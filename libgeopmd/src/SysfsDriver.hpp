@@ -65,13 +65,14 @@ namespace geopm
             /// This parsing includes the conversion of the numerical
             /// data into SI units.
             ///
-            /// @param [in] properties_id The unique identifier of the signal.
-            ///
-            /// @param [in] content The string content read from the
-            ///        sysfs file.
+            /// @param [in] signal_name The name of the signal.
             ///
-            /// @return The parsed signal value in SI units.
-            virtual std::function<double(const std::string&)> signal_parse(const std::string &signal_name) const = 0;
+            /// @return Function that is passed the null terminated
+            ///         content read from the sysfs file and returns
+            ///         the parsed signal value in SI units.  The
+            ///         function does not allocate memory so it may be
+            ///         called for every sample.
+            virtual std::function<double(const char *)> signal_parse(const std::string &signal_name) const = 0;
             /// @brief Get a function to convert a control into a sysfs string
             ///
             /// Converts from the SI unit control into the text
@@ -88,6 +89,21 @@ namespace geopm
             /// Query the meta data about a signal or control
             virtual std::map<std::string, SysfsDriver::properties_s> properties(void) const = 0;
             static std::map<std::string, SysfsDriver::properties_s> parse_properties_json(const std::string &iogroup_name, const std::string &properties_json);
+            /// @brief Parse the integer at the start of sysfs file
+            ///        content in place and scale it.
+            ///
+            /// Leading white space is skipped and anything after the
+            /// digits (e.g. a trailing newline) is ignored.
+            ///
+            /// @param [in] content Null terminated sysfs file content.
+            ///
+            /// @param [in] scaling_factor Factor to convert the
+            ///        integer into SI units.
+            ///
+            /// @return The scaled value, or NAN if the content does
+            ///         not begin with an integer or the integer is out
+            ///         of range.
+            static double parse_integer(const char *content, double scaling_factor);
     };
 }
 
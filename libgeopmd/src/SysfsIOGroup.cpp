@@ -48,22 +48,20 @@ namespace geopm
         return fd;
     }
 
-    // Read a double from a cpufreq resource's opened sysfs attribute file.
-    static std::string read_resource_attribute_fd(int fd)
+    // Read the content of a cpufreq resource's opened sysfs attribute
+    // file into a null terminated buffer.
+    static void read_resource_attribute_fd(int fd, char *buf, size_t size)
     {
-        char buf[SysfsDriver::M_IO_BUFFER_SIZE] = {0};
-        int read_bytes = read(fd, buf, sizeof buf - 1);
+        int read_bytes = pread(fd, buf, size, 0);
         if (read_bytes < 0) {
             throw geopm::Exception("SysfsIOGroup failed to read signal",
                                    errno, __FILE__, __LINE__);
         }
-        if (static_cast<size_t>(read_bytes) >= sizeof buf) {
+        if (static_cast<size_t>(read_bytes) >= size) {
             throw geopm::Exception("SysfsIOGroup truncated read signal",
                                    GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
         }
         buf[read_bytes] = '\0';
-
-        return std::string(buf);
     }
 
     // Write a double to a cpufreq resource's opened sysfs attribute file.
@@ -343,7 +341,7 @@ namespace geopm
             for (auto &info : m_pushed_info_signal) {
                 if (*info.last_io_return < 0) {
                     throw geopm::Exception("SysfsIOGroup failed to read signal",
-                                           errno, __FILE__, __LINE__);
+                                           -*info.last_io_return, __FILE__, __LINE__);
                 }
                 size_t bytes_read = static_cast<size_t>(*info.last_io_return);
                 if (bytes_read >= info.buf.size()) {
@@ -352,7 +350,7 @@ namespace geopm
                 }
                 info.buf[bytes_read] = '\0';
 
-                info.value = info.parse(std::string(info.buf.data()));
+                info.value = info.parse(info.buf.data());
             }
         }
     }
@@ -384,7 +382,7 @@ namespace geopm
                     if (*info.last_io_return < 0) {
                         throw geopm::Exception("SysfsIOGroup failed to write control \"" +
                                                info.name + "\"",
-                                               errno, __FILE__, __LINE__);
+                                               -*info.last_io_return, __FILE__, __LINE__);
                     }
                 }
             }
@@ -422,7 +420,9 @@ namespace geopm
     {
         std::string cname = check_request(__func__, signal_name, "", domain_type, domain_idx);
         UniqueFd fd = open_resource_attribute(m_driver->attribute_path(cname, domain_idx), false);
-        double read_value = m_driver->signal_parse(cname)(read_resource_attribute_fd(fd.get()));
+        char buf[SysfsDriver::M_IO_BUFFER_SIZE];
+        read_resource_attribute_fd(fd.get(), buf, sizeof buf);
+        double read_value = m_driver->signal_parse(cname)(buf);
         return read_value;
     }
 
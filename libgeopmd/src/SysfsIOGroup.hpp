@@ -87,7 +87,7 @@ namespace geopm
                 bool do_write;
                 std::shared_ptr<int> last_io_return;
                 std::array<char, SysfsDriver::M_IO_BUFFER_SIZE> buf;
-                std::function<double(const std::string&)> parse;
+                std::function<double(const char *)> parse;
                 std::function<std::string(double)> gen;
             };
 
@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config.h"
+#include "PrometheusExporter.hpp"
+
+int main(int argc, char **argv)
+{
+    return geopm::PrometheusExporter::main(argc, argv);
+}
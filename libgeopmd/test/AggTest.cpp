@@ -76,6 +76,46 @@ TEST(AggTest, agg_function)
               Agg::region_hint({5, 5, 5, NAN}));
 }
 
+TEST(AggTest, aggregate)
+{
+    // Cover the vector lanes, the remainder and NAN in both
+    std::vector<double> data;
+    for (int idx = 0; idx < 37; ++idx) {
+        data.push_back(idx % 5 == 3 ? NAN : (idx * 7) % 11 - 3.5);
+    }
+    for (int agg_type = 0; agg_type < Agg::M_NUM_TYPE; ++agg_type) {
+        auto func = Agg::type_to_function(agg_type);
+        for (size_t num_op : {0, 1, 2, 8, 9, 16, 37}) {
+            std::vector<double> operand(data.begin(), data.begin() + num_op);
+            double expect = func(operand);
+            double actual = Agg::aggregate(agg_type, operand.data(), operand.size());
+            if (std::isnan(expect)) {
+                EXPECT_TRUE(std::isnan(actual)) << Agg::type_to_name(agg_type) << " " << num_op;
+            }
+            else {
+                EXPECT_DOUBLE_EQ(expect, actual) << Agg::type_to_name(agg_type) << " " << num_op;
+            }
+        }
+    }
+    std::vector<double> expect_nan {NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN, NAN};
+    EXPECT_TRUE(std::isnan(Agg::aggregate(Agg::M_SUM, expect_nan.data(), expect_nan.size())));
+    EXPECT_TRUE(std::isnan(Agg::aggregate(Agg::M_MIN, expect_nan.data(), expect_nan.size())));
+    EXPECT_TRUE(std::isnan(Agg::aggregate(Agg::M_MAX, expect_nan.data(), expect_nan.size())));
+    std::vector<double> infinite {1.0, -INFINITY, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, INFINITY};
+    EXPECT_EQ(-INFINITY, Agg::aggregate(Agg::M_MIN, infinite.data(), infinite.size()));
+    EXPECT_EQ(INFINITY, Agg::aggregate(Agg::M_MAX, infinite.data(), infinite.size()));
+    std::vector<double> large(448, 2.5);
+    large[100] = NAN;
+    large[200] = -1.0;
+    large[300] = 9.0;
+    EXPECT_DOUBLE_EQ(447 * 2.5 - 3.5 + 6.5, Agg::aggregate(Agg::M_SUM, large.data(), large.size()));
+    EXPECT_DOUBLE_EQ(-1.0, Agg::aggregate(Agg::M_MIN, large.data(), large.size()));
+    EXPECT_DOUBLE_EQ(9.0, Agg::aggregate(Agg::M_MAX, large.data(), large.size()));
+    EXPECT_DOUBLE_EQ(2.5, Agg::aggregate(Agg::M_MEDIAN, large.data(), large.size()));
+    GEOPM_EXPECT_THROW_MESSAGE(Agg::aggregate(Agg::M_NUM_TYPE, large.data(), large.size()),
+                               GEOPM_ERROR_INVALID, "agg_type out of range");
+}
+
 TEST(AggTest, function_strings)
 {
     EXPECT_TRUE(is_agg_sum(Agg::name_to_function("sum")));
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "BatchCache.hpp"
+#include "geopm_topo.h"
+#include "MockSharedMemory.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_test.hpp"
+
+using geopm::BatchCacheImp;
+
+class BatchCacheTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void) override;
+        geopm_request_s request(const std::string &name, int domain_type, int domain_idx);
+        const int M_NUM_ENTRY = 8;
+        std::shared_ptr<MockSharedMemory> m_shmem;
+        std::unique_ptr<BatchCacheImp> m_server_a;
+        std::unique_ptr<BatchCacheImp> m_server_b;
+};
+
+void BatchCacheTest::SetUp(void)
+{
+    m_shmem = std::make_shared<MockSharedMemory>(BatchCacheImp::buffer_size(M_NUM_ENTRY));
+    m_server_a = geopm::make_unique<BatchCacheImp>(m_shmem, M_NUM_ENTRY);
+    m_server_b = geopm::make_unique<BatchCacheImp>(m_shmem, M_NUM_ENTRY);
+}
+
+geopm_request_s BatchCacheTest::request(const std::string &name, int domain_type, int domain_idx)
+{
+    geopm_request_s result = {domain_type, domain_idx, {}};
+    std::strncpy(result.name, name.c_str(), sizeof(result.name) - 1);
+    return result;
+}
+
+TEST_F(BatchCacheTest, entry_idx)
+{
+    int power_board = m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_BOARD, 0));
+    int power_pkg_0 = m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_PACKAGE, 0));
+    int power_pkg_1 = m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_PACKAGE, 1));
+    int freq_board = m_server_a->entry_idx(request("CPU_FREQUENCY_STATUS", GEOPM_DOMAIN_BOARD, 0));
+    std::vector<int> entry = {power_board, power_pkg_0, power_pkg_1, freq_board};
+    for (auto idx : entry) {
+        EXPECT_LE(0, idx);
+        EXPECT_GT(M_NUM_ENTRY, idx);
+    }
+    // Each request has its own entry
+    std::sort(entry.begin(), entry.end());
+    EXPECT_EQ(entry.end(), std::adjacent_find(entry.begin(), entry.end()));
+    // The same request finds the same entry from another server
+    EXPECT_EQ(power_board, m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_BOARD, 0)));
+    EXPECT_EQ(power_pkg_1, m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_PACKAGE, 1)));
+    EXPECT_EQ(freq_board, m_server_b->entry_idx(request("CPU_FREQUENCY_STATUS", GEOPM_DOMAIN_BOARD, 0)));
+}
+
+TEST_F(BatchCacheTest, table_full)
+{
+    for (int domain_idx = 0; domain_idx < M_NUM_ENTRY; ++domain_idx) {
+        EXPECT_LE(0, m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, domain_idx)));
+    }
+    EXPECT_EQ(-1, m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, M_NUM_ENTRY)));
+    EXPECT_LE(0, m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, 0)));
+}
+
+TEST_F(BatchCacheTest, reuse_stale)
+{
+    // Entries are reused as soon as the table is full
+    auto server_c = geopm::make_unique<BatchCacheImp>(m_shmem, M_NUM_ENTRY, 0.0);
+    std::vector<int> entry_a;
+    for (int domain_idx = 0; domain_idx < M_NUM_ENTRY; ++domain_idx) {
+        entry_a.push_back(m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, domain_idx)));
+        EXPECT_LE(0, entry_a.back());
+    }
+    m_server_a->publish(entry_a, 10.0, std::vector<double>(M_NUM_ENTRY, 1.0));
+    // Existing entries are found rather than reused
+    EXPECT_EQ(entry_a[0], server_c->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, 0)));
+    int entry_c = server_c->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, M_NUM_ENTRY));
+    ASSERT_LE(0, entry_c);
+    EXPECT_NE(entry_a.end(), std::find(entry_a.begin(), entry_a.end(), entry_c));
+    // A server holding the reused index no longer finds or updates it
+    std::vector<double> sample;
+    EXPECT_FALSE(m_server_a->lookup({entry_c}, 0.0, sample));
+    m_server_a->publish({entry_c}, 20.0, {2.0});
+    EXPECT_FALSE(server_c->lookup({entry_c}, 0.0, sample));
+    server_c->publish({entry_c}, 30.0, {3.0});
+    EXPECT_TRUE(server_c->lookup({entry_c}, 30.0, sample));
+    EXPECT_EQ(std::vector<double>{3.0}, sample);
+    EXPECT_FALSE(m_server_a->lookup({entry_c}, 0.0, sample));
+    // Recently inserted entries are not reused with the default age
+    EXPECT_EQ(-1, m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_CORE, M_NUM_ENTRY + 1)));
+}
+
+TEST_F(BatchCacheTest, publish_lookup)
+{
+    std::vector<int> entry_a = {m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_BOARD, 0)),
+                                m_server_a->entry_idx(request("GPU_POWER", GEOPM_DOMAIN_BOARD, 0))};
+    std::vector<int> entry_b = {m_server_b->entry_idx(request("GPU_POWER", GEOPM_DOMAIN_BOARD, 0))};
+    std::vector<double> sample;
+    // Nothing has been published yet
+    EXPECT_FALSE(m_server_b->lookup(entry_b, 0.0, sample));
+
+    m_server_a->publish(entry_a, 10.0, {100.0, 200.0});
+    EXPECT_TRUE(m_server_b->lookup(entry_b, 9.5, sample));
+    EXPECT_EQ(std::vector<double>{200.0}, sample);
+    // Sample is too old
+    EXPECT_FALSE(m_server_b->lookup(entry_b, 10.5, sample));
+
+    // An older sample does not replace a newer one
+    m_server_b->publish(entry_b, 9.0, {150.0});
+    EXPECT_TRUE(m_server_a->lookup(entry_a, 10.0, sample));
+    EXPECT_EQ((std::vector<double>{100.0, 200.0}), sample);
+    m_server_b->publish(entry_b, 11.0, {250.0});
+    EXPECT_FALSE(m_server_a->lookup(entry_a, 10.5, sample));
+    EXPECT_TRUE(m_server_a->lookup(entry_a, 10.0, sample));
+    EXPECT_EQ((std::vector<double>{100.0, 250.0}), sample);
+}
+
+TEST_F(BatchCacheTest, unshared_entry)
+{
+    std::vector<int> entry = {m_server_a->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_BOARD, 0)),
+                              -1};
+    std::vector<double> sample;
+    m_server_a->publish(entry, 10.0, {100.0, 200.0});
+    entry[0] = m_server_b->entry_idx(request("CPU_POWER", GEOPM_DOMAIN_BOARD, 0));
+    // An unshared signal requires a read by the server
+    EXPECT_FALSE(m_server_b->lookup(entry, 0.0, sample));
+    entry.pop_back();
+    EXPECT_TRUE(m_server_b->lookup(entry, 0.0, sample));
+    EXPECT_EQ(std::vector<double>{100.0}, sample);
+}
+
+TEST_F(BatchCacheTest, invalid)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(BatchCacheImp(m_shmem, M_NUM_ENTRY + 1),
+                               GEOPM_ERROR_INVALID, "shared memory is too small");
+    GEOPM_EXPECT_THROW_MESSAGE(m_server_a->publish({0}, 0.0, {1.0, 2.0}),
+                               GEOPM_ERROR_INVALID, "sample size does not match");
+}
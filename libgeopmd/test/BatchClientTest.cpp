@@ -7,6 +7,8 @@
 #include <cerrno>
 
 #include "BatchClient.hpp"
+#include "BatchRing.hpp"
+#include "BatchServer.hpp"
 #include "BatchStatus.hpp"
 #include "MockBatchStatus.hpp"
 #include "MockSharedMemory.hpp"
@@ -19,6 +21,8 @@ using testing::_;
 using geopm::BatchClient;
 using geopm::BatchClientImp;
 using geopm::BatchStatus;
+using geopm::BatchRing;
+using geopm::BatchServer;
 
 
 class BatchClientTest : public ::testing::Test
@@ -145,3 +149,63 @@ TEST_F(BatchClientTest, stop_batch)
 
     m_batch_client->stop_batch();
 }
+
+TEST_F(BatchClientTest, stream)
+{
+    int num_signal = 2;
+    size_t offset = BatchServer::signal_ring_offset(num_signal);
+    size_t ring_size = BatchRing::buffer_size(num_signal, 4);
+    auto signal_shmem = std::make_shared<MockSharedMemory>(offset + ring_size);
+    char *ring_buffer = (char *)signal_shmem->pointer() + offset;
+    BatchRing::init(ring_buffer, ring_size, num_signal, 4);
+    BatchRing server_ring(ring_buffer, ring_size, num_signal);
+    auto batch_client = std::make_shared<BatchClientImp>(num_signal, 0,
+                                                         m_batch_status,
+                                                         signal_shmem,
+                                                         nullptr);
+    std::vector<double> sample;
+    GEOPM_EXPECT_THROW_MESSAGE(batch_client->read_stream(sample),
+                               GEOPM_ERROR_RUNTIME, "called prior to start_stream()");
+    GEOPM_EXPECT_THROW_MESSAGE(batch_client->start_stream(0.0),
+                               GEOPM_ERROR_INVALID, "period must be positive");
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_STREAM))
+            .WillOnce([&server_ring](char msg) {
+                // Server reads the period and publishes first sample
+                EXPECT_EQ(0.005, server_ring.period());
+                server_ring.publish(1.0, {12.34, 56.78});
+            });
+        EXPECT_CALL(*m_batch_status, receive_message(BatchStatus::M_MESSAGE_CONTINUE));
+    }
+    batch_client->start_stream(0.005);
+
+    // No messages are sent to read samples while streaming
+    std::vector<double> expect = {12.34, 56.78};
+    EXPECT_EQ(expect, batch_client->read_batch());
+    EXPECT_EQ(1.0, batch_client->read_stream(sample));
+    EXPECT_EQ(expect, sample);
+    server_ring.publish(2.0, {1.0, 2.0});
+    expect = {1.0, 2.0};
+    EXPECT_EQ(2.0, batch_client->read_stream(sample));
+    EXPECT_EQ(expect, sample);
+    EXPECT_EQ(expect, batch_client->read_batch());
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_STREAM))
+            .WillOnce([&server_ring](char msg) {
+                EXPECT_EQ(0.0, server_ring.period());
+            });
+        EXPECT_CALL(*m_batch_status, receive_message(BatchStatus::M_MESSAGE_CONTINUE));
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_READ));
+        EXPECT_CALL(*m_batch_status, receive_message(BatchStatus::M_MESSAGE_CONTINUE));
+    }
+    batch_client->stop_stream();
+    // Reads are requested from the server after streaming stops
+    double *shmem_buffer = (double *)signal_shmem->pointer();
+    shmem_buffer[0] = 3.0;
+    shmem_buffer[1] = 4.0;
+    expect = {3.0, 4.0};
+    EXPECT_EQ(expect, batch_client->read_batch());
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "BatchRing.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_test.hpp"
+
+using geopm::BatchRing;
+
+class BatchRingTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void) override;
+        const int M_NUM_SIGNAL = 3;
+        const int M_CAPACITY = 4;
+        std::vector<double> m_buffer;
+        std::unique_ptr<BatchRing> m_writer;
+        std::unique_ptr<BatchRing> m_reader;
+};
+
+void BatchRingTest::SetUp(void)
+{
+    size_t size = BatchRing::buffer_size(M_NUM_SIGNAL, M_CAPACITY);
+    m_buffer.resize(size / sizeof(double) + 1, 0.0);
+    BatchRing::init(m_buffer.data(), size, M_NUM_SIGNAL, M_CAPACITY);
+    m_writer = geopm::make_unique<BatchRing>(m_buffer.data(), size, M_NUM_SIGNAL);
+    m_reader = geopm::make_unique<BatchRing>(m_buffer.data(), size, M_NUM_SIGNAL);
+}
+
+TEST_F(BatchRingTest, empty)
+{
+    EXPECT_EQ(M_CAPACITY, m_reader->capacity());
+    EXPECT_EQ(0ULL, m_reader->num_published());
+    std::vector<double> sample;
+    double time = 0.0;
+    EXPECT_FALSE(m_reader->read(0, time, sample));
+    GEOPM_EXPECT_THROW_MESSAGE(m_reader->latest(sample), GEOPM_ERROR_RUNTIME,
+                               "no sample has been published");
+}
+
+TEST_F(BatchRingTest, period)
+{
+    m_reader->period(0.005);
+    EXPECT_EQ(0.005, m_writer->period());
+}
+
+TEST_F(BatchRingTest, publish_latest)
+{
+    std::vector<double> sample;
+    for (int sample_idx = 0; sample_idx < 10; ++sample_idx) {
+        std::vector<double> expect = {1.0 * sample_idx, 2.0 * sample_idx, 3.0 * sample_idx};
+        m_writer->publish(sample_idx + 0.5, expect);
+        EXPECT_EQ((uint64_t)sample_idx + 1, m_reader->num_published());
+        EXPECT_EQ(sample_idx + 0.5, m_reader->latest(sample));
+        EXPECT_EQ(expect, sample);
+    }
+}
+
+TEST_F(BatchRingTest, read_history)
+{
+    for (int sample_idx = 0; sample_idx < 6; ++sample_idx) {
+        m_writer->publish(sample_idx, std::vector<double>(M_NUM_SIGNAL, sample_idx));
+    }
+    std::vector<double> sample;
+    double time = -1.0;
+    // Samples 0 and 1 have been overwritten
+    EXPECT_FALSE(m_reader->read(0, time, sample));
+    EXPECT_FALSE(m_reader->read(1, time, sample));
+    for (int sample_idx = 2; sample_idx < 6; ++sample_idx) {
+        EXPECT_TRUE(m_reader->read(sample_idx, time, sample));
+        EXPECT_EQ(sample_idx, time);
+        EXPECT_EQ(std::vector<double>(M_NUM_SIGNAL, sample_idx), sample);
+    }
+    // Sample 6 has not been published
+    EXPECT_FALSE(m_reader->read(6, time, sample));
+}
+
+TEST_F(BatchRingTest, invalid)
+{
+    size_t size = BatchRing::buffer_size(M_NUM_SIGNAL, M_CAPACITY);
+    GEOPM_EXPECT_THROW_MESSAGE(BatchRing(m_buffer.data(), size, M_NUM_SIGNAL + 1),
+                               GEOPM_ERROR_INVALID, "does not contain a valid sample ring");
+    GEOPM_EXPECT_THROW_MESSAGE(BatchRing(m_buffer.data(), size - 1, M_NUM_SIGNAL),
+                               GEOPM_ERROR_INVALID, "does not contain a valid sample ring");
+    GEOPM_EXPECT_THROW_MESSAGE(BatchRing::init(m_buffer.data(), size - 1, M_NUM_SIGNAL, M_CAPACITY),
+                               GEOPM_ERROR_INVALID, "invalid ring size");
+    GEOPM_EXPECT_THROW_MESSAGE(m_writer->publish(0.0, {1.0}),
+                               GEOPM_ERROR_INVALID, "sample size does not match ring");
+}
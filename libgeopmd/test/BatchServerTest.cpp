@@ -7,11 +7,14 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "BatchServer.hpp"
+#include "BatchCache.hpp"
+#include "BatchRing.hpp"
 #include "BatchStatus.hpp"
 #include "POSIXSignal.hpp"
 #include "geopm/SharedMemory.hpp"
 #include "geopm/PlatformIO.hpp"
 #include "MockPlatformIO.hpp"
+#include "MockBatchCache.hpp"
 #include "MockBatchStatus.hpp"
 #include "MockPOSIXSignal.hpp"
 
@@ -50,6 +53,7 @@ class BatchServerTest : public ::testing::Test
         std::shared_ptr<MockPOSIXSignal> m_posix_signal;
         std::shared_ptr<MockSharedMemoryPure> m_signal_shmem;
         std::shared_ptr<MockSharedMemoryPure> m_control_shmem;
+        std::shared_ptr<MockBatchCache> m_batch_cache;
 
         std::shared_ptr<BatchServerImp> m_batch_server;
 };
@@ -68,6 +72,7 @@ void BatchServerTest::SetUp(void)
     m_posix_signal = std::make_shared<MockPOSIXSignal>();
     m_signal_shmem = std::make_shared<MockSharedMemoryPure>();
     m_control_shmem = std::make_shared<MockSharedMemoryPure>();
+    m_batch_cache = std::make_shared<MockBatchCache>();
 
     EXPECT_CALL(*m_signal_shmem, unlink()).
         WillRepeatedly(Return());
@@ -77,7 +82,7 @@ void BatchServerTest::SetUp(void)
         m_client_pid, m_signal_config, m_control_config,
         m_signal_shmem_key, m_control_shmem_key,
         *m_pio, m_batch_status, m_posix_signal,
-        m_signal_shmem, m_control_shmem, m_server_pid);
+        m_signal_shmem, m_control_shmem, m_batch_cache, m_server_pid);
 }
 
 TEST_F(BatchServerTest, constructor)
@@ -148,6 +153,197 @@ TEST_F(BatchServerTest, read_and_update)
     EXPECT_EQ(1.0, buffer[0]);
 }
 
+TEST_F(BatchServerTest, stream)
+{
+    check_push_requests();
+    size_t offset = BatchServer::signal_ring_offset(1);
+    size_t ring_size = BatchRing::buffer_size(1, BatchServer::M_STREAM_CAPACITY);
+    std::vector<double> buffer((offset + ring_size) / sizeof(double), 0.0);
+    char *ring_buffer = (char *)buffer.data() + offset;
+    BatchRing::init(ring_buffer, ring_size, 1, BatchServer::M_STREAM_CAPACITY);
+    BatchRing client_ring(ring_buffer, ring_size, 1);
+    client_ring.period(0.001);
+    // The stream loop relies on poll_message() waiting for the timeout
+    auto poll_timeout = [](double timeout) {
+        usleep(timeout * 1E6);
+        return false;
+    };
+    EXPECT_CALL(*m_signal_shmem, pointer())
+        .WillRepeatedly(Return(buffer.data()));
+    EXPECT_CALL(*m_signal_shmem, size())
+        .WillRepeatedly(Return(buffer.size() * sizeof(double)));
+    std::vector<int> cache_entry = {3};
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_STREAM));
+        EXPECT_CALL(*m_pio, signal_behavior("signal_name"))
+            .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+        EXPECT_CALL(*m_pio, is_signal_derived("signal_name"))
+            .WillOnce(Return(false));
+        EXPECT_CALL(*m_batch_cache, entry_idx(_))
+            .WillOnce(Return(cache_entry[0]));
+        // First sample is read and shared before the response
+        EXPECT_CALL(*m_batch_cache, lookup(cache_entry, _, _))
+            .WillOnce(Return(false));
+        EXPECT_CALL(*m_pio, read_batch());
+        EXPECT_CALL(*m_pio, sample(_))
+            .WillOnce(Return(1.0));
+        EXPECT_CALL(*m_batch_cache, publish(cache_entry, _, std::vector<double>{1.0}));
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_CONTINUE));
+        // Two more periods elapse without a client message, the first
+        // sample was recently read by another server
+        EXPECT_CALL(*m_batch_status, poll_message(Le(0.001)))
+            .WillOnce(poll_timeout);
+        EXPECT_CALL(*m_batch_cache, lookup(cache_entry, _, _))
+            .WillOnce(DoAll(SetArgReferee<2>(std::vector<double>{2.0}),
+                            Return(true)));
+        EXPECT_CALL(*m_batch_status, poll_message(Le(0.001)))
+            .WillOnce(poll_timeout);
+        EXPECT_CALL(*m_batch_cache, lookup(cache_entry, _, _))
+            .WillOnce(Return(false));
+        EXPECT_CALL(*m_pio, read_batch());
+        EXPECT_CALL(*m_pio, sample(_))
+            .WillOnce(Return(3.0));
+        EXPECT_CALL(*m_batch_cache, publish(cache_entry, _, std::vector<double>{3.0}));
+        // Client sends a message which ends the stream loop
+        EXPECT_CALL(*m_batch_status, poll_message(Le(0.001)))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_TERMINATE));
+    }
+    m_batch_server->event_loop();
+    EXPECT_EQ(3ULL, client_ring.num_published());
+    std::vector<double> sample;
+    double time = 0.0;
+    EXPECT_TRUE(client_ring.read(1, time, sample));
+    EXPECT_EQ(std::vector<double>{2.0}, sample);
+    client_ring.latest(sample);
+    EXPECT_EQ(std::vector<double>{3.0}, sample);
+    // Flat signal buffer is not updated while streaming
+    EXPECT_EQ(0.0, buffer[0]);
+}
+
+TEST_F(BatchServerTest, stream_monotone)
+{
+    check_push_requests();
+    size_t offset = BatchServer::signal_ring_offset(1);
+    size_t ring_size = BatchRing::buffer_size(1, BatchServer::M_STREAM_CAPACITY);
+    std::vector<double> buffer((offset + ring_size) / sizeof(double), 0.0);
+    char *ring_buffer = (char *)buffer.data() + offset;
+    BatchRing::init(ring_buffer, ring_size, 1, BatchServer::M_STREAM_CAPACITY);
+    BatchRing client_ring(ring_buffer, ring_size, 1);
+    client_ring.period(0.001);
+    EXPECT_CALL(*m_signal_shmem, pointer())
+        .WillRepeatedly(Return(buffer.data()));
+    EXPECT_CALL(*m_signal_shmem, size())
+        .WillRepeatedly(Return(buffer.size() * sizeof(double)));
+    // Monotone signals are not shared with other servers
+    EXPECT_CALL(*m_pio, signal_behavior("signal_name"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE));
+    EXPECT_CALL(*m_batch_cache, entry_idx(_)).Times(0);
+    std::vector<int> cache_entry = {-1};
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_STREAM));
+        EXPECT_CALL(*m_batch_cache, lookup(cache_entry, _, _))
+            .WillOnce(Return(false));
+        EXPECT_CALL(*m_pio, read_batch());
+        EXPECT_CALL(*m_pio, sample(_))
+            .WillOnce(Return(1.0));
+        EXPECT_CALL(*m_batch_cache, publish(cache_entry, _, _));
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_CONTINUE));
+        EXPECT_CALL(*m_batch_status, poll_message(_))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_TERMINATE));
+    }
+    m_batch_server->event_loop();
+    EXPECT_EQ(1ULL, client_ring.num_published());
+}
+
+TEST_F(BatchServerTest, stream_derived)
+{
+    check_push_requests();
+    size_t offset = BatchServer::signal_ring_offset(1);
+    size_t ring_size = BatchRing::buffer_size(1, BatchServer::M_STREAM_CAPACITY);
+    std::vector<double> buffer((offset + ring_size) / sizeof(double), 0.0);
+    char *ring_buffer = (char *)buffer.data() + offset;
+    BatchRing::init(ring_buffer, ring_size, 1, BatchServer::M_STREAM_CAPACITY);
+    BatchRing client_ring(ring_buffer, ring_size, 1);
+    client_ring.period(0.001);
+    EXPECT_CALL(*m_signal_shmem, pointer())
+        .WillRepeatedly(Return(buffer.data()));
+    EXPECT_CALL(*m_signal_shmem, size())
+        .WillRepeatedly(Return(buffer.size() * sizeof(double)));
+    // Signals derived from recent samples are not shared with other
+    // servers
+    EXPECT_CALL(*m_pio, signal_behavior("signal_name"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    EXPECT_CALL(*m_pio, is_signal_derived("signal_name"))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*m_batch_cache, entry_idx(_)).Times(0);
+    std::vector<int> cache_entry = {-1};
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_STREAM));
+        EXPECT_CALL(*m_batch_cache, lookup(cache_entry, _, _))
+            .WillOnce(Return(false));
+        EXPECT_CALL(*m_pio, read_batch());
+        EXPECT_CALL(*m_pio, sample(_))
+            .WillOnce(Return(1.0));
+        EXPECT_CALL(*m_batch_cache, publish(cache_entry, _, _));
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_CONTINUE));
+        EXPECT_CALL(*m_batch_status, poll_message(_))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_TERMINATE));
+    }
+    m_batch_server->event_loop();
+    EXPECT_EQ(1ULL, client_ring.num_published());
+}
+
+TEST_F(BatchServerTest, stream_period_min)
+{
+    check_push_requests();
+    size_t offset = BatchServer::signal_ring_offset(1);
+    size_t ring_size = BatchRing::buffer_size(1, BatchServer::M_STREAM_CAPACITY);
+    std::vector<double> buffer((offset + ring_size) / sizeof(double), 0.0);
+    char *ring_buffer = (char *)buffer.data() + offset;
+    BatchRing::init(ring_buffer, ring_size, 1, BatchServer::M_STREAM_CAPACITY);
+    BatchRing client_ring(ring_buffer, ring_size, 1);
+    // Period requested by the client is shorter than the server allows
+    client_ring.period(1e-9);
+    EXPECT_CALL(*m_signal_shmem, pointer())
+        .WillRepeatedly(Return(buffer.data()));
+    EXPECT_CALL(*m_signal_shmem, size())
+        .WillRepeatedly(Return(buffer.size() * sizeof(double)));
+    EXPECT_CALL(*m_pio, signal_behavior("signal_name"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE));
+    EXPECT_CALL(*m_batch_cache, lookup(_, _, _))
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*m_batch_cache, publish(_, _, _))
+        .Times(AtLeast(1));
+    EXPECT_CALL(*m_pio, read_batch())
+        .Times(AtLeast(1));
+    EXPECT_CALL(*m_pio, sample(_))
+        .WillRepeatedly(Return(1.0));
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_STREAM));
+        EXPECT_CALL(*m_batch_status, send_message(BatchStatus::M_MESSAGE_CONTINUE));
+        EXPECT_CALL(*m_batch_status,
+                    poll_message(Gt(0.5 * BatchServer::M_STREAM_PERIOD_MIN)))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*m_batch_status, receive_message())
+            .WillOnce(Return(BatchStatus::M_MESSAGE_TERMINATE));
+    }
+    m_batch_server->event_loop();
+}
+
 TEST_F(BatchServerTest, update_and_write)
 {
     check_push_requests();
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "BatchThreadPool.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_test.hpp"
+
+using geopm::BatchThreadPool;
+
+TEST(BatchThreadPoolTest, run_all_tasks)
+{
+    for (int num_thread : {0, 1, 3}) {
+        std::unique_ptr<BatchThreadPool> pool = BatchThreadPool::make_unique(num_thread);
+        EXPECT_EQ(num_thread, pool->num_thread());
+        for (int num_task : {0, 1, 2, 7}) {
+            // Repeat to exercise reuse of the persistent threads
+            for (int repeat = 0; repeat < 20; ++repeat) {
+                std::vector<int> count(num_task, 0);
+                pool->run(num_task, [&count](int task_idx) {
+                    ++count[task_idx];
+                });
+                EXPECT_EQ(std::vector<int>(num_task, 1), count);
+            }
+        }
+    }
+}
+
+TEST(BatchThreadPoolTest, run_concurrent)
+{
+    std::unique_ptr<BatchThreadPool> pool = BatchThreadPool::make_unique(2);
+    std::atomic<int> num_waiting(0);
+    std::set<std::thread::id> thread_ids;
+    std::mutex thread_ids_mutex;
+    // Each task blocks until all three have started, which can only
+    // complete if they run concurrently.
+    pool->run(3, [&](int task_idx) {
+        {
+            std::lock_guard<std::mutex> lock(thread_ids_mutex);
+            thread_ids.insert(std::this_thread::get_id());
+        }
+        ++num_waiting;
+        while (num_waiting.load() < 3) {
+            std::this_thread::yield();
+        }
+    });
+    EXPECT_EQ(3U, thread_ids.size());
+    EXPECT_EQ(1U, thread_ids.count(std::this_thread::get_id()));
+}
+
+TEST(BatchThreadPoolTest, task_error)
+{
+    std::unique_ptr<BatchThreadPool> pool = BatchThreadPool::make_unique(2);
+    std::vector<int> count(4, 0);
+    GEOPM_EXPECT_THROW_MESSAGE(pool->run(4, [&count](int task_idx) {
+        ++count[task_idx];
+        if (task_idx == 2) {
+            throw geopm::Exception("task failed", GEOPM_ERROR_RUNTIME,
+                                   __FILE__, __LINE__);
+        }
+    }), GEOPM_ERROR_RUNTIME, "task failed");
+    // All tasks are still executed
+    EXPECT_EQ(std::vector<int>(4, 1), count);
+    // Pool is usable after an error
+    pool->run(4, [&count](int task_idx) {
+        ++count[task_idx];
+    });
+    EXPECT_EQ(std::vector<int>(4, 2), count);
+}
+
+TEST(BatchThreadPoolTest, invalid_num_thread)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(BatchThreadPool::make_unique(-1),
+                               GEOPM_ERROR_INVALID, "must be non-negative");
+}
@@ -21,11 +21,15 @@
 #include "geopm/PluginFactory.hpp"
 #include "geopm_hash.h"
 #include "geopm_test.hpp"
+#include "MockIOUring.hpp"
 #include <sys/stat.h>
+#include <unistd.h>
 
 using geopm::CNLIOGroup;
 using geopm::Exception;
 using geopm::PlatformTopo;
+using testing::_;
+using testing::Invoke;
 
 class CNLIOGroupTest : public ::testing ::Test
 {
@@ -228,3 +232,67 @@ TEST_F(CNLIOGroupTest, parse_energy)
             << signal.second;
     }
 }
+
+TEST_F(CNLIOGroupTest, read_batch)
+{
+    CNLIOGroup cnl(m_test_dir);
+    int power_idx = cnl.push_signal("CNL::BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int power_alias_idx = cnl.push_signal("BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int energy_idx = cnl.push_signal("CNL::MEMORY_ENERGY", GEOPM_DOMAIN_BOARD, 0);
+    int rate_idx = cnl.push_signal("CNL::SAMPLE_RATE", GEOPM_DOMAIN_BOARD, 0);
+    int time_idx = cnl.push_signal("CNL::SAMPLE_ELAPSED_TIME", GEOPM_DOMAIN_BOARD, 0);
+
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_alias_idx));
+    EXPECT_DOUBLE_EQ(58869289, cnl.sample(energy_idx));
+    EXPECT_DOUBLE_EQ(10, cnl.sample(rate_idx));
+    EXPECT_DOUBLE_EQ(0, cnl.sample(time_idx));
+
+    // Updated values are read through the files opened at construction
+    std::ofstream(m_power_path) << "101 W\n";
+    std::ofstream(m_memory_energy_path) << "58869389 J\n";
+    std::ofstream(m_freshness_path) << "25\n";
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(101, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(101, cnl.sample(power_alias_idx));
+    EXPECT_DOUBLE_EQ(58869389, cnl.sample(energy_idx));
+    EXPECT_DOUBLE_EQ(10, cnl.sample(rate_idx));
+    EXPECT_DOUBLE_EQ(2.5, cnl.sample(time_idx));
+
+    // Format errors are reported by read_batch()
+    std::ofstream(m_power_path) << "101 J\n";
+    EXPECT_THROW(cnl.read_batch(), Exception);
+}
+
+TEST_F(CNLIOGroupTest, read_batch_once_per_file)
+{
+    auto batch_reader = std::make_shared<MockIOUring>();
+    CNLIOGroup cnl(m_test_dir, batch_reader);
+    int power_idx = cnl.push_signal("CNL::BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int power_alias_idx = cnl.push_signal("BOARD_POWER", GEOPM_DOMAIN_BOARD, 0);
+    int cpu_power_idx = cnl.push_signal("CNL::BOARD_POWER_CPU", GEOPM_DOMAIN_BOARD, 0);
+
+    // A signal and its alias share a file, so two files are read
+    auto read_power = [](std::shared_ptr<int> ret, int fd, void *buf, unsigned nbytes, off_t offset) {
+        *ret = pread(fd, buf, nbytes, offset);
+    };
+    EXPECT_CALL(*batch_reader, prep_read(_, _, _, _, 0))
+        .Times(2)
+        .WillRepeatedly(Invoke(read_power));
+    EXPECT_CALL(*batch_reader, submit()).Times(1);
+    cnl.read_batch();
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_idx));
+    EXPECT_DOUBLE_EQ(85, cnl.sample(power_alias_idx));
+    EXPECT_DOUBLE_EQ(33, cnl.sample(cpu_power_idx));
+
+    // Read errors are reported by read_batch()
+    auto read_error = [](std::shared_ptr<int> ret, int, void *, unsigned, off_t) {
+        *ret = -EIO;
+    };
+    EXPECT_CALL(*batch_reader, prep_read(_, _, _, _, 0))
+        .Times(2)
+        .WillRepeatedly(Invoke(read_error));
+    EXPECT_CALL(*batch_reader, submit()).Times(1);
+    GEOPM_EXPECT_THROW_MESSAGE(cnl.read_batch(), EIO, "failed to read");
+}
@@ -36,3 +36,13 @@ TEST(CombinedSignalTest, sample_max)
     result = comb_signal.sample(values);
     EXPECT_DOUBLE_EQ(18, result);
 }
+
+TEST(CombinedSignalTest, sample_custom)
+{
+    auto func = [](const std::vector<double> &values) {
+        return values.size() * 10.0;
+    };
+    CombinedSignal comb_signal {func};
+    std::vector<double> values = {4.1, 5, -6};
+    EXPECT_DOUBLE_EQ(30.0, comb_signal.sample(values));
+}
@@ -167,6 +167,18 @@ TEST_F(CpufreqSysfsDriverTest, signal_parse)
     EXPECT_TRUE(std::isnan(m_driver->signal_parse("CPUFREQ::SCALING_SETSPEED")("BADDAD")));
 }
 
+TEST_F(CpufreqSysfsDriverTest, signal_parse_sysfs_content)
+{
+    auto parse = m_driver->signal_parse("CPUFREQ::SCALING_CUR_FREQ");
+    EXPECT_DOUBLE_EQ(1.1e9, parse("1100000\n"));
+    EXPECT_DOUBLE_EQ(1.1e9, parse("  1100000 \n"));
+    EXPECT_DOUBLE_EQ(3.8e9, parse("3800000\n"));
+    EXPECT_DOUBLE_EQ(0.0, parse("0\n"));
+    EXPECT_TRUE(std::isnan(parse("\n")));
+    EXPECT_TRUE(std::isnan(parse("-")));
+    EXPECT_TRUE(std::isnan(parse("99999999999999999999999\n")));
+}
+
 TEST_F(CpufreqSysfsDriverTest, control_gen)
 {
     EXPECT_THROW(m_driver->control_gen("CPUFREQ::A_MADE_UP_ATTRIBUTE_NAME"), geopm::Exception)
@@ -8,13 +8,20 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <unistd.h>
 
 #include "IOUringFallback.hpp"
+#ifdef GEOPM_HAS_IO_URING
+#include "IOUringImp.hpp"
+#endif
 #include "geopm_test.hpp"
 
 #include "gtest/gtest.h"
 
+#include <iostream>
 #include <memory>
+#include <string>
+#include <vector>
 
 using geopm::IOUring;
 
@@ -83,3 +90,74 @@ TEST_F(IOUringTest, batch_write)
     test_writes("uring", geopm::IOUring::make_unique(2));
     test_writes("fallback", geopm::IOUringFallback::make_unique(2));
 }
+
+TEST_F(IOUringTest, batch_reuse)
+{
+    // A queue is reused for many batches with more operations than
+    // are completed by one wait.
+    const int num_op = 64;
+    std::string path = "IOUringTest_batch_reuse";
+    for (const std::string context : {"uring", "fallback"}) {
+        std::shared_ptr<IOUring> io;
+        if (context == "uring") {
+            io = geopm::IOUring::make_unique(num_op);
+        }
+        else {
+            io = geopm::IOUringFallback::make_unique(num_op);
+        }
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+        ASSERT_NE(-1, fd) << context;
+        std::vector<std::shared_ptr<int> > ret(num_op);
+        for (auto &ret_it : ret) {
+            ret_it = std::make_shared<int>(0);
+        }
+        std::vector<uint64_t> buffer(num_op);
+        for (int iter = 0; iter < 3; ++iter) {
+            for (int op_idx = 0; op_idx < num_op; ++op_idx) {
+                buffer[op_idx] = 1000 * iter + op_idx;
+                io->prep_write(ret[op_idx], fd, &buffer[op_idx], sizeof(uint64_t),
+                               op_idx * sizeof(uint64_t));
+            }
+            io->submit();
+            for (int op_idx = 0; op_idx < num_op; ++op_idx) {
+                EXPECT_EQ((int)sizeof(uint64_t), *ret[op_idx]) << context;
+                buffer[op_idx] = 0;
+                *ret[op_idx] = 0;
+                io->prep_read(ret[op_idx], fd, &buffer[op_idx], sizeof(uint64_t),
+                              op_idx * sizeof(uint64_t));
+            }
+            io->submit();
+            for (int op_idx = 0; op_idx < num_op; ++op_idx) {
+                EXPECT_EQ((int)sizeof(uint64_t), *ret[op_idx]) << context;
+                EXPECT_EQ((uint64_t)(1000 * iter + op_idx), buffer[op_idx]) << context;
+            }
+        }
+        // Submitting an empty queue does nothing
+        io->submit();
+        close(fd);
+        unlink(path.c_str());
+    }
+}
+
+#ifdef GEOPM_HAS_IO_URING
+TEST_F(IOUringTest, full_queue)
+{
+    if (!geopm::IOUringImp::is_supported()) {
+        std::cerr << "Warning: skipping IOUringTest.full_queue, io_uring not supported" << std::endl;
+        return;
+    }
+    auto io = geopm::IOUringImp::make_unique(2);
+    int fd = open("/dev/zero", O_RDONLY);
+    ASSERT_NE(-1, fd);
+    int buf[3] = {};
+    io->prep_read(nullptr, fd, buf, sizeof(int), 0);
+    io->prep_read(nullptr, fd, buf + 1, sizeof(int), 0);
+    GEOPM_EXPECT_THROW_MESSAGE(io->prep_read(nullptr, fd, buf + 2, sizeof(int), 0),
+                               GEOPM_ERROR_RUNTIME, "full batch queue");
+    // Completions without a destination are consumed
+    io->submit();
+    io->prep_read(nullptr, fd, buf, sizeof(int), 0);
+    io->submit();
+    close(fd);
+}
+#endif
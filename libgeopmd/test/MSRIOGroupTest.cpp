@@ -125,6 +125,7 @@ void MSRIOGroupTest::SetUp()
     // suppress warnings about num_domain and domain_nested calls
     EXPECT_CALL(*m_topo, num_domain(_)).Times(AtLeast(0));
     EXPECT_CALL(*m_topo, domain_nested(_, _, _)).Times(AtLeast(0));
+    EXPECT_CALL(*m_topo, domain_nested_table(_, _)).Times(AtLeast(0));
     // suppress mock calls from initializing counter enables
     EXPECT_CALL(*m_msrio, write_msr(_, _, _, _)).Times(AtLeast(0));
     // suppress mock calls from initializing rdt signals
@@ -241,6 +242,11 @@ TEST_F(MSRIOGroupTest, valid_signal_names)
         // check that signals have a valid behavior enum
         EXPECT_LT(-1, m_msrio_group->signal_behavior(name)) << name;
     }
+    // Power is computed from the recent energy samples
+    EXPECT_TRUE(m_msrio_group->is_signal_derived("CPU_POWER"));
+    EXPECT_TRUE(m_msrio_group->is_signal_derived("MSR::CPU_SCALABILITY_RATIO"));
+    EXPECT_FALSE(m_msrio_group->is_signal_derived("CPU_ENERGY"));
+    EXPECT_FALSE(m_msrio_group->is_signal_derived("MSR::PKG_ENERGY_STATUS:ENERGY"));
 }
 
 TEST_F(MSRIOGroupTest, valid_signal_domains)
@@ -529,6 +535,27 @@ TEST_F(MSRIOGroupTest, sample)
                                GEOPM_ERROR_INVALID, "cannot push a signal after read_batch");
 }
 
+TEST_F(MSRIOGroupTest, write_count)
+{
+    EXPECT_EQ(geopm::IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+              m_msrio_group->signal_behavior("MSR::WRITE_ISSUED_COUNT"));
+    EXPECT_EQ(GEOPM_DOMAIN_BOARD,
+              m_msrio_group->signal_domain_type("MSR::WRITE_SKIPPED_COUNT"));
+    EXPECT_CALL(*m_msrio, num_write_issued()).WillOnce(Return(5));
+    EXPECT_CALL(*m_msrio, num_write_skipped()).WillOnce(Return(3));
+    EXPECT_EQ(5, m_msrio_group->read_signal("MSR::WRITE_ISSUED_COUNT",
+                                            GEOPM_DOMAIN_BOARD, 0));
+    EXPECT_EQ(3, m_msrio_group->read_signal("MSR::WRITE_SKIPPED_COUNT",
+                                            GEOPM_DOMAIN_BOARD, 0));
+
+    int skipped_idx = m_msrio_group->push_signal("MSR::WRITE_SKIPPED_COUNT",
+                                                 GEOPM_DOMAIN_BOARD, 0);
+    EXPECT_CALL(*m_msrio, read_batch());
+    m_msrio_group->read_batch();
+    EXPECT_CALL(*m_msrio, num_write_skipped()).WillOnce(Return(4));
+    EXPECT_EQ(4, m_msrio_group->sample(skipped_idx));
+}
+
 TEST_F(MSRIOGroupTest, sample_raw)
 {
     uint64_t fixed_ctr_offset = 0x309;
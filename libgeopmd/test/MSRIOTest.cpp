@@ -817,10 +817,10 @@ TEST_F(MSRIOTest, write_batch)
     for (int i = 0; i < m_num_cpu; ++i) {
         cpu_idx.push_back(i);
     }
-    //                       begin_words {"software", "engineer", "document",
-    //                       "everyday",
-    //                                    "modeling", "standout", "patience",
-    //                                    "goodwill"};
+    std::vector<std::string> begin_words0{ "software", "engineer", "document",
+                                           "everyday" };
+    std::vector<std::string> begin_words1{ "modeling", "standout", "patience",
+                                           "goodwill" };
     std::vector<std::string> end_words0{ "HARDware", "BEgineRX", "Mocument",
                                          "everyWay" };
     std::vector<std::string> end_words1{ "moBIling", "XHandout",
@@ -862,7 +862,9 @@ TEST_F(MSRIOTest, write_batch)
         }
     }
 
-    auto read_all_bytes = [&offsets0, &end_words0, &offsets1, &end_words1](
+    // Writes that do not change the value read are skipped, so the
+    // MSRs start out with the begin words.
+    auto read_all_bytes = [&offsets0, &begin_words0, &offsets1, &begin_words1](
             std::shared_ptr<int> ret, int, void *buf, unsigned nbytes, off_t offset) {
         auto it = std::find(offsets0.begin(), offsets0.end(), offset);
         if (it == offsets0.end()) {
@@ -872,13 +874,13 @@ TEST_F(MSRIOTest, write_batch)
             }
             else {
                 auto idx = std::distance(offsets1.begin(), it);
-                end_words1[idx].copy((char *)buf, nbytes);
+                begin_words1[idx].copy((char *)buf, nbytes);
                 *ret = nbytes;
             }
         }
         else {
             auto idx = std::distance(offsets0.begin(), it);
-            end_words0[idx].copy((char*)buf, nbytes);
+            begin_words0[idx].copy((char*)buf, nbytes);
             *ret = nbytes;
         }
     };
@@ -917,3 +919,124 @@ TEST_F(MSRIOTest, write_batch)
     EXPECT_EQ(end_words0, written_words0);
     EXPECT_EQ(end_words1, written_words1);
 }
+
+TEST_F(MSRIOTest, write_batch_skip_unchanged)
+{
+    uint64_t offset = 0x520;
+    uint64_t msr_value = 0xFF00FF00FF00FF00ULL;
+    int num_read = 0;
+    int num_write = 0;
+    EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, _)).WillRepeatedly(
+            Invoke([&msr_value, &num_read](std::shared_ptr<int> ret, int, void *buf,
+                                           unsigned nbytes, off_t) {
+                memcpy(buf, &msr_value, nbytes);
+                *ret = nbytes;
+                ++num_read;
+            }));
+    EXPECT_CALL(*m_batch_io, prep_write(_, _, _, _, _)).WillRepeatedly(
+            Invoke([&msr_value, &num_write](std::shared_ptr<int> ret, int, const void *buf,
+                                            unsigned nbytes, off_t) {
+                memcpy(&msr_value, buf, nbytes);
+                *ret = nbytes;
+                ++num_write;
+            }));
+    EXPECT_CALL(*m_batch_io, submit()).WillRepeatedly(Return());
+
+    // Two fields of the same MSR share one operation
+    int idx_low = m_msrio->add_write(0, offset);
+    int idx_high = m_msrio->add_write(0, offset);
+    EXPECT_EQ(idx_low, idx_high);
+    m_msrio->adjust(idx_low, 0x12ULL, 0xFFULL);
+    m_msrio->adjust(idx_high, 0x3400ULL, 0xFF00ULL);
+    m_msrio->write_batch();
+    EXPECT_EQ(1, num_read);
+    EXPECT_EQ(1, num_write);
+    EXPECT_EQ(0xFF00FF00FF003412ULL, msr_value);
+    EXPECT_EQ(1ULL, m_msrio->num_write_issued());
+    EXPECT_EQ(0ULL, m_msrio->num_write_skipped());
+
+    // Not adjusted: neither read nor written
+    m_msrio->write_batch();
+    EXPECT_EQ(1, num_read);
+    EXPECT_EQ(1, num_write);
+    EXPECT_EQ(1ULL, m_msrio->num_write_issued());
+    EXPECT_EQ(0ULL, m_msrio->num_write_skipped());
+
+    // Adjusted to the value the MSR already holds: read only
+    m_msrio->adjust(idx_low, 0x12ULL, 0xFFULL);
+    m_msrio->write_batch();
+    EXPECT_EQ(2, num_read);
+    EXPECT_EQ(1, num_write);
+    EXPECT_EQ(1ULL, m_msrio->num_write_issued());
+    EXPECT_EQ(1ULL, m_msrio->num_write_skipped());
+
+    // Adjusted to a new value
+    m_msrio->adjust(idx_low, 0x56ULL, 0xFFULL);
+    m_msrio->write_batch();
+    EXPECT_EQ(3, num_read);
+    EXPECT_EQ(2, num_write);
+    EXPECT_EQ(0xFF00FF00FF003456ULL, msr_value);
+    EXPECT_EQ(2ULL, m_msrio->num_write_issued());
+
+    // A change made outside of the object is detected by the read
+    msr_value = 0xFF00FF00FF003478ULL;
+    m_msrio->adjust(idx_low, 0x56ULL, 0xFFULL);
+    m_msrio->write_batch();
+    EXPECT_EQ(4, num_read);
+    EXPECT_EQ(3, num_write);
+    EXPECT_EQ(0xFF00FF00FF003456ULL, msr_value);
+    EXPECT_EQ(3ULL, m_msrio->num_write_issued());
+    EXPECT_EQ(1ULL, m_msrio->num_write_skipped());
+}
+
+TEST_F(MSRIOTest, batch_context_queue)
+{
+    // Use the batch queues that MSRIO creates for each context
+    auto path = std::make_shared<MockMSRPath>();
+    for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+        EXPECT_CALL(*path, msr_path(cpu_idx))
+            .WillOnce(Return(m_files->test_dev_path()[cpu_idx]));
+    }
+    EXPECT_CALL(*path, msr_batch_path()).WillRepeatedly(Return("NO_FILE_HERE"));
+    MSRIOImp msrio(m_num_cpu, path, nullptr, nullptr);
+    int ctx_small = msrio.create_batch_context();
+    int ctx_large = msrio.create_batch_context();
+    int idx_small = msrio.add_read(1, 0x8, ctx_small);
+    std::vector<int> idx_large;
+    for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+        idx_large.push_back(msrio.add_read(cpu_idx, 0x0, ctx_large));
+        idx_large.push_back(msrio.add_read(cpu_idx, 0x640, ctx_large));
+    }
+    for (int iter = 0; iter < 2; ++iter) {
+        msrio.read_batch(ctx_small);
+        msrio.read_batch(ctx_large);
+        uint64_t field = msrio.sample(idx_small, ctx_small);
+        EXPECT_EQ(0, memcmp(&field, "abstract", 8));
+        for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+            field = msrio.sample(idx_large[2 * cpu_idx], ctx_large);
+            EXPECT_EQ(0, memcmp(&field, "absolute", 8));
+            field = msrio.sample(idx_large[2 * cpu_idx + 1], ctx_large);
+            EXPECT_EQ(0, memcmp(&field, "fraction", 8));
+        }
+    }
+
+    // An operation added after a batch was read resizes the queue
+    int idx_added = msrio.add_read(2, 0x8, ctx_small);
+    msrio.read_batch(ctx_small);
+    uint64_t field = msrio.sample(idx_added, ctx_small);
+    EXPECT_EQ(0, memcmp(&field, "abstract", 8));
+
+    int ctx_write = msrio.create_batch_context();
+    std::vector<int> idx_write;
+    for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+        idx_write.push_back(msrio.add_write(cpu_idx, 0x0, ctx_write));
+    }
+    memcpy(&field, "etul\0\0\0\0", 8);
+    for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+        msrio.adjust(idx_write[cpu_idx], field, 0x00000000FFFFFFFF, ctx_write);
+    }
+    msrio.write_batch(ctx_write);
+    for (int cpu_idx = 0; cpu_idx < m_num_cpu; ++cpu_idx) {
+        EXPECT_EQ(0, memcmp(m_files->msr_space_ptr(cpu_idx, 0), "etullute", 8));
+    }
+}
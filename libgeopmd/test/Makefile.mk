@@ -2,8 +2,14 @@
 #  SPDX-License-Identifier: BSD-3-Clause
 #
 
-check_PROGRAMS += test/geopm_test \
+check_PROGRAMS += test/agg_bench \
+                  test/cnl_read_bench \
+                  test/geopm_test \
                   test/isadmin \
+                  test/msr_batch_bench \
+                  test/platform_topo_bench \
+                  test/prometheus_exporter_bench \
+                  test/sysfs_read_bench \
                   # end
 check_SCRIPTS += test/geopm_test.test
 noinst_SCRIPTS += $(check_SCRIPTS)
@@ -11,6 +17,24 @@ noinst_SCRIPTS += $(check_SCRIPTS)
 test_isadmin_SOURCES = test/isadmin.cpp
 test_isadmin_LDADD = libgeopmd.la
 
+test_agg_bench_SOURCES = test/agg_bench.cpp
+test_agg_bench_LDADD = libgeopmd.la
+
+test_cnl_read_bench_SOURCES = test/cnl_read_bench.cpp
+test_cnl_read_bench_LDADD = libgeopmd.la
+
+test_msr_batch_bench_SOURCES = test/msr_batch_bench.cpp
+test_msr_batch_bench_LDADD = libgeopmd.la
+
+test_platform_topo_bench_SOURCES = test/platform_topo_bench.cpp
+test_platform_topo_bench_LDADD = libgeopmd.la
+
+test_prometheus_exporter_bench_SOURCES = test/prometheus_exporter_bench.cpp
+test_prometheus_exporter_bench_LDADD = libgeopmd.la
+
+test_sysfs_read_bench_SOURCES = test/sysfs_read_bench.cpp
+test_sysfs_read_bench_LDADD = libgeopmd.la
+
 TEST_LOG_DRIVER = env AM_TAP_AWK='$(AWK)' $(SHELL) \
                   $(top_srcdir)/build-aux/tap-driver.sh
 
@@ -24,9 +48,12 @@ EXTRA_DIST += test/legacy_allowlist.out \
 
 test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/AggTest.cpp \
+                          test/BatchCacheTest.cpp \
                           test/BatchClientTest.cpp \
+                          test/BatchRingTest.cpp \
                           test/BatchStatusTest.cpp \
                           test/BatchServerTest.cpp \
+                          test/BatchThreadPoolTest.cpp \
                           test/CircularBufferTest.cpp \
                           test/CNLIOGroupTest.cpp \
                           test/CombinedSignalTest.cpp \
@@ -59,6 +86,7 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/MSRFieldSignalTest.cpp \
                           test/MockCpuid.hpp \
                           test/MockGPUTopo.hpp \
+                          test/MockBatchCache.hpp \
                           test/MockBatchClient.hpp \
                           test/MockBatchStatus.hpp \
                           test/MockControl.hpp \
@@ -88,6 +116,8 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/POSIXSignalTest.cpp \
                           test/PlatformIOTest.cpp \
                           test/PlatformTopoTest.cpp \
+                          test/PrometheusExporterTest.cpp \
+                          test/QuantileSketchTest.cpp \
                           test/RawMSRSignalTest.cpp \
                           test/SharedMemoryTest.cpp \
                           test/SaveControlTest.cpp \
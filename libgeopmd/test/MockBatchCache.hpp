@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MOCKBATCHCACHE_HPP_INCLUDE
+#define MOCKBATCHCACHE_HPP_INCLUDE
+
+#include "gmock/gmock.h"
+
+#include "BatchCache.hpp"
+
+
+class MockBatchCache : public geopm::BatchCache {
+    public:
+        MOCK_METHOD(int, entry_idx, (const geopm_request_s &request), (override));
+        MOCK_METHOD(bool, lookup,
+                    (const std::vector<int> &entry, double min_time,
+                     std::vector<double> &sample),
+                    (const, override));
+        MOCK_METHOD(void, publish,
+                    (const std::vector<int> &entry, double time,
+                     const std::vector<double> &sample),
+                    (override));
+};
+
+#endif
@@ -15,6 +15,9 @@ class MockBatchClient : public geopm::BatchClient {
         MOCK_METHOD(std::vector<double>, read_batch, (), (override));
         MOCK_METHOD(void, write_batch, (std::vector<double> settings), (override));
         MOCK_METHOD(void, stop_batch, (), (override));
+        MOCK_METHOD(void, start_stream, (double period), (override));
+        MOCK_METHOD(void, stop_stream, (), (override));
+        MOCK_METHOD(double, read_stream, (std::vector<double> &sample), (override));
 };
 
 #endif
@@ -16,6 +16,7 @@ class MockBatchStatus : public geopm::BatchStatus {
         MOCK_METHOD(void, send_message, (char msg), (override));
         MOCK_METHOD(char, receive_message, (), (override));
         MOCK_METHOD(void, receive_message, (char expect), (override));
+        MOCK_METHOD(bool, poll_message, (double timeout), (override));
 };
 
 #endif
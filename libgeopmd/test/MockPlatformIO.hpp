@@ -32,6 +32,10 @@ class MockPlatformIO : public geopm::PlatformIO
         MOCK_METHOD(void, adjust, (int control_idx, double setting), (override));
         MOCK_METHOD(void, read_batch, (), (override));
         MOCK_METHOD(void, write_batch, (), (override));
+        MOCK_METHOD((std::map<std::string, double>), read_batch_duration, (),
+                    (const, override));
+        MOCK_METHOD((std::map<std::string, double>), write_batch_duration, (),
+                    (const, override));
         MOCK_METHOD(double, read_signal,
                     (const std::string &signal_name, int domain_type, int domain_idx),
                     (override));
@@ -53,6 +57,8 @@ class MockPlatformIO : public geopm::PlatformIO
                     (const std::string &control_name), (const, override));
         MOCK_METHOD(int, signal_behavior, (const std::string &signal_name),
                     (const, override));
+        MOCK_METHOD(bool, is_signal_derived, (const std::string &signal_name),
+                    (const, override));
         MOCK_METHOD(void, start_batch_server,
                     (int client_pid,
                      const std::vector<geopm_request_s> &signal_config,
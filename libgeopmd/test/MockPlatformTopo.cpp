@@ -5,6 +5,10 @@
 #include "MockPlatformTopo.hpp"
 
 #include <iostream>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include "geopm/Exception.hpp"
 
@@ -117,6 +121,83 @@ std::shared_ptr<MockPlatformTopo> make_topo(int num_package, int num_core, int n
             .WillByDefault(Return(std::set<int>{cpu_idx}));
     }
 
+    // expectations for domain_nested_table, built from the same
+    // mapping of CPUs to domains as domain_idx
+    auto cpu_domain_idx = [num_core, core_per_package](int domain_type, int cpu_idx) {
+        int result = 0;
+        switch (domain_type) {
+            case GEOPM_DOMAIN_PACKAGE:
+            case GEOPM_DOMAIN_MEMORY:
+                result = (cpu_idx % num_core) / core_per_package;
+                break;
+            case GEOPM_DOMAIN_CORE:
+                result = cpu_idx % num_core;
+                break;
+            case GEOPM_DOMAIN_CPU:
+                result = cpu_idx;
+                break;
+            default:
+                break;
+        }
+        return result;
+    };
+    std::map<int, int> table_num_domain = {
+        {GEOPM_DOMAIN_BOARD, 1},
+        {GEOPM_DOMAIN_PACKAGE, num_package},
+        {GEOPM_DOMAIN_MEMORY, num_package},
+        {GEOPM_DOMAIN_CORE, num_core},
+        {GEOPM_DOMAIN_CPU, num_cpu},
+    };
+    std::vector<std::pair<int, int> > table_nesting = {
+        {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_BOARD},
+        {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_MEMORY},
+        {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_PACKAGE},
+        {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_CORE},
+        {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_CPU},
+        {GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_BOARD},
+        {GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_PACKAGE},
+        {GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_CORE},
+        {GEOPM_DOMAIN_PACKAGE, GEOPM_DOMAIN_BOARD},
+        {GEOPM_DOMAIN_PACKAGE, GEOPM_DOMAIN_PACKAGE},
+        {GEOPM_DOMAIN_BOARD, GEOPM_DOMAIN_BOARD},
+        {GEOPM_DOMAIN_MEMORY, GEOPM_DOMAIN_BOARD},
+        {GEOPM_DOMAIN_MEMORY, GEOPM_DOMAIN_MEMORY},
+    };
+    auto nested_table = std::make_shared<std::map<std::pair<int, int>,
+                                                  geopm::PlatformTopo::nested_table_s> >();
+    for (const auto &nesting : table_nesting) {
+        int num_outer = table_num_domain.at(nesting.second);
+        std::vector<std::set<int> > outer_inner(num_outer);
+        for (int cpu_idx = 0; cpu_idx < num_cpu; ++cpu_idx) {
+            outer_inner[cpu_domain_idx(nesting.second, cpu_idx)].insert(
+                cpu_domain_idx(nesting.first, cpu_idx));
+        }
+        auto &table = (*nested_table)[nesting];
+        table.outer_idx.assign(table_num_domain.at(nesting.first), -1);
+        for (int outer_idx = 0; outer_idx < num_outer; ++outer_idx) {
+            table.offset.push_back(table.inner_idx.size());
+            for (int inner_idx : outer_inner[outer_idx]) {
+                table.inner_idx.push_back(inner_idx);
+                if (table.outer_idx[inner_idx] == -1) {
+                    table.outer_idx[inner_idx] = outer_idx;
+                }
+            }
+        }
+        table.offset.push_back(table.inner_idx.size());
+    }
+    ON_CALL(*topo, domain_nested_table(_, _))
+        .WillByDefault(Invoke([nested_table](int inner_domain, int outer_domain)
+                              -> const geopm::PlatformTopo::nested_table_s & {
+            auto table_it = nested_table->find({inner_domain, outer_domain});
+            if (table_it == nested_table->end()) {
+                throw Exception("MockPlatformTopo: no nesting table for domain type " +
+                                std::to_string(inner_domain) + " within domain type " +
+                                std::to_string(outer_domain),
+                                GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+            }
+            return table_it->second;
+        }));
+
     // expectations for domain_idx
     ON_CALL(*topo, domain_idx(GEOPM_DOMAIN_CPU, _))
         .WillByDefault(Invoke([](int, int cpu_idx){ return cpu_idx; }));
@@ -25,6 +25,8 @@ class MockPlatformTopo : public geopm::PlatformTopo
         MOCK_METHOD(std::set<int>, domain_nested,
                     (int inner_domain, int outer_domain, int outer_idx),
                     (const, override));
+        MOCK_METHOD(const nested_table_s &, domain_nested_table,
+                    (int inner_domain, int outer_domain), (const, override));
 };
 
 /// Create a MockPlatformTopo and set up expectations for the system hierarchy.
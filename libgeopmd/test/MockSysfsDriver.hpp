@@ -19,7 +19,7 @@ class MockSysfsDriver : public geopm::SysfsDriver
         MOCK_METHOD(std::string, attribute_path,
                     (const std::string &name, int domain_idx),
                     (override));
-        MOCK_METHOD(std::function<double(const std::string &)>, signal_parse,
+        MOCK_METHOD(std::function<double(const char *)>, signal_parse,
                     (const std::string &signal_name),
                     (const, override));
         MOCK_METHOD(std::function<std::string(double)>, control_gen,
@@ -472,6 +472,65 @@ TEST_F(PlatformIOTest, sample)
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample(10), GEOPM_ERROR_INVALID, "signal_idx out of range");
 }
 
+TEST_F(PlatformIOTest, read_write_batch_parallel)
+{
+    std::list<std::shared_ptr<IOGroup> > iogroup_list;
+    for (auto ptr : m_iogroup_ptr) {
+        iogroup_list.emplace_back(ptr);
+    }
+    PlatformIOImp platio(iogroup_list, *m_topo, 2);
+    EXPECT_TRUE(platio.read_batch_duration().empty());
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch()).Times(2);
+        EXPECT_CALL(*iog, write_batch()).Times(1);
+    }
+    platio.read_batch();
+    platio.read_batch();
+    platio.write_batch();
+    std::set<std::string> expected_names {"TIME", "FALLBACK", "CONTROL", "OVERRIDE"};
+    for (const auto &duration : {platio.read_batch_duration(),
+                                 platio.write_batch_duration()}) {
+        std::set<std::string> names;
+        for (const auto &it : duration) {
+            names.insert(it.first);
+            EXPECT_LE(0.0, it.second);
+        }
+        EXPECT_EQ(expected_names, names);
+    }
+
+    EXPECT_CALL(*m_time_iogroup, read_batch());
+    EXPECT_CALL(*m_fallback_iogroup, read_batch());
+    EXPECT_CALL(*m_control_iogroup, read_batch())
+        .WillOnce(Throw(geopm::Exception("read failed", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    EXPECT_CALL(*m_override_iogroup, read_batch());
+    GEOPM_EXPECT_THROW_MESSAGE(platio.read_batch(), GEOPM_ERROR_RUNTIME, "read failed");
+}
+
+TEST_F(PlatformIOTest, read_batch_parallel_register)
+{
+    std::list<std::shared_ptr<IOGroup> > iogroup_list {m_time_iogroup,
+                                                       m_control_iogroup};
+    PlatformIOImp platio(iogroup_list, *m_topo, 4);
+    EXPECT_CALL(*m_time_iogroup, read_batch()).Times(2);
+    EXPECT_CALL(*m_control_iogroup, read_batch()).Times(2);
+    platio.read_batch();
+    EXPECT_EQ(1, platio.num_batch_thread());
+
+    // The pool grows with the number of IOGroups registered
+    platio.register_iogroup(m_fallback_iogroup);
+    platio.register_iogroup(m_override_iogroup);
+    EXPECT_CALL(*m_fallback_iogroup, read_batch());
+    EXPECT_CALL(*m_override_iogroup, read_batch());
+    platio.read_batch();
+    EXPECT_EQ(3, platio.num_batch_thread());
+    std::set<std::string> expected_names {"TIME", "FALLBACK", "CONTROL", "OVERRIDE"};
+    std::set<std::string> names;
+    for (const auto &it : platio.read_batch_duration()) {
+        names.insert(it.first);
+    }
+    EXPECT_EQ(expected_names, names);
+}
+
 TEST_F(PlatformIOTest, sample_not_active)
 {
     /*EXPECT_CALL(*m_control_iogroup, control_domain_type("FREQ")).Times(2);
@@ -517,6 +576,19 @@ TEST_F(PlatformIOTest, sample_agg)
         sum += cpu;
     }
     EXPECT_DOUBLE_EQ(sum / m_cpu_set0.size(), freq);
+
+    // The combined value is computed once per read_batch()
+    EXPECT_DOUBLE_EQ(sum / m_cpu_set0.size(), m_platio->sample(freq_idx));
+
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch());
+    }
+    m_platio->read_batch();
+    for (auto cpu : m_cpu_set0) {
+        EXPECT_CALL(*m_control_iogroup, sample(cpu)).WillOnce(Return(2.0 * cpu));
+    }
+    EXPECT_DOUBLE_EQ(2.0 * sum / m_cpu_set0.size(), m_platio->sample(freq_idx));
+    EXPECT_DOUBLE_EQ(2.0 * sum / m_cpu_set0.size(), m_platio->sample(freq_idx));
 }
 
 TEST_F(PlatformIOTest, adjust)
@@ -817,6 +889,16 @@ TEST_F(PlatformIOTest, signal_behavior)
                                GEOPM_ERROR_INVALID, "unknown signal \"INVALID\"");
 }
 
+TEST_F(PlatformIOTest, is_signal_derived)
+{
+    EXPECT_CALL(*m_time_iogroup, signal_domain_type("TIME")).Times(1);
+    EXPECT_CALL(*m_time_iogroup, is_signal_derived("TIME"))
+        .WillOnce(Return(true));
+    EXPECT_TRUE(m_platio->is_signal_derived("TIME"));
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->is_signal_derived("INVALID"),
+                               GEOPM_ERROR_INVALID, "unknown signal \"INVALID\"");
+}
+
 TEST_F(PlatformIOTest, is_valid_value)
 {
     EXPECT_EQ(true, m_platio->is_valid_value(3.14));
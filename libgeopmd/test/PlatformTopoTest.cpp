@@ -4,18 +4,22 @@
  */
 
 
+#include <fcntl.h>
 #include <unistd.h>
 #include <utime.h>
 #include <sys/sysinfo.h>
 #include <sys/stat.h>
 
+#include <cstdint>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "geopm/Helper.hpp"
+#include "GPUTopoNull.hpp"
 #include "MockGPUTopo.hpp"
 #include "MockServiceProxy.hpp"
 #include "PlatformTopoImp.hpp"
@@ -42,6 +46,7 @@ class PlatformTopoTest : public :: testing :: Test
         void TearDown();
         void write_lscpu(const std::string &lscpu_str);
         void spoof_lscpu(void);
+        void write_sysfs(const std::string &file_name, const std::string &contents);
         void check_bdx_domain_idx(std::string file_name, std::shared_ptr<ServiceProxy> service_proxy);
         std::string m_path_env_save;
         std::string m_lscpu_file_name;
@@ -57,6 +62,8 @@ class PlatformTopoTest : public :: testing :: Test
         std::string m_gpu_lscpu_str;
         std::string m_lscpu_str;
         bool m_do_unlink;
+        std::string m_sysfs_path;
+        std::vector<std::string> m_sysfs_created;
 };
 
 void PlatformTopoTest::spoof_lscpu(void)
@@ -340,6 +347,11 @@ void PlatformTopoTest::TearDown()
 {
     if (m_do_unlink) {
         unlink(m_lscpu_file_name.c_str());
+        unlink(PlatformTopoImp::binary_cache_file_name(m_lscpu_file_name).c_str());
+    }
+    // Remove files before the directories that contain them
+    for (auto it = m_sysfs_created.rbegin(); it != m_sysfs_created.rend(); ++it) {
+        remove(it->c_str());
     }
     (void)unlink("lscpu");
     (void)setenv("PATH", m_path_env_save.c_str(), 1);
@@ -357,6 +369,27 @@ void PlatformTopoTest::write_lscpu(const std::string &lscpu_str)
     chmod(m_lscpu_file_name.c_str(), default_perms);
 }
 
+void PlatformTopoTest::write_sysfs(const std::string &file_name, const std::string &contents)
+{
+    if (m_sysfs_path.empty()) {
+        char path_template[] = "PlatformTopoTest-sysfs-XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(path_template));
+        m_sysfs_path = path_template;
+        m_sysfs_created.push_back(m_sysfs_path);
+    }
+    std::vector<std::string> path_split = geopm::string_split(file_name, "/");
+    std::string path = m_sysfs_path;
+    for (size_t dir_idx = 0; dir_idx + 1 < path_split.size(); ++dir_idx) {
+        path += "/" + path_split[dir_idx];
+        if (mkdir(path.c_str(), 0755) == 0) {
+            m_sysfs_created.push_back(path);
+        }
+    }
+    path = m_sysfs_path + "/" + file_name;
+    geopm::write_file(path, contents);
+    m_sysfs_created.push_back(path);
+}
+
 TEST_F(PlatformTopoTest, hsw_num_domain)
 {
     write_lscpu(m_hsw_lscpu_str);
@@ -771,6 +804,69 @@ TEST_F(PlatformTopoTest, bdx_domain_nested)
                                     GEOPM_DOMAIN_NIC, 0), Exception);
 }
 
+TEST_F(PlatformTopoTest, gpu_domain_nested_table)
+{
+    write_lscpu(m_gpu_lscpu_str);
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr);
+    std::vector<int> domain_types = {
+        GEOPM_DOMAIN_BOARD,
+        GEOPM_DOMAIN_PACKAGE,
+        GEOPM_DOMAIN_CORE,
+        GEOPM_DOMAIN_CPU,
+        GEOPM_DOMAIN_MEMORY,
+        GEOPM_DOMAIN_GPU,
+        GEOPM_DOMAIN_GPU_CHIP,
+    };
+    // The tables agree with domain_nested() and domain_idx()
+    for (int outer_domain : domain_types) {
+        int num_outer = topo.num_domain(outer_domain);
+        for (int inner_domain : domain_types) {
+            if (!topo.is_nested_domain(inner_domain, outer_domain)) {
+                GEOPM_EXPECT_THROW_MESSAGE(topo.domain_nested_table(inner_domain, outer_domain),
+                                           GEOPM_ERROR_INVALID, "is not contained within");
+                continue;
+            }
+            const auto &table = topo.domain_nested_table(inner_domain, outer_domain);
+            ASSERT_EQ((size_t)num_outer + 1, table.offset.size());
+            EXPECT_EQ(0, table.offset.front());
+            EXPECT_EQ(table.inner_idx.size(), (size_t)table.offset.back());
+            ASSERT_EQ((size_t)topo.num_domain(inner_domain), table.outer_idx.size());
+            for (int outer_idx = 0; outer_idx != num_outer; ++outer_idx) {
+                std::set<int> row(table.inner_idx.begin() + table.offset[outer_idx],
+                                  table.inner_idx.begin() + table.offset[outer_idx + 1]);
+                EXPECT_EQ((size_t)(table.offset[outer_idx + 1] - table.offset[outer_idx]), row.size());
+                EXPECT_EQ(topo.domain_nested(inner_domain, outer_domain, outer_idx), row);
+            }
+            if (inner_domain == GEOPM_DOMAIN_CPU) {
+                for (int cpu_idx = 0; cpu_idx != topo.num_domain(GEOPM_DOMAIN_CPU); ++cpu_idx) {
+                    EXPECT_EQ(topo.domain_idx(outer_domain, cpu_idx), table.outer_idx[cpu_idx]);
+                }
+            }
+        }
+    }
+    const auto &chip_table = topo.domain_nested_table(GEOPM_DOMAIN_GPU_CHIP, GEOPM_DOMAIN_GPU);
+    std::vector<int> expect = {0, 2, 4, 6, 8, 10, 12};
+    EXPECT_EQ(expect, chip_table.offset);
+    expect = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    EXPECT_EQ(expect, chip_table.inner_idx);
+    expect = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5};
+    EXPECT_EQ(expect, chip_table.outer_idx);
+    const auto &cpu_table = topo.domain_nested_table(GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_GPU);
+    EXPECT_EQ(35, cpu_table.offset[1]);
+    EXPECT_EQ(204, cpu_table.inner_idx[34]);
+    EXPECT_EQ(3, cpu_table.outer_idx[207]);
+    const auto &core_table = topo.domain_nested_table(GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_PACKAGE);
+    expect = {0, 52, 104};
+    EXPECT_EQ(expect, core_table.offset);
+
+    GEOPM_EXPECT_THROW_MESSAGE(topo.domain_nested_table(GEOPM_DOMAIN_NIC, GEOPM_DOMAIN_BOARD),
+                               GEOPM_ERROR_NOT_IMPLEMENTED, "no support yet");
+    GEOPM_EXPECT_THROW_MESSAGE(topo.domain_nested_table(GEOPM_DOMAIN_CPU, GEOPM_NUM_DOMAIN),
+                               GEOPM_ERROR_INVALID, "domain_type out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(topo.domain_nested(GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_GPU, 6),
+                               GEOPM_ERROR_INVALID, "outer_idx out of range");
+}
+
 TEST_F(PlatformTopoTest, parse_error)
 {
     std::string lscpu_missing_cpu =
@@ -907,7 +1003,7 @@ TEST_F(PlatformTopoTest, create_cache)
     // Test case: no lscpu error, file does not exist
     setenv("PLATFORM_TOPO_TEST_LSCPU_ERROR", "", 1);
 
-    PlatformTopoImp::create_cache(cache_file_path, *gpu_topo);
+    PlatformTopoImp::create_cache(cache_file_path, *gpu_topo, "");
 
     std::ifstream cache_stream(cache_file_path);
     std::string cache_line;
@@ -925,9 +1021,11 @@ TEST_F(PlatformTopoTest, create_cache)
     ASSERT_TRUE(geopm::string_begins_with(cache_line, "Architecture:"));
     cache_stream.close();
 
-    // Test case: file does not exist and lscpu returns an error code.
+    // Test case: file does not exist, sysfs is not readable, and
+    // lscpu returns an error code.
     unlink(cache_file_path.c_str());
-    EXPECT_THROW(PlatformTopoImp::create_cache(cache_file_path), geopm::Exception);
+    EXPECT_THROW(PlatformTopoImp::create_cache(cache_file_path, *gpu_topo, "PlatformTopoTest-no-sysfs"),
+                 geopm::Exception);
     for (const auto &file_path : geopm::list_directory_files("./")) {
         EXPECT_THAT(file_path, Not(StartsWith(cache_file_path)))
             << "PlatformTopoImp::create_cache leaked a temporary file";
@@ -1042,3 +1140,131 @@ TEST_F(PlatformTopoTest, check_file_bad_perms)
     std::string new_file_contents = geopm::read_file(m_lscpu_file_name);
     ASSERT_EQ(m_hsw_lscpu_str, new_file_contents);
 }
+
+TEST_F(PlatformTopoTest, read_sysfs_topo)
+{
+    // Two packages with one core each, and two threads per core
+    write_sysfs("cpu/present", "0-3\n");
+    write_sysfs("cpu/online", "0-3\n");
+    write_sysfs("cpu/cpu0/topology/physical_package_id", "0\n");
+    write_sysfs("cpu/cpu0/topology/thread_siblings_list", "0,2\n");
+    write_sysfs("cpu/cpu1/topology/physical_package_id", "1\n");
+    write_sysfs("cpu/cpu1/topology/thread_siblings_list", "1,3\n");
+    write_sysfs("cpu/cpu2/topology/physical_package_id", "0\n");
+    write_sysfs("cpu/cpu2/topology/thread_siblings_list", "0,2\n");
+    write_sysfs("cpu/cpu3/topology/physical_package_id", "1\n");
+    write_sysfs("cpu/cpu3/topology/thread_siblings_list", "1,3\n");
+    write_sysfs("node/possible", "0-2\n");
+    write_sysfs("node/node0/cpulist", "0,2\n");
+    write_sysfs("node/node1/cpulist", "1,3\n");
+    // Memory without CPUs
+    write_sysfs("node/node2/cpulist", "\n");
+
+    std::string sysfs_topo = PlatformTopoImp::read_sysfs_topo(m_sysfs_path);
+    std::vector<std::string> lines = geopm::string_split(sysfs_topo, "\n");
+    ASSERT_LT(0ULL, lines.size());
+    EXPECT_TRUE(geopm::string_begins_with(lines[0], "Architecture:"));
+    std::vector<std::string> expect_lines = {
+        "CPU(s):              4",
+        "On-line CPU(s) mask: 0xf",
+        "Thread(s) per core:  2",
+        "Core(s) per socket:  1",
+        "Socket(s):           2",
+        "NUMA node(s):        3",
+        "NUMA node0 CPU(s):   0x5",
+        "NUMA node1 CPU(s):   0xa",
+        "NUMA node2 CPU(s):   0x0",
+        "",
+    };
+    lines.erase(lines.begin());
+    EXPECT_EQ(expect_lines, lines);
+
+    // The cache is created from sysfs without running lscpu
+    spoof_lscpu();
+    setenv("PLATFORM_TOPO_TEST_LSCPU_ERROR", "1", 1);
+    unlink(m_lscpu_file_name.c_str());
+    m_do_unlink = true;
+    geopm::GPUTopoNull gpu_topo;
+    PlatformTopoImp::create_cache(m_lscpu_file_name, gpu_topo, m_sysfs_path);
+    EXPECT_EQ(sysfs_topo, geopm::read_file(m_lscpu_file_name));
+
+    write_sysfs("cpu/online", "0-1,3\n");
+    EXPECT_NE(std::string::npos, PlatformTopoImp::read_sysfs_topo(m_sysfs_path).find("On-line CPU(s) mask: 0xb\n"));
+    write_sysfs("cpu/online", "0-z\n");
+    GEOPM_EXPECT_THROW_MESSAGE(PlatformTopoImp::read_sysfs_topo(m_sysfs_path),
+                               GEOPM_ERROR_INVALID, "invalid CPU list");
+    EXPECT_THROW(PlatformTopoImp::read_sysfs_topo("PlatformTopoTest-no-sysfs"), geopm::Exception);
+}
+
+TEST_F(PlatformTopoTest, binary_cache)
+{
+    std::string binary_file_name = PlatformTopoImp::binary_cache_file_name(m_lscpu_file_name);
+    write_lscpu(m_bdx_lscpu_str);
+    unlink(binary_file_name.c_str());
+    std::vector<int> domain_types = {
+        GEOPM_DOMAIN_BOARD,
+        GEOPM_DOMAIN_PACKAGE,
+        GEOPM_DOMAIN_CORE,
+        GEOPM_DOMAIN_CPU,
+        GEOPM_DOMAIN_MEMORY,
+    };
+    // Parse the cache file and write the binary cache
+    PlatformTopoImp topo_text(m_lscpu_file_name, nullptr);
+    struct stat binary_stat;
+    ASSERT_EQ(0, stat(binary_file_name.c_str(), &binary_stat));
+    EXPECT_EQ((mode_t)(S_IRUSR | S_IWUSR), binary_stat.st_mode & ~S_IFMT);
+
+    // Replace the cache file, but mark it older than the binary
+    // cache so that the binary cache is used.
+    write_lscpu(m_knl_lscpu_str);
+    struct utimbuf file_times = {binary_stat.st_mtime - 1, binary_stat.st_mtime - 1};
+    ASSERT_EQ(0, utime(m_lscpu_file_name.c_str(), &file_times));
+    PlatformTopoImp topo_binary(m_lscpu_file_name, nullptr);
+    for (int domain_type : domain_types) {
+        int num_domain = topo_text.num_domain(domain_type);
+        ASSERT_EQ(num_domain, topo_binary.num_domain(domain_type));
+        for (int cpu_idx = 0; cpu_idx != topo_text.num_domain(GEOPM_DOMAIN_CPU); ++cpu_idx) {
+            EXPECT_EQ(topo_text.domain_idx(domain_type, cpu_idx),
+                      topo_binary.domain_idx(domain_type, cpu_idx));
+        }
+        for (int domain_idx = 0; domain_idx != num_domain; ++domain_idx) {
+            EXPECT_EQ(topo_text.domain_nested(GEOPM_DOMAIN_CPU, domain_type, domain_idx),
+                      topo_binary.domain_nested(GEOPM_DOMAIN_CPU, domain_type, domain_idx));
+        }
+        // Nesting tables are read from the binary cache
+        for (int inner_domain : domain_types) {
+            if (!topo_text.is_nested_domain(inner_domain, domain_type)) {
+                continue;
+            }
+            const auto &table_text = topo_text.domain_nested_table(inner_domain, domain_type);
+            const auto &table_binary = topo_binary.domain_nested_table(inner_domain, domain_type);
+            EXPECT_EQ(table_text.offset, table_binary.offset);
+            EXPECT_EQ(table_text.inner_idx, table_binary.inner_idx);
+            EXPECT_EQ(table_text.outer_idx, table_binary.outer_idx);
+        }
+    }
+    EXPECT_THROW(topo_binary.domain_idx(GEOPM_DOMAIN_NIC, 0), geopm::Exception);
+
+    // A binary cache with an invalid nesting table is ignored
+    int binary_fd = open(binary_file_name.c_str(), O_WRONLY);
+    ASSERT_NE(-1, binary_fd);
+    int32_t bad_idx = INT32_MAX;
+    ASSERT_EQ((ssize_t)sizeof(bad_idx),
+              pwrite(binary_fd, &bad_idx, sizeof(bad_idx), binary_stat.st_size - sizeof(bad_idx)));
+    close(binary_fd);
+    PlatformTopoImp topo_bad(m_lscpu_file_name, nullptr);
+    EXPECT_EQ(256, topo_bad.num_domain(GEOPM_DOMAIN_CPU));
+
+    // A truncated binary cache is ignored
+    ASSERT_EQ(0, truncate(binary_file_name.c_str(), sizeof(int)));
+    PlatformTopoImp topo_knl(m_lscpu_file_name, nullptr);
+    EXPECT_EQ(256, topo_knl.num_domain(GEOPM_DOMAIN_CPU));
+
+    // A cache file that is newer than the binary cache is parsed
+    write_lscpu(m_bdx_lscpu_str);
+    time_t future_time = time(nullptr) + 10;
+    file_times = {future_time, future_time};
+    ASSERT_EQ(0, utime(m_lscpu_file_name.c_str(), &file_times));
+    PlatformTopoImp topo_bdx(m_lscpu_file_name, nullptr);
+    EXPECT_EQ(topo_text.num_domain(GEOPM_DOMAIN_CPU), topo_bdx.num_domain(GEOPM_DOMAIN_CPU));
+}
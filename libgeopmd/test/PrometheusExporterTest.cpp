@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "PrometheusExporter.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_test.hpp"
+#include "geopm_topo.h"
+#include "MockStatsCollector.hpp"
+
+using geopm::PrometheusExporter;
+using geopm::PrometheusExporterImp;
+using geopm::StatsCollector;
+using testing::Return;
+
+class PrometheusExporterTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void) override;
+        std::map<std::string, std::string> parse(const std::string &text);
+        StatsCollector::report_s m_report;
+        std::shared_ptr<MockStatsCollector> m_collector;
+};
+
+void PrometheusExporterTest::SetUp(void)
+{
+    m_report = {"host", "date", {10.0, 101.0, 0.1, 0.01},
+                {"CPU_POWER", "CPU_FREQUENCY_STATUS-package-1"},
+                {{100.0, 50.0, 60.0, 40.0, 70.0, 55.5, 1.5},
+                 {100.0, 2e9, 2.1e9, NAN, INFINITY, -INFINITY, 0.0}}, {}, {}};
+    m_collector = std::make_shared<MockStatsCollector>();
+    EXPECT_CALL(*m_collector, report_struct())
+        .WillRepeatedly(Return(m_report));
+}
+
+// Map from metric name to value for each sample line
+std::map<std::string, std::string> PrometheusExporterTest::parse(const std::string &text)
+{
+    std::map<std::string, std::string> result;
+    std::string help_name;
+    for (const auto &line : geopm::string_split(text, "\n")) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream line_stream(line);
+        std::string name;
+        std::string value;
+        line_stream >> name;
+        if (name == "#") {
+            std::string keyword;
+            line_stream >> keyword >> name;
+            if (keyword == "HELP") {
+                help_name = name;
+            }
+            else {
+                EXPECT_EQ("TYPE", keyword);
+                EXPECT_EQ(help_name, name);
+                line_stream >> value;
+                EXPECT_EQ("gauge", value);
+            }
+            continue;
+        }
+        EXPECT_EQ(help_name, name);
+        line_stream >> value;
+        EXPECT_FALSE(line_stream.fail());
+        EXPECT_EQ(0ULL, result.count(name));
+        result[name] = value;
+    }
+    return result;
+}
+
+TEST_F(PrometheusExporterTest, metric_name)
+{
+    std::map<std::string, std::string> expected = {
+        {"CPU_POWER-package-0", "geopm_cpu_power_package_0_watts"},
+        {"CPU_UNCORE_FREQUENCY_STATUS-package-0", "geopm_cpu_uncore_frequency_status_package_0_hertz"},
+        {"DRAM_ENERGY-package-0", "geopm_dram_energy_package_0_joules"},
+        {"GPU_TEMPERATURE-package-0", "geopm_gpu_temperature_package_0_celcius"},
+        {"GPU_UTILIZATION-gpu-0", "geopm_gpu_utilization_gpu_0"},
+        {"MSR::DRAM_ENERGY_STATUS:ENERGY-package-0", "geopm_msr__dram_energy_status_energy_package_0_joules"},
+        {"sample-time-total", "geopm_sample_time_total"},
+    };
+    for (const auto &it : expected) {
+        EXPECT_EQ(it.second, PrometheusExporter::metric_name(it.first));
+    }
+}
+
+TEST_F(PrometheusExporterTest, scrape)
+{
+    PrometheusExporterImp exporter(m_collector);
+    EXPECT_CALL(*m_collector, update())
+        .Times(2);
+    exporter.update();
+    exporter.update();
+    EXPECT_CALL(*m_collector, reset())
+        .Times(1);
+    std::string text = exporter.scrape();
+    std::map<std::string, std::string> metric = parse(text);
+    EXPECT_EQ(4ULL + 2 * 7, metric.size());
+    EXPECT_EQ(10.0, std::stod(metric.at("geopm_sample_time_total")));
+    EXPECT_EQ(101.0, std::stod(metric.at("geopm_sample_count")));
+    EXPECT_EQ(0.1, std::stod(metric.at("geopm_sample_period_mean")));
+    EXPECT_EQ(0.01, std::stod(metric.at("geopm_sample_period_std")));
+    EXPECT_EQ(100.0, std::stod(metric.at("geopm_cpu_power_count_watts")));
+    EXPECT_EQ(50.0, std::stod(metric.at("geopm_cpu_power_first_watts")));
+    EXPECT_EQ(60.0, std::stod(metric.at("geopm_cpu_power_last_watts")));
+    EXPECT_EQ(40.0, std::stod(metric.at("geopm_cpu_power_min_watts")));
+    EXPECT_EQ(70.0, std::stod(metric.at("geopm_cpu_power_max_watts")));
+    EXPECT_EQ(55.5, std::stod(metric.at("geopm_cpu_power_mean_watts")));
+    EXPECT_EQ(1.5, std::stod(metric.at("geopm_cpu_power_std_watts")));
+    EXPECT_EQ(2e9, std::stod(metric.at("geopm_cpu_frequency_status_package_1_first_hertz")));
+    EXPECT_EQ(2.1e9, std::stod(metric.at("geopm_cpu_frequency_status_package_1_last_hertz")));
+    EXPECT_EQ("NaN", metric.at("geopm_cpu_frequency_status_package_1_min_hertz"));
+    EXPECT_EQ("+Inf", metric.at("geopm_cpu_frequency_status_package_1_max_hertz"));
+    EXPECT_EQ("-Inf", metric.at("geopm_cpu_frequency_status_package_1_mean_hertz"));
+    EXPECT_EQ(0.0, std::stod(metric.at("geopm_cpu_frequency_status_package_1_std_hertz")));
+
+    // Values are rewritten in place
+    m_report.metric_stats[0][GEOPM_METRIC_MAX] = -1.2345678901234567e-300;
+    EXPECT_CALL(*m_collector, report_struct())
+        .WillOnce(Return(m_report));
+    EXPECT_CALL(*m_collector, reset())
+        .Times(1);
+    std::string text_next = exporter.scrape();
+    EXPECT_EQ(text.size(), text_next.size());
+    metric = parse(text_next);
+    EXPECT_EQ(-1.2345678901234567e-300, std::stod(metric.at("geopm_cpu_power_max_watts")));
+}
+
+TEST_F(PrometheusExporterTest, quantiles)
+{
+    m_report.quantiles = {0.5, 0.95};
+    m_report.metric_quantiles = {{55.0, 68.5}, {2e9, 2.1e9}};
+    EXPECT_CALL(*m_collector, report_struct())
+        .WillRepeatedly(Return(m_report));
+    PrometheusExporterImp exporter(m_collector);
+    EXPECT_CALL(*m_collector, reset())
+        .Times(1);
+    std::map<std::string, std::string> metric = parse(exporter.scrape());
+    EXPECT_EQ(4ULL + 2 * (7 + 2), metric.size());
+    EXPECT_EQ(55.5, std::stod(metric.at("geopm_cpu_power_mean_watts")));
+    EXPECT_EQ(55.0, std::stod(metric.at("geopm_cpu_power_p50_watts")));
+    EXPECT_EQ(68.5, std::stod(metric.at("geopm_cpu_power_p95_watts")));
+    EXPECT_EQ(2e9, std::stod(metric.at("geopm_cpu_frequency_status_package_1_p50_hertz")));
+    EXPECT_EQ(2.1e9, std::stod(metric.at("geopm_cpu_frequency_status_package_1_p95_hertz")));
+}
+
+TEST_F(PrometheusExporterTest, parse_requests)
+{
+    std::istringstream input("# Signals to export\n"
+                             "CPU_POWER board 0\n"
+                             "\n"
+                             "CPU_FREQUENCY_STATUS package 1 # second package\n");
+    std::vector<geopm_request_s> requests = PrometheusExporter::parse_requests(input);
+    ASSERT_EQ(2ULL, requests.size());
+    EXPECT_EQ("CPU_POWER", std::string(requests[0].name));
+    EXPECT_EQ(GEOPM_DOMAIN_BOARD, requests[0].domain_type);
+    EXPECT_EQ(0, requests[0].domain_idx);
+    EXPECT_EQ("CPU_FREQUENCY_STATUS", std::string(requests[1].name));
+    EXPECT_EQ(GEOPM_DOMAIN_PACKAGE, requests[1].domain_type);
+    EXPECT_EQ(1, requests[1].domain_idx);
+
+    std::istringstream bad_words("CPU_POWER board\n");
+    GEOPM_EXPECT_THROW_MESSAGE(PrometheusExporter::parse_requests(bad_words),
+                               GEOPM_ERROR_INVALID, "must be three words");
+    std::istringstream bad_idx("CPU_POWER board zero\n");
+    GEOPM_EXPECT_THROW_MESSAGE(PrometheusExporter::parse_requests(bad_idx),
+                               GEOPM_ERROR_INVALID, "Invalid domain index");
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "QuantileSketch.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::QuantileSketch;
+
+class QuantileSketchTest : public ::testing::Test
+{
+    protected:
+        // Value at the rank used by QuantileSketch::quantile()
+        static double exact_quantile(std::vector<double> values, double quantile);
+        const std::vector<double> M_QUANTILES = {0.0, 0.01, 0.25, 0.5, 0.75, 0.95, 0.99, 1.0};
+};
+
+double QuantileSketchTest::exact_quantile(std::vector<double> values, double quantile)
+{
+    std::sort(values.begin(), values.end());
+    return values[(size_t)std::floor(quantile * (values.size() - 1))];
+}
+
+TEST_F(QuantileSketchTest, empty)
+{
+    QuantileSketch sketch;
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+    sketch.add(NAN);
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+}
+
+TEST_F(QuantileSketchTest, infinite)
+{
+    QuantileSketch sketch;
+    sketch.add(INFINITY);
+    sketch.add(-INFINITY);
+    EXPECT_EQ(0ULL, sketch.count());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+    sketch.add(2.0);
+    sketch.add(INFINITY);
+    sketch.add(-INFINITY);
+    EXPECT_EQ(1ULL, sketch.count());
+    EXPECT_NEAR(2.0, sketch.quantile(0.0), 0.02);
+    EXPECT_NEAR(2.0, sketch.quantile(1.0), 0.02);
+}
+
+TEST_F(QuantileSketchTest, relative_accuracy)
+{
+    std::mt19937 generator(42);
+    // Power like values spanning a few orders of magnitude
+    std::lognormal_distribution<double> distribution(4.0, 1.5);
+    std::vector<double> values(10000);
+    QuantileSketch sketch;
+    for (auto &value : values) {
+        value = distribution(generator);
+        sketch.add(value);
+    }
+    EXPECT_EQ(values.size(), sketch.count());
+    for (double quantile : M_QUANTILES) {
+        double expect = exact_quantile(values, quantile);
+        EXPECT_NEAR(expect, sketch.quantile(quantile), 0.01 * expect) << "quantile: " << quantile;
+    }
+}
+
+TEST_F(QuantileSketchTest, negative_and_zero)
+{
+    std::vector<double> values;
+    QuantileSketch sketch;
+    for (int idx = -50; idx <= 50; ++idx) {
+        values.push_back(idx * 0.5);
+        sketch.add(idx * 0.5);
+    }
+    EXPECT_EQ(0.0, sketch.quantile(0.5));
+    for (double quantile : M_QUANTILES) {
+        double expect = exact_quantile(values, quantile);
+        EXPECT_NEAR(expect, sketch.quantile(quantile), 0.01 * std::fabs(expect)) << "quantile: " << quantile;
+    }
+}
+
+TEST_F(QuantileSketchTest, merge)
+{
+    std::mt19937 generator(7);
+    std::normal_distribution<double> distribution_a(100.0, 10.0);
+    std::normal_distribution<double> distribution_b(-200.0, 50.0);
+    QuantileSketch sketch_a;
+    QuantileSketch sketch_b;
+    QuantileSketch sketch_all;
+    for (int idx = 0; idx < 1000; ++idx) {
+        double value_a = distribution_a(generator);
+        double value_b = distribution_b(generator);
+        sketch_a.add(value_a);
+        sketch_b.add(value_b);
+        sketch_all.add(value_a);
+        sketch_all.add(value_b);
+    }
+    sketch_a.merge(sketch_b);
+    EXPECT_EQ(sketch_all.count(), sketch_a.count());
+    for (double quantile : M_QUANTILES) {
+        EXPECT_EQ(sketch_all.quantile(quantile), sketch_a.quantile(quantile));
+    }
+    QuantileSketch sketch_other(0.02, 2048);
+    GEOPM_EXPECT_THROW_MESSAGE(sketch_a.merge(sketch_other), GEOPM_ERROR_INVALID,
+                               "different parameters");
+}
+
+TEST_F(QuantileSketchTest, bounded_buckets)
+{
+    // With 200 buckets a one percent sketch spans a factor of about
+    // 55, the smallest values are combined.
+    QuantileSketch sketch(0.01, 200);
+    std::vector<double> values;
+    for (double value = 1e-3; value < 1e6; value *= 1.001) {
+        values.push_back(value);
+        sketch.add(value);
+    }
+    for (double quantile : {0.95, 0.99, 1.0}) {
+        double expect = exact_quantile(values, quantile);
+        EXPECT_NEAR(expect, sketch.quantile(quantile), 0.01 * expect) << "quantile: " << quantile;
+    }
+    // The smallest values are over estimated
+    EXPECT_LT(values[0] * 1000, sketch.quantile(0.0));
+    sketch.reset();
+    EXPECT_EQ(0ULL, sketch.count());
+    sketch.add(5.0);
+    EXPECT_NEAR(5.0, sketch.quantile(0.0), 0.05);
+}
+
+TEST_F(QuantileSketchTest, invalid)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(QuantileSketch(0.0, 100), GEOPM_ERROR_INVALID,
+                               "relative_accuracy must be between zero and one");
+    GEOPM_EXPECT_THROW_MESSAGE(QuantileSketch(0.01, 0), GEOPM_ERROR_INVALID,
+                               "max_num_bucket must be positive");
+    QuantileSketch sketch;
+    GEOPM_EXPECT_THROW_MESSAGE(sketch.quantile(1.5), GEOPM_ERROR_INVALID,
+                               "quantile must be between zero and one");
+    GEOPM_EXPECT_THROW_MESSAGE(sketch.quantile(NAN), GEOPM_ERROR_INVALID,
+                               "quantile must be between zero and one");
+}
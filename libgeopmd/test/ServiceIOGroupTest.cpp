@@ -252,6 +252,44 @@ TEST_F(ServiceIOGroupTest, push_signal)
     m_batch_client.reset();
 }
 
+TEST_F(ServiceIOGroupTest, push_signal_stream)
+{
+    // Replace the fixture IOGroup with one that streams samples
+    m_serviceio_group.reset();
+    std::vector<signal_info_s> expected_signal_info = {m_signal_info[m_expected_signals[0]],
+                                                       m_signal_info[m_expected_signals[1]]};
+    std::vector<control_info_s> expected_control_info = {m_control_info[m_expected_controls[0]],
+                                                         m_control_info[m_expected_controls[1]]};
+    EXPECT_CALL(*m_proxy, platform_get_signal_info(m_expected_signals))
+        .WillOnce(Return(expected_signal_info));
+    EXPECT_CALL(*m_proxy, platform_get_control_info(m_expected_controls))
+        .WillOnce(Return(expected_control_info));
+    EXPECT_CALL(*m_proxy, platform_open_session());
+    EXPECT_CALL(*m_proxy, platform_close_session());
+    m_serviceio_group = geopm::make_unique<ServiceIOGroup>(*m_topo,
+                                                           m_proxy,
+                                                           m_batch_client,
+                                                           0.005);
+    EXPECT_CALL(*m_proxy, platform_start_batch(_, _, _, _))
+        .WillOnce(DoAll(SetArgReferee<2>(1234),
+                        SetArgReferee<3>("1234")));
+    EXPECT_CALL(*m_batch_client, start_stream(0.005));
+    std::vector<double> expected_result = {4.321012};
+    EXPECT_CALL(*m_batch_client, read_stream(_))
+        .Times(2)
+        .WillRepeatedly(DoAll(SetArgReferee<0>(expected_result),
+                              Return(1.0)));
+    EXPECT_CALL(*m_batch_client, read_batch()).Times(0);
+    int signal_handle = m_serviceio_group->push_signal("signal1", GEOPM_DOMAIN_BOARD, 0);
+    m_serviceio_group->read_batch();
+    EXPECT_EQ(expected_result[0], m_serviceio_group->sample(signal_handle));
+    m_serviceio_group->read_batch();
+    EXPECT_EQ(expected_result[0], m_serviceio_group->sample(signal_handle));
+    EXPECT_CALL(*m_batch_client, stop_batch())
+        .Times(1);
+    m_batch_client.reset();
+}
+
 TEST_F(ServiceIOGroupTest, push_control)
 {
     std::vector<double> expected_setting = {4.321012};
@@ -5,6 +5,7 @@
 
 
 #include "StatsCollector.hpp"
+#include "RuntimeStats.hpp"
 #include "geopm_stats_collector.h"
 
 #include <memory>
@@ -192,6 +193,64 @@ TEST_F(StatsCollectorTest, time_report)
     free(report_struct_c.metric_stats);
 }
 
+/// @brief Report quantile estimates for a metric
+TEST_F(StatsCollectorTest, quantile_report)
+{
+    int metric_idx = 0;
+    int time_idx = 1;
+    EXPECT_CALL(*m_pio_mock, push_signal("CPU_POWER", 0, 0))
+        .WillOnce(Return(metric_idx));
+    EXPECT_CALL(*m_pio_mock, push_signal("TIME", 0, 0))
+        .WillOnce(Return(time_idx));
+    EXPECT_CALL(*m_pio_mock, read_signal("TIME", 0, 0))
+        .WillOnce(Return(0.0));
+    int num_update = 100;
+    for (int update_idx = 0; update_idx != num_update; ++update_idx) {
+        EXPECT_CALL(*m_pio_mock, sample(time_idx))
+            .WillOnce(Return(update_idx))
+            .RetiresOnSaturation();
+        EXPECT_CALL(*m_pio_mock, sample(metric_idx))
+            .WillOnce(Return(update_idx + 1.0))
+            .RetiresOnSaturation();
+    }
+    std::vector<geopm_request_s> req {geopm_request_s{0, 0, "CPU_POWER"}};
+    std::vector<double> quantiles {0.5, 0.95, 1.0};
+    auto coll = StatsCollectorImp(req, *m_pio_mock, quantiles);
+    for (int update_idx = 0; update_idx != num_update; ++update_idx) {
+        coll.update();
+    }
+    auto report_struct = coll.report_struct();
+    EXPECT_EQ(quantiles, report_struct.quantiles);
+    ASSERT_EQ(1ULL, report_struct.metric_quantiles.size());
+    ASSERT_EQ(quantiles.size(), report_struct.metric_quantiles[0].size());
+    EXPECT_NEAR(50.0, report_struct.metric_quantiles[0][0], 0.5);
+    EXPECT_NEAR(95.0, report_struct.metric_quantiles[0][1], 0.95);
+    // Estimates are limited by the max
+    EXPECT_EQ(100.0, report_struct.metric_quantiles[0][2]);
+
+    std::string report = coll.report_yaml();
+    size_t std_pos = report.find("    std: ");
+    ASSERT_NE(std::string::npos, std_pos);
+    EXPECT_LT(std_pos, report.find("    p50: "));
+    EXPECT_LT(report.find("    p50: "), report.find("    p95: "));
+    EXPECT_LT(report.find("    p95: "), report.find("    p100: 100\n"));
+
+    struct geopm_stats_collector_s *coll_ptr = reinterpret_cast<geopm_stats_collector_s *>(&coll);
+    std::vector<double> quantile_values(quantiles.size(), NAN);
+    EXPECT_EQ(GEOPM_ERROR_INVALID,
+              geopm_stats_collector_report_quantile(coll_ptr, 0, quantiles.size(), quantile_values.data()));
+    EXPECT_EQ(GEOPM_ERROR_INVALID,
+              geopm_stats_collector_report_quantile(coll_ptr, 1, 2, quantile_values.data()));
+    EXPECT_EQ(0, geopm_stats_collector_report_quantile(coll_ptr, 1, quantiles.size(), quantile_values.data()));
+    EXPECT_EQ(report_struct.metric_quantiles[0], quantile_values);
+
+    coll.reset();
+    report_struct = coll.report_struct();
+    EXPECT_TRUE(std::isnan(report_struct.metric_quantiles[0][0]));
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::RuntimeStats({"CPU_POWER"}, {1.5}),
+                               GEOPM_ERROR_INVALID, "quantile must be between zero and one");
+}
+
 TEST_F(StatsCollectorTest, c_strings)
 {
     MockStatsCollector mock_coll;
@@ -201,7 +260,7 @@ TEST_F(StatsCollectorTest, c_strings)
     std::string too_big_str(too_big.data());
     geopm::StatsCollector::report_s too_big_report {
         too_big_str, too_big_str, {0.0, 0.0, 0.0, 0.0},
-        {too_big_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {too_big_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}, {}, {}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(too_big_report));
     struct geopm_report_s report_c;
@@ -210,7 +269,7 @@ TEST_F(StatsCollectorTest, c_strings)
     std::string max_str(too_big.data() + 1);
     geopm::StatsCollector::report_s max_report {
         max_str, max_str, {0.0, 0.0, 0.0, 0.0},
-        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}, {}, {}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(max_report));
     EXPECT_EQ(0, geopm_stats_collector_report((geopm_stats_collector_s *)(&mock_coll), 1, &report_c));
@@ -220,7 +279,7 @@ TEST_F(StatsCollectorTest, c_strings)
 
     geopm::StatsCollector::report_s mixed_report {
         max_str, too_big_str, {0.0, 0.0, 0.0, 0.0},
-        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}
+        {max_str}, {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}, {}, {}
     };
     EXPECT_CALL(mock_coll, report_struct()).WillOnce(Return(mixed_report));
     EXPECT_EQ(-1, geopm_stats_collector_report((geopm_stats_collector_s *)(&mock_coll), 1, &report_c));
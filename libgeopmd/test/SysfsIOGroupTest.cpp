@@ -6,6 +6,7 @@
 #include "SysfsIOGroup.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
 
@@ -148,7 +149,7 @@ TEST_F(SysfsIOGroupTest, batch_reads)
     EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, _)).WillRepeatedly(Invoke(read_value));
     // Mock the translation from file contents to a number
     EXPECT_CALL(*m_driver, signal_parse("TESTIOGROUP::SIGNAL1"))
-        .WillRepeatedly(Return([](const std::string& value)->double {return std::stod(value);}));
+        .WillRepeatedly(Return([](const char *value)->double {return std::strtod(value, nullptr);}));
     auto signal_idx = m_group->push_signal("TESTIOGROUP::SIGNAL1", GEOPM_DOMAIN_BOARD, 0);
     m_group->read_batch();
     EXPECT_EQ(1.25, m_group->sample(signal_idx));
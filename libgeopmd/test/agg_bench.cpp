@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Compare the time to aggregate typical numbers of per-CPU operands
+/// through the std::function returned by Agg::type_to_function() and
+/// through Agg::aggregate().
+///
+/// Usage: agg_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "geopm_time.h"
+#include "geopm/Agg.hpp"
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 100000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    printf("agg | num_operand | function_nsec | aggregate_nsec\n");
+    for (int agg_type : {geopm::Agg::M_SUM, geopm::Agg::M_AVERAGE,
+                         geopm::Agg::M_MEDIAN, geopm::Agg::M_MIN,
+                         geopm::Agg::M_MAX, geopm::Agg::M_STDDEV}) {
+        auto func = geopm::Agg::type_to_function(agg_type);
+        for (int num_operand : {2, 56, 224, 448}) {
+            std::vector<double> operand(num_operand);
+            for (int idx = 0; idx < num_operand; ++idx) {
+                operand[idx] = 1.0e9 + 1.0e6 * (idx % 17);
+            }
+            double function_result = 0.0;
+            double aggregate_result = 0.0;
+            geopm_time_s begin;
+            geopm_time(&begin);
+            for (int iter = 0; iter < num_iteration; ++iter) {
+                function_result += func(operand);
+            }
+            double function_time = geopm_time_since(&begin);
+            geopm_time(&begin);
+            for (int iter = 0; iter < num_iteration; ++iter) {
+                aggregate_result += geopm::Agg::aggregate(agg_type, operand.data(), operand.size());
+            }
+            double aggregate_time = geopm_time_since(&begin);
+            if (function_result != aggregate_result) {
+                fprintf(stderr, "Warning: results differ for %s\n",
+                        geopm::Agg::type_to_name(agg_type).c_str());
+            }
+            printf("%s | %d | %f | %f\n", geopm::Agg::type_to_name(agg_type).c_str(),
+                   num_operand, 1e9 * function_time / num_iteration,
+                   1e9 * aggregate_time / num_iteration);
+        }
+    }
+    return 0;
+}
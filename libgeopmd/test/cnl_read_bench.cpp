@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Report the time spent by the CNLIOGroup sampling all of its
+/// signals.  The pm_counters files are in a temporary directory with
+/// the contents found in /sys/cray/pm_counters.  The time for
+/// read_batch() and sample() of all pushed signals is compared with
+/// the time for one read_signal() per signal, and with the time to
+/// read each file with read_double_from_file().
+///
+/// Usage: cnl_read_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "geopm_time.h"
+#include "geopm_topo.h"
+#include "geopm/Helper.hpp"
+#include "CNLIOGroup.hpp"
+
+// File name, contents and expected units
+static const std::vector<std::pair<std::string, std::pair<std::string, std::string> > > PM_COUNTERS = {
+    {"power", {"85 W\n", "W"}},
+    {"energy", {"598732067 J\n", "J"}},
+    {"memory_power", {"6 W\n", "W"}},
+    {"memory_energy", {"58869289 J\n", "J"}},
+    {"cpu_power", {"33 W\n", "W"}},
+    {"cpu_energy", {"374953759 J\n", "J"}},
+    {"freshness", {"1234\n", ""}},
+    {"raw_scan_hz", {"10\n", ""}},
+};
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 10000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    char counters_dir[] = "/tmp/cnl_read_bench-XXXXXX";
+    if (mkdtemp(counters_dir) == nullptr) {
+        perror("mkdtemp");
+        return -1;
+    }
+    for (const auto &counter : PM_COUNTERS) {
+        std::ofstream(std::string(counters_dir) + "/" + counter.first) << counter.second.first;
+    }
+
+    double batch_time = 0.0;
+    double signal_time = 0.0;
+    double file_time = 0.0;
+    double batch_sum = 0.0;
+    double signal_sum = 0.0;
+    {
+        geopm::CNLIOGroup group(counters_dir);
+        std::vector<std::string> signal_names;
+        std::vector<int> signal_idx;
+        for (const auto &name : group.signal_names()) {
+            signal_names.push_back(name);
+            signal_idx.push_back(group.push_signal(name, GEOPM_DOMAIN_BOARD, 0));
+        }
+        geopm_time_s begin;
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            group.read_batch();
+            for (int idx : signal_idx) {
+                batch_sum += group.sample(idx);
+            }
+        }
+        batch_time = geopm_time_since(&begin);
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            for (const auto &name : signal_names) {
+                signal_sum += group.read_signal(name, GEOPM_DOMAIN_BOARD, 0);
+            }
+        }
+        signal_time = geopm_time_since(&begin);
+        // Each pushed signal read from a file with the helper, as
+        // read_batch() did before the files were kept open
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            for (size_t name_idx = 0; name_idx != signal_names.size(); ++name_idx) {
+                const auto &counter = PM_COUNTERS[name_idx % (PM_COUNTERS.size() - 1)];
+                geopm::read_double_from_file(std::string(counters_dir) + "/" + counter.first,
+                                             counter.second.second);
+            }
+        }
+        file_time = geopm_time_since(&begin);
+        printf("num_signal | read_batch_usec | read_signal_usec | read_double_from_file_usec\n");
+        printf("%zu | %f | %f | %f\n", signal_names.size(),
+               1e6 * batch_time / num_iteration, 1e6 * signal_time / num_iteration,
+               1e6 * file_time / num_iteration);
+    }
+    if (batch_sum != signal_sum) {
+        fprintf(stderr, "Warning: read_batch() and read_signal() differ\n");
+    }
+    for (const auto &counter : PM_COUNTERS) {
+        unlink((std::string(counters_dir) + "/" + counter.first).c_str());
+    }
+    rmdir(counters_dir);
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Compare the time for MSRIO::read_batch() to read a few MSRs on
+/// every CPU through the msr-safe batch ioctl, through io_uring, and
+/// through a loop of pread() calls.  The MSR device files are found
+/// in msr_dir as <msr_dir>/<cpu>/msr_safe (or msr) and
+/// <msr_dir>/msr_batch.  A directory of regular files with the same
+/// layout can be used to measure the system call overhead on a system
+/// without MSR access.  Methods that cannot be used are reported as
+/// unavailable.
+///
+/// Usage: msr_batch_bench [num_iteration] [msr_dir]
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "geopm_sched.h"
+#include "geopm_time.h"
+#include "geopm/Exception.hpp"
+#include "IOUring.hpp"
+#include "IOUringFallback.hpp"
+#ifdef GEOPM_HAS_IO_URING
+#include "IOUringImp.hpp"
+#endif
+#include "MSRIOImp.hpp"
+#include "MSRPath.hpp"
+
+// TSC, MPERF, APERF and PKG_ENERGY_STATUS
+static const std::vector<uint64_t> MSR_OFFSET = {0x10, 0xE7, 0xE8, 0x611};
+
+class BenchMSRPath : public geopm::MSRPath
+{
+    public:
+        BenchMSRPath(const std::string &msr_dir, const std::string &msr_name,
+                     bool is_batch)
+            : m_msr_dir(msr_dir)
+            , m_msr_name(msr_name)
+            , m_is_batch(is_batch)
+        {
+        }
+        virtual ~BenchMSRPath() = default;
+        std::string msr_path(int cpu_idx) const override
+        {
+            return m_msr_dir + "/" + std::to_string(cpu_idx) + "/" + m_msr_name;
+        }
+        std::string msr_batch_path(void) const override
+        {
+            return m_is_batch ? m_msr_dir + "/msr_batch" : "";
+        }
+    private:
+        std::string m_msr_dir;
+        std::string m_msr_name;
+        bool m_is_batch;
+};
+
+static std::shared_ptr<geopm::IOUring> make_batcher(const std::string &method, int num_op)
+{
+    std::shared_ptr<geopm::IOUring> result;
+    if (method == "pread") {
+        result = geopm::IOUringFallback::make_unique(num_op);
+    }
+#ifdef GEOPM_HAS_IO_URING
+    else if (method == "io_uring" && geopm::IOUringImp::is_supported()) {
+        result = geopm::IOUringImp::make_unique(num_op);
+    }
+#endif
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 10000;
+    std::string msr_dir = "/dev/cpu";
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        msr_dir = argv[2];
+    }
+    int num_cpu = geopm_sched_num_cpu();
+    std::string msr_name = "msr_safe";
+    if (access((msr_dir + "/0/" + msr_name).c_str(), R_OK | W_OK) != 0) {
+        msr_name = "msr";
+    }
+    int num_op = num_cpu * MSR_OFFSET.size();
+    printf("method | num_cpu | num_msr | batch_usec\n");
+    for (const std::string method : {"ioctl", "io_uring", "pread"}) {
+        bool is_batch = method == "ioctl";
+        std::shared_ptr<geopm::IOUring> batcher;
+        if (is_batch) {
+            if (access((msr_dir + "/msr_batch").c_str(), R_OK | W_OK) != 0) {
+                printf("%s | %d | %zu | unavailable\n", method.c_str(), num_cpu, MSR_OFFSET.size());
+                continue;
+            }
+        }
+        else {
+            batcher = make_batcher(method, num_op);
+            if (batcher == nullptr) {
+                printf("%s | %d | %zu | unavailable\n", method.c_str(), num_cpu, MSR_OFFSET.size());
+                continue;
+            }
+        }
+        try {
+            auto path = std::make_shared<BenchMSRPath>(msr_dir, msr_name, is_batch);
+            geopm::MSRIOImp msrio(num_cpu, path, batcher, batcher);
+            for (int cpu_idx = 0; cpu_idx < num_cpu; ++cpu_idx) {
+                for (auto offset : MSR_OFFSET) {
+                    msrio.add_read(cpu_idx, offset);
+                }
+            }
+            // Warm up, and create the queue sized for the batch
+            msrio.read_batch();
+            geopm_time_s begin;
+            geopm_time(&begin);
+            for (int iter = 0; iter < num_iteration; ++iter) {
+                msrio.read_batch();
+            }
+            double batch_time = geopm_time_since(&begin);
+            printf("%s | %d | %zu | %f\n", method.c_str(), num_cpu, MSR_OFFSET.size(),
+                   1e6 * batch_time / num_iteration);
+        }
+        catch (const geopm::Exception &ex) {
+            printf("%s | %d | %zu | unavailable\n", method.c_str(), num_cpu, MSR_OFFSET.size());
+            fprintf(stderr, "Warning: %s: %s\n", method.c_str(), ex.what());
+        }
+    }
+    return 0;
+}
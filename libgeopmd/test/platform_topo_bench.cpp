@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Report the time to construct a PlatformTopo for a two socket node
+/// with eight GPUs, and the time spent in the domain nesting queries
+/// that PlatformIO makes while an agent pushes its signals and
+/// controls at initialization.  The queries are made through both
+/// domain_nested() and domain_nested_table().
+///
+/// Usage: platform_topo_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "geopm_time.h"
+#include "geopm_topo.h"
+#include "PlatformTopoImp.hpp"
+
+static const int NUM_PACKAGE = 2;
+static const int CORE_PER_PACKAGE = 56;
+static const int THREAD_PER_CORE = 2;
+static const int NUM_GPU = 8;
+static const int CHIP_PER_GPU = 2;
+
+static std::string cpu_mask(const std::set<int> &cpu_set)
+{
+    int num_cpu = NUM_PACKAGE * CORE_PER_PACKAGE * THREAD_PER_CORE;
+    std::string result;
+    for (int cpu_idx = 0; cpu_idx < num_cpu; cpu_idx += 4) {
+        int digit = 0;
+        for (int bit_idx = 0; bit_idx != 4; ++bit_idx) {
+            if (cpu_set.count(cpu_idx + bit_idx) != 0) {
+                digit |= 1 << bit_idx;
+            }
+        }
+        result.insert(result.begin(), "0123456789abcdef"[digit]);
+    }
+    return "0x" + result;
+}
+
+static std::string cpu_list(const std::set<int> &cpu_set)
+{
+    std::string result;
+    for (int cpu_idx : cpu_set) {
+        result += (result.empty() ? "" : ",") + std::to_string(cpu_idx);
+    }
+    return result;
+}
+
+// Cache file contents where each GPU is associated with the
+// hyper-threads of an equal share of the cores in one package, and
+// each GPU chip with half of the GPU's cores.
+static std::string topo_cache(void)
+{
+    int num_core = NUM_PACKAGE * CORE_PER_PACKAGE;
+    int num_cpu = num_core * THREAD_PER_CORE;
+    int core_per_gpu = num_core / NUM_GPU;
+    int core_per_chip = core_per_gpu / CHIP_PER_GPU;
+    std::set<int> all_cpu;
+    std::vector<std::set<int> > package_cpu(NUM_PACKAGE);
+    std::vector<std::set<int> > gpu_cpu(NUM_GPU);
+    std::vector<std::set<int> > chip_cpu(NUM_GPU * CHIP_PER_GPU);
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        int core_idx = cpu_idx % num_core;
+        all_cpu.insert(cpu_idx);
+        package_cpu[core_idx / CORE_PER_PACKAGE].insert(cpu_idx);
+        gpu_cpu[core_idx / core_per_gpu].insert(cpu_idx);
+        chip_cpu[core_idx / core_per_chip].insert(cpu_idx);
+    }
+    std::string result =
+        "Architecture:        x86_64\n"
+        "CPU(s):              " + std::to_string(num_cpu) + "\n"
+        "On-line CPU(s) mask: " + cpu_mask(all_cpu) + "\n"
+        "Thread(s) per core:  " + std::to_string(THREAD_PER_CORE) + "\n"
+        "Core(s) per socket:  " + std::to_string(CORE_PER_PACKAGE) + "\n"
+        "Socket(s):           " + std::to_string(NUM_PACKAGE) + "\n"
+        "NUMA node(s):        " + std::to_string(NUM_PACKAGE) + "\n";
+    for (int package_idx = 0; package_idx != NUM_PACKAGE; ++package_idx) {
+        result += "NUMA node" + std::to_string(package_idx) + " CPU(s):   " +
+                  cpu_mask(package_cpu[package_idx]) + "\n";
+    }
+    for (int gpu_idx = 0; gpu_idx != NUM_GPU; ++gpu_idx) {
+        result += "GPU node" + std::to_string(gpu_idx) + " CPU(s): " +
+                  cpu_list(gpu_cpu[gpu_idx]) + "\n";
+    }
+    for (int chip_idx = 0; chip_idx != NUM_GPU * CHIP_PER_GPU; ++chip_idx) {
+        result += "GPU chip" + std::to_string(chip_idx) + " CPU(s): " +
+                  cpu_list(chip_cpu[chip_idx]) + "\n";
+    }
+    return result;
+}
+
+// Pairs of native and requested domains for the signals and controls
+// pushed by the frequency map, CPU activity, GPU activity and power
+// balancer agents.
+static const std::vector<std::pair<int, int> > AGENT_NESTING = {
+    {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_PACKAGE},
+    {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_CORE},
+    {GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_PACKAGE},
+    {GEOPM_DOMAIN_PACKAGE, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_MEMORY, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_GPU},
+    {GEOPM_DOMAIN_GPU, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_GPU_CHIP, GEOPM_DOMAIN_BOARD},
+    {GEOPM_DOMAIN_GPU_CHIP, GEOPM_DOMAIN_GPU},
+};
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 1000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    char cache_file_name[] = "/tmp/platform_topo_bench-XXXXXX";
+    int fd = mkstemp(cache_file_name);
+    if (fd == -1) {
+        perror("mkstemp");
+        return -1;
+    }
+    close(fd);
+    std::string binary_file_name = geopm::PlatformTopoImp::binary_cache_file_name(cache_file_name);
+    std::ofstream(cache_file_name) << topo_cache();
+
+    geopm_time_s begin;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        unlink(binary_file_name.c_str());
+        geopm::PlatformTopoImp topo(cache_file_name, nullptr);
+    }
+    double text_time = geopm_time_since(&begin);
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        geopm::PlatformTopoImp topo(cache_file_name, nullptr);
+    }
+    double binary_time = geopm_time_since(&begin);
+
+    geopm::PlatformTopoImp topo(cache_file_name, nullptr);
+    long nested_sum = 0;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        for (const auto &nesting : AGENT_NESTING) {
+            for (int outer_idx = 0; outer_idx != topo.num_domain(nesting.second); ++outer_idx) {
+                for (int inner_idx : topo.domain_nested(nesting.first, nesting.second, outer_idx)) {
+                    nested_sum += inner_idx;
+                }
+            }
+        }
+    }
+    double nested_time = geopm_time_since(&begin);
+    long table_sum = 0;
+    geopm_time(&begin);
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        for (const auto &nesting : AGENT_NESTING) {
+            const auto &table = topo.domain_nested_table(nesting.first, nesting.second);
+            for (int inner_idx : table.inner_idx) {
+                table_sum += inner_idx;
+            }
+        }
+    }
+    double table_time = geopm_time_since(&begin);
+    if (nested_sum != table_sum) {
+        fprintf(stderr, "Warning: domain_nested() and domain_nested_table() differ\n");
+    }
+    unlink(binary_file_name.c_str());
+    unlink(cache_file_name);
+
+    printf("num_cpu | num_gpu | text_usec | binary_usec | domain_nested_usec | domain_nested_table_usec\n");
+    printf("%d | %d | %f | %f | %f | %f\n", topo.num_domain(GEOPM_DOMAIN_CPU),
+           topo.num_domain(GEOPM_DOMAIN_GPU),
+           1e6 * text_time / num_iteration, 1e6 * binary_time / num_iteration,
+           1e6 * nested_time / num_iteration, 1e6 * table_time / num_iteration);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Compare the CPU time used by the Python geopmexporter and the
+/// native geopmprometheus exporters.  Each exporter is run with the
+/// same sample period for the same duration while it is scraped once
+/// per second, and the user plus system time of the process is
+/// reported.  Both commands must be in the PATH.
+///
+/// Usage: prometheus_exporter_bench [duration [period [port [signal_config]]]]
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "geopm_time.h"
+
+// Returns the number of bytes in the response, or -1 on failure
+static int scrape(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd == -1) {
+        return -1;
+    }
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int result = -1;
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+        const char *request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        if (send(fd, request, strlen(request), MSG_NOSIGNAL) == (ssize_t)strlen(request)) {
+            char buf[65536];
+            ssize_t num_read = 0;
+            result = 0;
+            while ((num_read = recv(fd, buf, sizeof(buf), 0)) > 0) {
+                result += num_read;
+            }
+        }
+    }
+    close(fd);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    double duration = 60.0;
+    std::string period = "0.1";
+    int port = 8765;
+    std::string config_path;
+    if (argc > 1) {
+        duration = std::atof(argv[1]);
+    }
+    if (argc > 2) {
+        period = argv[2];
+    }
+    if (argc > 3) {
+        port = std::atoi(argv[3]);
+    }
+    if (argc > 4) {
+        config_path = argv[4];
+    }
+    printf("command | duration | num_scrape | response_bytes | cpu_sec | cpu_percent\n");
+    for (std::string command : {"geopmexporter", "geopmprometheus"}) {
+        std::string port_str = std::to_string(port);
+        pid_t pid = fork();
+        if (pid == 0) {
+            std::vector<const char *> exec_argv = {
+                command.c_str(), "-t", period.c_str(), "-p", port_str.c_str()
+            };
+            if (!config_path.empty()) {
+                exec_argv.push_back("-i");
+                exec_argv.push_back(config_path.c_str());
+            }
+            exec_argv.push_back(nullptr);
+            execvp(command.c_str(), (char * const *)exec_argv.data());
+            fprintf(stderr, "Error: unable to run %s: %s\n", command.c_str(), strerror(errno));
+            _exit(127);
+        }
+        if (pid == -1) {
+            perror("fork");
+            return -1;
+        }
+        // Wait for the exporter to listen
+        geopm_time_s begin;
+        geopm_time(&begin);
+        int response_size = -1;
+        while (response_size < 0 && geopm_time_since(&begin) < 10.0 &&
+               waitpid(pid, nullptr, WNOHANG) == 0) {
+            usleep(100000);
+            response_size = scrape(port);
+        }
+        int num_scrape = 0;
+        if (response_size >= 0) {
+            geopm_time(&begin);
+            while (geopm_time_since(&begin) < duration) {
+                sleep(1);
+                response_size = scrape(port);
+                ++num_scrape;
+            }
+        }
+        kill(pid, SIGTERM);
+        int status = 0;
+        struct rusage usage = {};
+        wait4(pid, &status, 0, &usage);
+        if (num_scrape == 0) {
+            fprintf(stderr, "Warning: %s did not respond\n", command.c_str());
+            continue;
+        }
+        double cpu_sec = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 +
+                         usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+        printf("%s | %f | %d | %d | %f | %f\n", command.c_str(), duration,
+               num_scrape, response_size, cpu_sec, 100.0 * cpu_sec / duration);
+        // Use a new port so the next exporter does not wait for the
+        // socket to leave TIME_WAIT
+        ++port;
+    }
+    return 0;
+}
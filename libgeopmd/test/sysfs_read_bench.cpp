@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Report the time spent by the SysfsIOGroup sampling the cpufreq
+/// scaling_cur_freq attribute of every CPU on a two socket node with
+/// 448 CPUs.  The attributes are files in a temporary directory
+/// arranged like /sys/devices/system/cpu/cpufreq with one policy per
+/// CPU.  The time for read_batch() and sample() of all pushed
+/// signals is compared with the time for one read_signal() per CPU.
+///
+/// Usage: sysfs_read_bench [num_iteration]
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "geopm_time.h"
+#include "geopm_topo.h"
+#include "CpufreqSysfsDriver.hpp"
+#include "PlatformTopoImp.hpp"
+#include "SysfsIOGroup.hpp"
+
+static const int NUM_PACKAGE = 2;
+static const int CORE_PER_PACKAGE = 112;
+static const int THREAD_PER_CORE = 2;
+
+// Mask of the hyper-threads of cores begin_core up to but not
+// including end_core.
+static std::string cpu_mask(int begin_core, int end_core, int num_cpu)
+{
+    std::string result;
+    for (int cpu_idx = 0; cpu_idx < num_cpu; cpu_idx += 4) {
+        int digit = 0;
+        for (int bit_idx = 0; bit_idx != 4; ++bit_idx) {
+            int core_idx = (cpu_idx + bit_idx) % (num_cpu / THREAD_PER_CORE);
+            if (core_idx >= begin_core && core_idx < end_core) {
+                digit |= 1 << bit_idx;
+            }
+        }
+        result.insert(result.begin(), "0123456789abcdef"[digit]);
+    }
+    return "0x" + result;
+}
+
+// Cache file contents where the hyper-threads of a core are numbered
+// one core count apart.
+static std::string topo_cache(void)
+{
+    int num_core = NUM_PACKAGE * CORE_PER_PACKAGE;
+    int num_cpu = num_core * THREAD_PER_CORE;
+    std::string result =
+        "Architecture:        x86_64\n"
+        "CPU(s):              " + std::to_string(num_cpu) + "\n"
+        "On-line CPU(s) mask: " + cpu_mask(0, num_core, num_cpu) + "\n"
+        "Thread(s) per core:  " + std::to_string(THREAD_PER_CORE) + "\n"
+        "Core(s) per socket:  " + std::to_string(CORE_PER_PACKAGE) + "\n"
+        "Socket(s):           " + std::to_string(NUM_PACKAGE) + "\n"
+        "NUMA node(s):        " + std::to_string(NUM_PACKAGE) + "\n";
+    for (int package_idx = 0; package_idx != NUM_PACKAGE; ++package_idx) {
+        result += "NUMA node" + std::to_string(package_idx) + " CPU(s):   " +
+                  cpu_mask(package_idx * CORE_PER_PACKAGE,
+                           (package_idx + 1) * CORE_PER_PACKAGE, num_cpu) + "\n";
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 1000;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    char cache_file_name[] = "/tmp/sysfs_read_bench-XXXXXX";
+    int fd = mkstemp(cache_file_name);
+    if (fd == -1) {
+        perror("mkstemp");
+        return -1;
+    }
+    close(fd);
+    char cpufreq_dir[] = "/tmp/sysfs_read_bench-cpufreq-XXXXXX";
+    if (mkdtemp(cpufreq_dir) == nullptr) {
+        perror("mkdtemp");
+        unlink(cache_file_name);
+        return -1;
+    }
+    std::ofstream(cache_file_name) << topo_cache();
+    geopm::PlatformTopoImp topo(cache_file_name, nullptr);
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    std::vector<std::string> policy_dirs;
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        std::string policy_dir = std::string(cpufreq_dir) + "/policy" + std::to_string(cpu_idx);
+        mkdir(policy_dir.c_str(), 0755);
+        std::ofstream(policy_dir + "/affected_cpus") << cpu_idx << "\n";
+        std::ofstream(policy_dir + "/scaling_cur_freq") << 1000000 + 100000 * (cpu_idx % 29) << "\n";
+        policy_dirs.push_back(policy_dir);
+    }
+
+    double batch_time = 0.0;
+    double signal_time = 0.0;
+    double batch_sum = 0.0;
+    double signal_sum = 0.0;
+    {
+        auto driver = std::make_shared<geopm::CpufreqSysfsDriver>(topo, cpufreq_dir);
+        geopm::SysfsIOGroup group(driver, topo, nullptr, nullptr, nullptr);
+        std::vector<int> signal_idx(num_cpu);
+        for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+            signal_idx[cpu_idx] = group.push_signal("CPUFREQ::SCALING_CUR_FREQ",
+                                                    GEOPM_DOMAIN_CPU, cpu_idx);
+        }
+        geopm_time_s begin;
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            group.read_batch();
+            for (int idx : signal_idx) {
+                batch_sum += group.sample(idx);
+            }
+        }
+        batch_time = geopm_time_since(&begin);
+        geopm_time(&begin);
+        for (int iter = 0; iter < num_iteration; ++iter) {
+            for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+                signal_sum += group.read_signal("CPUFREQ::SCALING_CUR_FREQ",
+                                                GEOPM_DOMAIN_CPU, cpu_idx);
+            }
+        }
+        signal_time = geopm_time_since(&begin);
+    }
+    if (batch_sum != signal_sum) {
+        fprintf(stderr, "Warning: read_batch() and read_signal() differ\n");
+    }
+    for (const auto &policy_dir : policy_dirs) {
+        unlink((policy_dir + "/affected_cpus").c_str());
+        unlink((policy_dir + "/scaling_cur_freq").c_str());
+        rmdir(policy_dir.c_str());
+    }
+    rmdir(cpufreq_dir);
+    unlink(geopm::PlatformTopoImp::binary_cache_file_name(cache_file_name).c_str());
+    unlink(cache_file_name);
+
+    printf("num_cpu | read_batch_usec | read_signal_usec\n");
+    printf("%d | %f | %f\n", num_cpu,
+           1e6 * batch_time / num_iteration, 1e6 * signal_time / num_iteration);
+    return 0;
+}